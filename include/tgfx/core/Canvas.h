@@ -479,6 +479,7 @@ class Canvas {
   friend class Surface;
   friend class Picture;
   friend class Recorder;
+  friend class RasterSurface;
   friend class SVGExporter;
 };
 
@@ -29,7 +29,9 @@ namespace tgfx {
 class Data {
  public:
   /**
-   * Creates a Data object from the specified file path.
+   * Creates a Data object from the specified file path. Large local files may be memory-mapped
+   * instead of copied into memory. In that case the file must not be truncated or rewritten while
+   * the returned Data is alive, otherwise reading it may crash or return the new contents.
    */
   static std::shared_ptr<Data> MakeFromFile(const std::string& filePath);
 
@@ -107,5 +107,6 @@ class ImageBuffer {
   virtual std::shared_ptr<Texture> onMakeTexture(Context* context, bool mipmapped) const = 0;
 
   friend class Texture;
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
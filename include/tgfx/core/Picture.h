@@ -70,6 +70,15 @@ class Picture {
    */
   Rect getTightBounds(const Matrix* matrix = nullptr) const;
 
+  /**
+   * Returns a rectangle in the Picture's local coordinate space that is entirely covered by opaque
+   * drawing commands, so anything beneath it is hidden once the Picture is drawn at full opacity.
+   * The result is conservative: it is the largest single area covered by an opaque rect, rrect, or
+   * clipped fill, and images are never counted since their pixels may be translucent. Returns an
+   * empty Rect if no such area is found.
+   */
+  Rect getOpaqueBounds() const;
+
   /**
    * Checks whether any drawing commands in the Picture overlap or intersect with the specified
    * point (localX, localY).
@@ -95,6 +104,7 @@ class Picture {
   std::unique_ptr<BlockData> blockData;
   std::vector<PlacementPtr<Record>> records;
   mutable std::atomic<Rect*> bounds = {nullptr};
+  mutable std::atomic<Rect*> opaqueBounds = {nullptr};
   size_t drawCount = 0;
   bool _hasUnboundedFill = false;
 
@@ -113,6 +123,7 @@ class Picture {
   friend class MeasureContext;
   friend class HitTestContext;
   friend class RenderContext;
+  friend class RasterContext;
   friend class RecordingContext;
   friend class SVGExportContext;
   friend class Image;
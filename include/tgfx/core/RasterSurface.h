@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "tgfx/core/Canvas.h"
+#include "tgfx/core/Image.h"
+
+namespace tgfx {
+class RasterBuffer;
+class RasterContext;
+
+/**
+ * RasterSurface is responsible for managing the pixels that a Canvas draws into without a GPU. All
+ * drawing commands are rasterized immediately on the CPU into premultiplied RGBA_8888 pixels, and
+ * large draws are split across the worker threads. It supports the same drawing APIs as a GPU
+ * Surface, except for images backed by GPU textures and runtime effects, which are skipped. Use it
+ * for headless rendering, thumbnails or platforms where no GPU is available.
+ */
+class RasterSurface {
+ public:
+  /**
+   * Creates a new RasterSurface with the specified width and height. All pixels are initialized to
+   * transparent. Returns nullptr if the width or height is not greater than zero.
+   */
+  static std::shared_ptr<RasterSurface> Make(int width, int height);
+
+  ~RasterSurface();
+
+  /**
+   * Returns the width of this surface.
+   */
+  int width() const;
+
+  /**
+   * Returns the height of this surface.
+   */
+  int height() const;
+
+  /**
+   * Returns Canvas that draws into the RasterSurface. Subsequent calls return the same Canvas.
+   * Canvas returned is managed and owned by RasterSurface, and is deleted when the RasterSurface is
+   * deleted.
+   */
+  Canvas* getCanvas();
+
+  /**
+   * Returns an Image capturing the RasterSurface contents. Subsequent drawings to the RasterSurface
+   * contents are not captured.
+   */
+  std::shared_ptr<Image> makeImageSnapshot() const;
+
+  /**
+   * Copies a rect of pixels to dstPixels with specified ImageInfo. Copy starts at (srcX, srcY), and
+   * does not exceed RasterSurface (width(), height()). Pixels are copied only if pixel conversion
+   * is possible. Returns true if pixels are copied to dstPixels.
+   */
+  bool readPixels(const ImageInfo& dstInfo, void* dstPixels, int srcX = 0, int srcY = 0) const;
+
+ private:
+  std::shared_ptr<RasterBuffer> buffer = nullptr;
+  RasterContext* rasterContext = nullptr;
+  Canvas* canvas = nullptr;
+
+  explicit RasterSurface(std::shared_ptr<RasterBuffer> buffer);
+};
+}  // namespace tgfx
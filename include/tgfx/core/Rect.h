@@ -446,6 +446,17 @@ struct Rect {
     bottom = ceilf(bottom);
   }
 
+  /**
+   * Sets Rect by rounding up left and top; and discarding the fractional portion of right and
+   * bottom.
+   */
+  void roundIn() {
+    left = ceilf(left);
+    top = ceilf(top);
+    right = floorf(right);
+    bottom = floorf(bottom);
+  }
+
   /**
    * Sets Rect by rounding of left, top, right and bottom.
    */
@@ -32,7 +32,10 @@ class Stream {
   virtual ~Stream() = default;
 
   /**
-   * Attempts to open the specified file as a stream, returns nullptr on failure.
+   * Attempts to open the specified file as a stream, returns nullptr on failure. Large local files
+   * may be memory-mapped instead of read through file I/O. In that case the file must not be
+   * truncated or rewritten while the stream is alive, otherwise reading it may crash or return the
+   * new contents.
    */
   static std::unique_ptr<Stream> MakeFromFile(const std::string& filePath);
 
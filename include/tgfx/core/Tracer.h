@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace tgfx {
+/**
+ * Defines the counters that the Tracer accumulates for every frame.
+ */
+enum class TraceCounter {
+  /**
+   * The number of draw calls issued to the GPU.
+   */
+  DrawCalls,
+  /**
+   * The number of draw ops executed by render tasks.
+   */
+  DrawOps,
+  /**
+   * The number of textures uploaded to the GPU.
+   */
+  TextureUploads,
+  /**
+   * The number of GPU buffers uploaded to the GPU.
+   */
+  BufferUploads,
+  /**
+   * The total bytes of textures and buffers uploaded to the GPU.
+   */
+  UploadBytes,
+  /**
+   * The number of resources found in the ResourceCache.
+   */
+  CacheHits,
+  /**
+   * The number of resources not found in the ResourceCache.
+   */
+  CacheMisses,
+  /**
+   * The number of GPU programs compiled.
+   */
+  ProgramCompiles,
+  /**
+   * The number of tile draw tasks executed by a DisplayList in tiled rendering mode. Adjacent tiles
+   * drawn in a single pass count as one task.
+   */
+  TileDraws,
+  /**
+   * The number of tiles refined from a cached zoom level to the current zoom scale by a
+   * DisplayList in tiled rendering mode.
+   */
+  TileRefinements,
+  /**
+   * The number of tiles rendered ahead of the viewport along the predicted panning path by a
+   * DisplayList in tiled rendering mode.
+   */
+  TilePrefetches,
+  /**
+   * The number of counters, not a valid counter.
+   */
+  Count
+};
+
+/**
+ * FrameCounters holds the values of all TraceCounters accumulated during one frame.
+ */
+struct FrameCounters {
+  /**
+   * The index of the frame, starting from zero when the Tracer starts.
+   */
+  uint64_t frameIndex = 0;
+
+  /**
+   * The time in microseconds when the frame ended, relative to the start of the Tracer.
+   */
+  int64_t timestamp = 0;
+
+  /**
+   * The counter values, indexed by TraceCounter.
+   */
+  std::array<uint64_t, static_cast<size_t>(TraceCounter::Count)> values = {};
+
+  uint64_t operator[](TraceCounter counter) const {
+    return values[static_cast<size_t>(counter)];
+  }
+};
+
+/**
+ * Tracer is a low-overhead in-process profiler. When tgfx is built with TGFX_USE_TRACE, the hot
+ * paths of the library, such as recording, flushing, resource uploads, program compiles, path
+ * rasterization and task execution, record timed zones into per-thread ring buffers while the
+ * Tracer is active. The recorded zones and the per-frame counters can be exported as a Chrome
+ * trace JSON file, which can be opened offline in chrome://tracing or the Perfetto UI. Without
+ * TGFX_USE_TRACE, the Tracer can still be started, but no events are recorded by the library.
+ */
+class Tracer {
+ public:
+  /**
+   * Starts recording and discards all previously recorded events and counters. The eventsPerThread
+   * parameter is the capacity of the ring buffer of each thread. When a ring buffer is full, the
+   * oldest events are overwritten.
+   */
+  static void Start(size_t eventsPerThread = 65536);
+
+  /**
+   * Stops recording. The recorded events are kept until the next call to Start().
+   */
+  static void Stop();
+
+  /**
+   * Returns true if the Tracer is currently recording.
+   */
+  static bool IsActive();
+
+  /**
+   * Ends the current frame, storing its counters and resetting them for the next frame. With
+   * TGFX_USE_TRACE, Context calls it after each flush that executes any task, and applications may
+   * also call it at their own frame boundaries.
+   */
+  static void MarkFrame();
+
+  /**
+   * Returns the counters of the most recent frames, in order from oldest to newest.
+   */
+  static std::vector<FrameCounters> GetFrameCounters();
+
+  /**
+   * Writes all recorded events and frame counters to the specified file in the Chrome trace JSON
+   * format. It should be called after Stop() to get a consistent snapshot. Returns false if the
+   * file can not be written.
+   */
+  static bool WriteChromeTrace(const std::string& filePath);
+};
+}  // namespace tgfx
@@ -23,6 +23,7 @@
 #include "tgfx/gpu/Backend.h"
 #include "tgfx/gpu/Caps.h"
 #include "tgfx/gpu/Device.h"
+#include "tgfx/gpu/MemoryStats.h"
 
 namespace tgfx {
 class GlobalCache;
@@ -138,6 +139,32 @@ class Context {
    */
   bool purgeResourcesUntilMemoryTo(size_t bytesLimit);
 
+  /**
+   * Returns the memory budget of the specified resource category in bytes. The default value is
+   * unlimited, in which case only the total cache limit applies.
+   */
+  size_t cacheLimit(ResourceCategory category) const;
+
+  /**
+   * Sets the memory budget of the specified resource category in bytes. Whenever the category
+   * exceeds its budget, its purgeable resources are released in LRU order. Resources that are still
+   * in use are never released, so a category may temporarily exceed its budget.
+   */
+  void setCacheLimit(ResourceCategory category, size_t bytesLimit);
+
+  /**
+   * Releases GPU memory in response to a memory warning from the operating system. Resources are
+   * purged in a fixed priority order: idle scratch resources first, then cached offscreen render
+   * targets, then glyph atlases, and finally images and everything else that is purgeable. The
+   * level decides how far along this order the purge goes.
+   */
+  void onMemoryPressure(MemoryPressureLevel level);
+
+  /**
+   * Returns a snapshot of the current GPU memory usage, broken down by resource category.
+   */
+  MemoryStats memoryStats() const;
+
   /**
    * Inserts a GPU semaphore that the current GPU-backed API must wait on before executing any more
    * commands on the GPU. The context will take ownership of the underlying semaphore and delete it
@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace tgfx {
+/**
+ * Defines the categories of GPU resources that the Context accounts memory for separately.
+ */
+enum class ResourceCategory {
+  /**
+   * Textures created from images, pixels, or picture contents.
+   */
+  Image,
+
+  /**
+   * Textures that can be rendered to, such as offscreen layers, filter intermediates, and clip
+   * masks.
+   */
+  RenderTarget,
+
+  /**
+   * Atlas textures that store glyphs and other small masks.
+   */
+  Atlas,
+
+  /**
+   * Lookup textures used by gradient shaders.
+   */
+  Gradient,
+
+  /**
+   * Vertex and index buffers.
+   */
+  Buffer,
+
+  /**
+   * Any other GPU resources, such as shader programs and frame buffers. New categories must be
+   * added above this one, since it is used to count the categories.
+   */
+  Other
+};
+
+/**
+ * The number of values in ResourceCategory.
+ */
+static constexpr size_t ResourceCategoryCount = static_cast<size_t>(ResourceCategory::Other) + 1;
+
+/**
+ * Defines how hard the Context should try to release GPU memory when the system is running low.
+ */
+enum class MemoryPressureLevel {
+  /**
+   * Releases idle scratch resources only, which are cheap to recreate.
+   */
+  Low,
+
+  /**
+   * Additionally releases cached offscreen render targets, such as rasterized images.
+   */
+  Moderate,
+
+  /**
+   * Additionally releases the glyph atlases and all other purgeable resources, including image
+   * textures. Everything released will be recreated on demand in later frames.
+   */
+  Critical
+};
+
+/**
+ * MemoryStats is a snapshot of the GPU memory usage of a Context, intended for telemetry.
+ */
+struct MemoryStats {
+  /**
+   * The number of bytes consumed by all GPU resources.
+   */
+  size_t totalBytes = 0;
+
+  /**
+   * The number of bytes held by purgeable resources.
+   */
+  size_t purgeableBytes = 0;
+
+  /**
+   * The total cache limit in bytes.
+   */
+  size_t cacheLimit = 0;
+
+  /**
+   * The number of bytes consumed by each ResourceCategory, indexed by the category value.
+   */
+  std::array<size_t, ResourceCategoryCount> categoryBytes = {};
+
+  /**
+   * The number of bytes held by resources with a scratch key, which can be reused by any request
+   * with the same properties.
+   */
+  size_t scratchBytes = 0;
+
+  /**
+   * The number of bytes held by scratch resources that are currently idle.
+   */
+  size_t idleScratchBytes = 0;
+
+  /**
+   * The number of scratch resource lookups since the Context was created.
+   */
+  size_t scratchRequests = 0;
+
+  /**
+   * The number of scratch resource lookups satisfied by reusing an idle resource.
+   */
+  size_t scratchReuses = 0;
+
+  /**
+   * Returns the number of bytes consumed by the specified category.
+   */
+  size_t bytes(ResourceCategory category) const {
+    return categoryBytes[static_cast<size_t>(category)];
+  }
+};
+}  // namespace tgfx
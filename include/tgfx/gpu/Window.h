@@ -49,6 +49,23 @@ class Window {
    */
   void present(Context* context, int64_t presentationTime = INT64_MIN);
 
+  /**
+   * Applies all pending graphics changes to the window, telling the platform that only the given
+   * regions of the window have changed since the last presentation. The regions are in device
+   * pixels with the origin at the top-left corner of the window. If damageRects is empty, the whole
+   * window is treated as changed. Platforms without damage-aware presentation ignore the regions.
+   */
+  void present(Context* context, const std::vector<Rect>& damageRects,
+               int64_t presentationTime = INT64_MIN);
+
+  /**
+   * Returns the number of frames since the current content of the window's back buffer was
+   * presented, or 0 if the content is undefined or the platform cannot tell. A buffer age of 1
+   * means the back buffer holds the last presented frame. Call it before drawing each frame and
+   * pass the result to DisplayList::render() to redraw only the regions that changed.
+   */
+  int getBufferAge(Context* context);
+
   /**
    * Invalidates the cached surface associated with this Window. This is useful when the window is
    * resized and the surface needs to be recreated.
@@ -73,6 +90,9 @@ class Window {
   virtual void onInvalidSize();
   virtual std::shared_ptr<Surface> onCreateSurface(Context* context) = 0;
   virtual void onPresent(Context* context, int64_t presentationTime) = 0;
+  virtual void onPresentWithDamage(Context* context, const std::vector<Rect>& damageRects,
+                                   int64_t presentationTime);
+  virtual int onGetBufferAge(Context* context);
   virtual void onFreeSurface();
 
  private:
@@ -40,10 +40,21 @@ class EGLWindow : public Window {
   void onInvalidSize() override;
   std::shared_ptr<Surface> onCreateSurface(Context* context) override;
   void onPresent(Context* context, int64_t presentationTime) override;
+  void onPresentWithDamage(Context* context, const std::vector<Rect>& damageRects,
+                           int64_t presentationTime) override;
+  int onGetBufferAge(Context* context) override;
 
  private:
   EGLNativeWindowType nativeWindow;
+  // The extensions supported by the EGLDisplay of the device, queried on first use.
+  bool extensionsQueried = false;
+  bool hasBufferAge = false;
+  PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC eglSwapBuffersWithDamage = nullptr;
 
   explicit EGLWindow(std::shared_ptr<Device> device);
+
+  void queryExtensions(EGLDisplay eglDisplay);
+
+  void setPresentationTime(int64_t presentationTime);
 };
 }  // namespace tgfx
@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include "tgfx/core/Picture.h"
+
+namespace tgfx {
+class DisplayList;
+class Layer;
+
+/**
+ * DisplayFrame is an immutable snapshot of a layer tree, captured by DisplayList::commit(). It
+ * holds the recorded drawing commands of all layers, the regions changed since the previous
+ * commit, and the zoomScale and contentOffset at the time of the commit. A DisplayFrame is
+ * thread-safe and can be handed from the thread that mutates the layers to another thread that
+ * renders it with a separate DisplayList.
+ */
+class DisplayFrame {
+ public:
+  /**
+   * Returns the zoomScale of the display list when the frame was committed.
+   */
+  float zoomScale() const {
+    return _zoomScale;
+  }
+
+  /**
+   * Returns the contentOffset of the display list when the frame was committed.
+   */
+  const Point& contentOffset() const {
+    return _contentOffset;
+  }
+
+  /**
+   * Returns the regions of the layer tree that changed since the previous commit, in the
+   * coordinate space of the root layer. They are only valid relative to the frame committed right
+   * before this one.
+   */
+  const std::vector<Rect>& dirtyRegions() const {
+    return _dirtyRegions;
+  }
+
+ private:
+  /**
+   * The recording of a top-level layer, along with its bounds in the coordinate space of the root
+   * layer. The layer pointer only identifies the layer when the next frame is committed and is never
+   * dereferenced by the rendering side.
+   */
+  struct LayerPicture {
+    const Layer* layer = nullptr;
+    Rect bounds = {};
+    std::shared_ptr<Picture> picture = nullptr;
+  };
+
+  uint32_t uniqueID = 0;
+  uint32_t previousID = 0;
+  std::vector<LayerPicture> layerPictures = {};
+  Rect opaqueBounds = {};
+  std::vector<Rect> _dirtyRegions = {};
+  float _zoomScale = 1.0f;
+  Point _contentOffset = {};
+
+  DisplayFrame(uint32_t uniqueID, uint32_t previousID, std::vector<LayerPicture> layerPictures,
+               const Rect& opaqueBounds, std::vector<Rect> dirtyRegions, float zoomScale,
+               const Point& contentOffset)
+      : uniqueID(uniqueID), previousID(previousID), layerPictures(std::move(layerPictures)),
+        opaqueBounds(opaqueBounds), _dirtyRegions(std::move(dirtyRegions)),
+        _zoomScale(zoomScale), _contentOffset(contentOffset) {
+  }
+
+  friend class DisplayList;
+};
+}  // namespace tgfx
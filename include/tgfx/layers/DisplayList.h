@@ -21,6 +21,7 @@
 #include <deque>
 #include <unordered_map>
 #include "tgfx/core/Surface.h"
+#include "tgfx/layers/DisplayFrame.h"
 #include "tgfx/layers/Layer.h"
 
 namespace tgfx {
@@ -64,7 +65,9 @@ enum class RenderMode {
 
 /**
  * DisplayList represents a collection of layers can be drawn to a Surface. Note: All layers in the
- * display list are not thread-safe and should only be accessed from a single thread.
+ * display list are not thread-safe and should only be accessed from a single thread. To render on
+ * a different thread, call commit() on the thread that mutates the layers, and pass the returned
+ * DisplayFrame to another DisplayList with setFrame() on the rendering thread.
  */
 class DisplayList {
  public:
@@ -184,19 +187,20 @@ class DisplayList {
   void setMaxTileCount(int count);
 
   /**
-   * Returns true if zoom blur is allowed in tiled rendering mode. This setting is ignored in other
-   * render modes. When enabled, if the zoomScale changes and cached images at other zoom levels are
-   * available, the display list will use those caches to render first, then gradually update to the
-   * current zoomScale in later frames. Use setMaxTilesRefinedPerFrame() to control how many tiles
-   * are updated per frame. This can improve zooming performance, but may cause temporary zoom blur
-   * artifacts. The default is false.
+   * Returns true if zoom blur is allowed. In tiled rendering mode, if the zoomScale changes and
+   * cached images at other zoom levels are available, the display list will use those caches to
+   * render first, then gradually update to the current zoomScale in later frames. Use
+   * setMaxTilesRefinedPerFrame() to control how many tiles are updated per frame. In the direct
+   * and partial rendering modes, shapes are drawn from their caches at the closest scale while the
+   * zoomScale is changing, and redrawn at the exact scale once it stops. This can improve zooming
+   * performance, but may cause temporary zoom blur artifacts. The default is false.
    */
   bool allowZoomBlur() const {
     return _allowZoomBlur;
   }
 
   /**
-   * Sets whether to allow zoom blur in tiled rendering mode.
+   * Sets whether to allow zoom blur.
    */
   void setAllowZoomBlur(bool allow) {
     _allowZoomBlur = allow;
@@ -221,6 +225,45 @@ class DisplayList {
     _maxTilesRefinedPerFrame = count;
   }
 
+  /**
+   * Returns the maximum number of tiles that can be prefetched per frame in tiled rendering mode.
+   * This setting is ignored in other render modes. While the contentOffset keeps changing at the
+   * same zoomScale, the display list predicts where the viewport is heading and renders the tiles
+   * along that path into the unused tiles ahead of time, so they are ready when they scroll into
+   * view. The actual number of prefetched tiles also shrinks as the measured rendering time of each
+   * frame grows. Prefetched tiles that have not been displayed yet are the first to be reused. Set
+   * it to 0 to disable prefetching. The default is 4.
+   */
+  int maxTilesPrefetchedPerFrame() const {
+    return _maxTilesPrefetchedPerFrame;
+  }
+
+  /**
+   * Sets the maximum number of tiles that can be prefetched per frame in tiled rendering mode.
+   */
+  void setMaxTilesPrefetchedPerFrame(int count) {
+    _maxTilesPrefetchedPerFrame = count;
+  }
+
+  /**
+   * Returns true if tiles of inactive zoom levels are demoted instead of evicted in tiled rendering
+   * mode. This setting is ignored in other render modes. When enabled, up to a quarter of the tiles
+   * allowed by maxTileCount are set aside as a half-resolution atlas, which holds four demoted tiles
+   * in the space of one. Tiles of other zoom levels that would be reused are first copied there at
+   * half resolution, so they can still serve as fallbacks when allowZoomBlur is true, including
+   * when returning to their own zoom level. This keeps more zoom levels cached with the same
+   * memory, at the cost of blurrier fallbacks. The default is false.
+   */
+  bool demoteInactiveTiles() const {
+    return _demoteInactiveTiles;
+  }
+
+  /**
+   * Sets whether tiles of inactive zoom levels are demoted instead of evicted in tiled rendering
+   * mode.
+   */
+  void setDemoteInactiveTiles(bool value);
+
   /**
    * Sets whether to show dirty regions during rendering. When enabled, the dirty regions will be
    * highlighted in the rendered output. This is useful for debugging to visualize which parts of
@@ -235,12 +278,44 @@ class DisplayList {
   bool hasContentChanged() const;
 
   /**
-   * Renders the display list onto the given surface.
+   * Renders the display list onto the given surface and returns the regions of the surface that
+   * were modified, in device pixels. The returned regions can be passed to Window::present() to
+   * limit the area that is presented to the screen.
    * @param surface The surface to render the display list on.
    * @param autoClear If true, the surface will be cleared before rendering the display list.
    * Otherwise, the display list will be rendered over the existing content.
+   * @param bufferAge The number of frames since the current content of the surface was rendered by
+   * this display list, as reported by Window::getBufferAge(), or 0 if the content is undefined.
+   * If it is greater than 0 and autoClear is true, the partial render mode redraws only the regions
+   * changed since then directly onto the surface, without keeping an offscreen cache.
+   * Note: render() must not be called on a display list that has been committed with commit(),
+   * since commit() takes the dirty regions that render() relies on.
    */
-  void render(Surface* surface, bool autoClear = true);
+  std::vector<Rect> render(Surface* surface, bool autoClear = true, int bufferAge = 0);
+
+  /**
+   * Captures the current layer tree as an immutable DisplayFrame, along with the regions changed
+   * since the previous commit, and the current zoomScale and contentOffset. The frame can be passed
+   * to setFrame() of another DisplayList, which may render it on a different thread while this
+   * thread continues to mutate the layers. Each top-level layer is recorded separately, and only
+   * the ones overlapping the changed regions are recorded again, so the rendering side can skip the
+   * layers outside the regions it redraws. Layer caches that require a GPU context, such as
+   * rasterized layers and background styles, are not used in the committed frames.
+   * Note: commit() and render() are exclusive on the same display list, since both of them consume
+   * the dirty regions of the layer tree. Render the frames with another display list instead.
+   */
+  std::shared_ptr<DisplayFrame> commit();
+
+  /**
+   * Replaces the content of this display list with the given frame committed by another display
+   * list, and adopts its zoomScale and contentOffset. Only the dirty regions of the frame are
+   * redrawn in the following render() call. The dirty regions are relative to the previous
+   * commit, so if the frame does not directly follow the current one, for example when the
+   * rendering thread drops stale frames, the whole content is redrawn instead. Once a frame is
+   * set, the layers in the root() of this display list are no longer rendered. Set nullptr to
+   * render them again.
+   */
+  void setFrame(std::shared_ptr<DisplayFrame> frame);
 
  private:
   std::shared_ptr<RootLayer> _root = nullptr;
@@ -252,16 +327,31 @@ class DisplayList {
   int _maxTileCount = 0;
   bool _allowZoomBlur = false;
   int _maxTilesRefinedPerFrame = 5;
+  int _maxTilesPrefetchedPerFrame = 4;
+  bool _demoteInactiveTiles = false;
   bool _showDirtyRegions = false;
   bool _hasContentChanged = false;
   bool hasZoomBlurTiles = false;
+  bool hasZoomBlurShapes = false;
+  bool zoomScaleChanged = false;
   int64_t lastZoomScaleInt = 1000;
   Point lastContentOffset = {};
+  Point lastScrollDelta = {};
+  Point scrollVelocity = {};
+  int64_t averageFrameTime = 0;
+  int64_t averageTileTime = 0;
   int totalTileCount = 0;
   std::vector<std::shared_ptr<Surface>> surfaceCaches = {};
   std::unordered_map<int64_t, TileCache*> tileCaches = {};
   std::vector<std::shared_ptr<Tile>> emptyTiles = {};
+  int demotedTileSlots = 0;
+  int demotedSurfaceIndex = -1;
+  std::vector<std::shared_ptr<Tile>> emptyDemotedTiles = {};
   std::deque<std::vector<Rect>> lastDirtyRegions = {};
+  uint32_t lastSurfaceID = 0;
+  std::shared_ptr<DisplayFrame> frame = nullptr;
+  std::shared_ptr<DisplayFrame> lastCommittedFrame = nullptr;
+  std::deque<std::vector<Rect>> damageHistory = {};
 
   std::vector<Rect> renderDirect(Surface* surface, bool autoClear) const;
 
@@ -271,6 +361,11 @@ class DisplayList {
   std::vector<Rect> renderTiled(Surface* surface, bool autoClear,
                                 const std::vector<Rect>& dirtyRegions);
 
+  std::vector<Rect> renderBackBuffer(Surface* surface, const std::vector<Rect>& dirtyRegions,
+                                     int bufferAge);
+
+  void recordDamageRects(const Surface* surface, std::vector<Rect> damageRects);
+
   void checkTileCount(Surface* renderSurface);
 
   std::vector<DrawTask> invalidateTileCaches(const std::vector<Rect>& dirtyRegions);
@@ -281,6 +376,12 @@ class DisplayList {
   std::vector<DrawTask> collectScreenTasks(const Surface* surface,
                                            std::vector<DrawTask>* tileTasks);
 
+  void updateScrollVelocity(const Point& scrollDelta);
+
+  void prefetchTiles(const Surface* surface);
+
+  size_t getPrefetchTileCount() const;
+
   std::vector<std::pair<float, TileCache*>> getSortedTileCaches() const;
 
   std::vector<DrawTask> getFallbackDrawTasks(
@@ -295,6 +396,10 @@ class DisplayList {
 
   bool createEmptyTiles(const Surface* renderSurface);
 
+  bool createDemotedTiles(const Surface* renderSurface);
+
+  bool demoteTile(TileCache* tileCache, const Tile& tile, const Surface* renderSurface);
+
   int nextSurfaceTileCount(Context* context) const;
 
   int getMaxTileCountPerAtlas(Context* context) const;
@@ -309,7 +414,12 @@ class DisplayList {
 
   void resetCaches();
 
+  bool isOpaqueOver(const Rect& drawRect, const Matrix& viewMatrix) const;
+
   void drawRootLayer(Surface* surface, const Rect& drawRect, const Matrix& viewMatrix,
                      bool autoClear) const;
+
+  std::vector<DisplayFrame::LayerPicture> recordLayers(float zoomScale,
+                                                       const std::vector<Rect>& dirtyRegions) const;
 };
 }  // namespace tgfx
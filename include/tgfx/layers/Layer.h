@@ -29,8 +29,10 @@
 #include "tgfx/layers/layerstyles/LayerStyle.h"
 
 namespace tgfx {
+class BytesKey;
 class LayerContent;
 class RasterizedContent;
+class EffectCache;
 class DisplayList;
 class DrawArgs;
 class RegionTransformer;
@@ -517,6 +519,26 @@ class Layer : public std::enable_shared_from_this<Layer> {
    */
   virtual void onUpdateContent(LayerRecorder* recorder);
 
+  /**
+   * Called before the layer's contents are updated to describe everything that affects them, if
+   * content sharing is enabled by enableContentSharing(). Layers that return the same key share one
+   * recording instead of calling onUpdateContent() for each of them. Subclasses should only return
+   * true if the key fully determines the recorded contents. The default implementation returns
+   * false.
+   * @param contentKey The key to append the content properties to.
+   */
+  virtual bool onGetContentKey(BytesKey* contentKey) const;
+
+  /**
+   * Allows the layer to share its contents with other layers through onGetContentKey(). Sharing is
+   * disabled by default. It should only be enabled by the factory of the class that implements
+   * both onGetContentKey() and onUpdateContent(), so a subclass that overrides onUpdateContent()
+   * never picks up the recordings of its base class.
+   */
+  void enableContentSharing() {
+    bitFields.shareableContent = true;
+  }
+
   /**
    * Attaches a property to this layer.
    */
@@ -541,6 +563,12 @@ class Layer : public std::enable_shared_from_this<Layer> {
 
   void invalidate();
 
+  /**
+   * Drops the cached offscreen outputs of the layer's filters and layer styles. Called when one of
+   * their parameters changes.
+   */
+  void invalidateCache();
+
   Rect getBoundsInternal(const Matrix& coordinateMatrix, bool computeTightBounds);
 
   void onAttachToRoot(RootLayer* rootLayer);
@@ -564,6 +592,12 @@ class Layer : public std::enable_shared_from_this<Layer> {
   std::shared_ptr<Image> getRasterizedImage(const DrawArgs& args, float contentScale,
                                             Matrix* drawingMatrix);
 
+  EffectCache* getEffectCache(const DrawArgs& args, float contentScale);
+
+  bool canCacheEffects(const DrawArgs& args) const;
+
+  RasterizedContent* getFilteredContent(const DrawArgs& args, float contentScale);
+
   void drawLayer(const DrawArgs& args, Canvas* canvas, float alpha, BlendMode blendMode);
 
   void drawOffscreen(const DrawArgs& args, Canvas* canvas, float alpha, BlendMode blendMode);
@@ -587,6 +621,9 @@ class Layer : public std::enable_shared_from_this<Layer> {
   void drawLayerStyles(const DrawArgs& args, Canvas* canvas, float alpha,
                        const LayerStyleSource* source, LayerStylePosition position);
 
+  bool drawCachedLayerStyle(const DrawArgs& args, Canvas* canvas, float alpha,
+                            const LayerStyleSource* source, LayerStyle* layerStyle);
+
   bool getLayersUnderPointInternal(float x, float y, std::vector<std::shared_ptr<Layer>>* results);
 
   std::shared_ptr<MaskFilter> getMaskFilter(const DrawArgs& args, float scale);
@@ -599,6 +636,15 @@ class Layer : public std::enable_shared_from_this<Layer> {
                           std::shared_ptr<RegionTransformer> transformer = nullptr,
                           bool forceDirty = false);
 
+  bool canOffsetRenderBounds(const Matrix& renderMatrix) const;
+
+  void offsetRenderBounds(float dx, float dy);
+
+  void updateOpaqueBounds(const Matrix& renderMatrix, const LayerContent* content);
+
+  std::vector<bool> getOccludedChildren(const DrawArgs& args, const Matrix& matrix, float alpha,
+                                        const Layer* stopChild) const;
+
   void checkBackgroundStyles(const Matrix& renderMatrix);
 
   void updateBackgroundBounds(const Matrix& renderMatrix);
@@ -617,6 +663,8 @@ class Layer : public std::enable_shared_from_this<Layer> {
     bool allowsEdgeAntialiasing : 1;
     bool allowsGroupOpacity : 1;
     bool excludeChildEffectsInLayerStyle : 1;
+    bool untransformedBounds : 1;  // bounds were computed without an inherited transformer
+    bool shareableContent : 1;     // contents may be shared with layers of the same content key
     uint8_t blendMode : 5;
     uint8_t maskType : 2;
   } bitFields = {};
@@ -633,9 +681,12 @@ class Layer : public std::enable_shared_from_this<Layer> {
   std::vector<std::shared_ptr<LayerStyle>> _layerStyles = {};
   float _rasterizationScale = 0.0f;
   std::unique_ptr<RasterizedContent> rasterizedContent;
+  std::unique_ptr<EffectCache> effectCache;
   std::shared_ptr<LayerContent> layerContent = nullptr;
   Rect renderBounds = {};         // in global coordinates
   Rect* contentBounds = nullptr;  //  in global coordinates
+  Rect opaqueBounds = {};         // in global coordinates, fully covered by opaque pixels
+  Matrix lastRenderMatrix = {};   // the render matrix the bounds were computed with
 
   // if > 0, means the layer or any of its descendants has a background style
   float backgroundOutset = 0.f;
@@ -302,6 +302,8 @@ class ShapeLayer : public Layer {
 
   void onUpdateContent(LayerRecorder* recorder) override;
 
+  bool onGetContentKey(BytesKey* contentKey) const override;
+
  private:
   std::shared_ptr<Shape> _shape = nullptr;
   std::vector<std::shared_ptr<ShapeStyle>> _fillStyles = {};
@@ -316,6 +318,12 @@ class ShapeLayer : public Layer {
     bool lineDashAdaptive : 1;
     uint8_t strokeAlign : 2;
   } shapeBitFields = {};
+  std::shared_ptr<Shape> cachedStrokeShape = nullptr;
+
+  void invalidateGeometry();
+
+  static bool WriteStylesKey(const std::vector<std::shared_ptr<ShapeStyle>>& styles,
+                             BytesKey* contentKey);
 
   std::vector<Paint> createShapePaints(
       const std::vector<std::shared_ptr<ShapeStyle>>& styles) const;
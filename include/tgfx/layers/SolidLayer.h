@@ -102,6 +102,8 @@ class SolidLayer : public Layer {
 
   void onUpdateContent(LayerRecorder* recorder) override;
 
+  bool onGetContentKey(BytesKey* contentKey) const override;
+
  private:
   Color _color = {};
   float _width = 0;
@@ -138,6 +138,8 @@ class TextLayer : public Layer {
 
   void onUpdateContent(LayerRecorder* recorder) override;
 
+  bool onGetContentKey(BytesKey* contentKey) const override;
+
  private:
   std::string _text;
   Color _textColor = {};
@@ -146,6 +148,10 @@ class TextLayer : public Layer {
   float _height = 0;
   TextAlign _textAlign = TextAlign::Left;
   bool _autoWrap = false;
+  std::shared_ptr<TextBlob> textBlob = nullptr;
+
+  void invalidateLayout();
+  std::shared_ptr<TextBlob> buildTextBlob() const;
 
   static std::string PreprocessNewLines(const std::string& text);
   static std::vector<std::shared_ptr<GlyphInfo>> ShapeText(
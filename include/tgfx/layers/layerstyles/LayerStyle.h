@@ -174,5 +174,7 @@ class LayerStyle : public LayerProperty {
 
  private:
   BlendMode _blendMode = BlendMode::SrcOver;
+
+  friend class Layer;
 };
 }  // namespace tgfx
@@ -108,6 +108,7 @@ bool Atlas::activateNewPage() {
   if (proxy == nullptr) {
     return false;
   }
+  proxy->setResourceCategory(ResourceCategory::Atlas);
   textureProxies.push_back(std::move(proxy));
   return true;
 }
@@ -169,6 +170,9 @@ void Atlas::deactivateLastPage() {
   auto pageIndex = pages.size() - 1;
   pages.pop_back();
   textureProxies.pop_back();
+  // Dropping a page doesn't reset any plot, so bump the generation to invalidate the locators that
+  // callers resolved against it.
+  generationCounter->next();
   for (const auto& [key, cellLocator] : cellLocators) {
     if (cellLocator.atlasLocator.pageIndex() == pageIndex) {
       expiredKeys.insert(key);
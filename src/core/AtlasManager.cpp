@@ -100,7 +100,10 @@ void AtlasManager::releaseAll() {
   for (auto& atlas : atlases) {
     atlas = nullptr;
   }
+  // Invalidates the atlas locators cached outside of the atlases.
+  next();
 }
+
 AtlasToken AtlasManager::nextFlushToken() const {
   return atlasTokenTracker.nextToken();
 }
@@ -39,6 +39,15 @@ class AtlasGenerationCounter {
     return generation++;
   }
 
+  /**
+   * Returns the generation that the next call to next() will hand out. It changes whenever a plot
+   * is created or evicted, so callers can compare it against an earlier value to check whether any
+   * previously resolved atlas locator may have become stale.
+   */
+  uint64_t currentGeneration() const {
+    return generation;
+  }
+
  private:
   uint64_t generation = 1;
 };
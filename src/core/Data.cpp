@@ -18,10 +18,17 @@
 
 #include "tgfx/core/Data.h"
 #include <cstring>
+#include "core/utils/MappedFile.h"
 #include "tgfx/core/Stream.h"
 
 namespace tgfx {
 std::shared_ptr<Data> Data::MakeFromFile(const std::string& filePath) {
+  // Paths with a custom protocol are resolved by the registered StreamFactory instead.
+  if (filePath.find("://") == std::string::npos) {
+    if (auto data = MapFile(filePath, FileAccess::Sequential)) {
+      return data;
+    }
+  }
   auto stream = Stream::MakeFromFile(filePath);
   if (stream == nullptr) {
     return nullptr;
@@ -125,6 +125,12 @@ class AsyncDataSource : public DataSource<T> {
     Task::Run(task);
   }
 
+  /**
+   * Wraps a DataTask that has already been started.
+   */
+  explicit AsyncDataSource(std::shared_ptr<DataTask<T>> task) : task(std::move(task)) {
+  }
+
   ~AsyncDataSource() override {
     task->cancel();
   }
@@ -0,0 +1,113 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include "core/AtlasTypes.h"
+#include "tgfx/core/GlyphRun.h"
+#include "tgfx/core/Matrix.h"
+#include "tgfx/core/Stroke.h"
+
+namespace tgfx {
+/**
+ * AtlasQuad describes a glyph cell in an atlas page and where it lands in the local coordinate
+ * space of the glyph run.
+ */
+struct AtlasQuad {
+  /**
+   * The location of the cell in the atlas page.
+   */
+  Rect rect = {};
+
+  /**
+   * The matrix that maps the cell to the local coordinates of the glyph run, excluding the view
+   * matrix and the translation by the cell location.
+   */
+  Matrix matrix = {};
+
+  /**
+   * The index of the atlas page that holds the cell.
+   */
+  uint32_t pageIndex = 0;
+};
+
+/**
+ * DirectMaskRun keeps the resolved atlas quads of a single glyph run drawn as direct masks.
+ */
+struct DirectMaskRun {
+  MaskFormat maskFormat = MaskFormat::A8;
+
+  /**
+   * The quads of the glyphs found in the atlas, in drawing order.
+   */
+  std::vector<AtlasQuad> quads = {};
+
+  /**
+   * The distinct plots referenced by the quads, whose use tokens must be refreshed on every draw.
+   */
+  std::vector<PlotLocator> plots = {};
+
+  /**
+   * The glyphs that can't be drawn as direct masks and need to fall back to another method.
+   */
+  GlyphRun rejectedGlyphRun = {};
+};
+
+/**
+ * DirectMaskCache keeps the atlas quads of a GlyphRunList from the last time it was drawn as direct
+ * masks, so static text can skip the per-glyph atlas key hashing and lookups when it is redrawn.
+ * The quads stay valid as long as the text is drawn to the same context with the same scale and
+ * stroke, and the atlas generation hasn't changed, which means no plot has been evicted and no page
+ * has been added or removed since.
+ */
+class DirectMaskCache {
+ public:
+  DirectMaskCache(uint32_t contextID, float maxScale, const Stroke* stroke,
+                  uint64_t atlasGeneration)
+      : contextID(contextID), maxScale(maxScale), hasStroke(stroke != nullptr),
+        stroke(stroke ? *stroke : Stroke()), atlasGeneration(atlasGeneration) {
+  }
+
+  /**
+   * Returns true if the cached quads can be reused for the given draw parameters.
+   */
+  bool isValid(uint32_t currentContextID, float currentMaxScale, const Stroke* currentStroke,
+               uint64_t currentGeneration) const {
+    if (contextID != currentContextID || maxScale != currentMaxScale ||
+        atlasGeneration != currentGeneration || hasStroke != (currentStroke != nullptr)) {
+      return false;
+    }
+    return !hasStroke ||
+           (stroke.width == currentStroke->width && stroke.cap == currentStroke->cap &&
+            stroke.join == currentStroke->join && stroke.miterLimit == currentStroke->miterLimit);
+  }
+
+  /**
+   * The cached runs, one for each glyph run in the GlyphRunList.
+   */
+  std::vector<DirectMaskRun> runs = {};
+
+ private:
+  uint32_t contextID = 0;
+  float maxScale = 1.0f;
+  bool hasStroke = false;
+  Stroke stroke = {};
+  uint64_t atlasGeneration = 0;
+};
+}  // namespace tgfx
@@ -18,12 +18,14 @@
 
 #pragma once
 
+#include <memory>
 #include "core/utils/LazyBounds.h"
 #include "tgfx/core/GlyphRun.h"
 #include "tgfx/core/Stroke.h"
 
 namespace tgfx {
 class TextBlob;
+class DirectMaskCache;
 
 /**
  * GlyphRunList contains a list of glyph runs that can be drawn together. All glyph runs in a list
@@ -88,9 +90,25 @@ class GlyphRunList {
    */
   bool getPath(Path* path, const Matrix* matrix = nullptr) const;
 
+  /**
+   * Returns the atlas quads cached by the last direct mask draw of this list, or nullptr if there
+   * are none. The caller must check whether the cache is still valid before using it.
+   */
+  std::shared_ptr<DirectMaskCache> getDirectMaskCache() const {
+    return std::atomic_load(&directMaskCache);
+  }
+
+  /**
+   * Replaces the cached atlas quads of this list. Safe to call from any thread.
+   */
+  void setDirectMaskCache(std::shared_ptr<DirectMaskCache> cache) const {
+    std::atomic_store(&directMaskCache, std::move(cache));
+  }
+
  private:
   std::vector<GlyphRun> _glyphRuns = {};
   LazyBounds bounds = {};
+  mutable std::shared_ptr<DirectMaskCache> directMaskCache = nullptr;
 
   Rect computeConservativeBounds() const;
 };
@@ -23,6 +23,7 @@
 #include "core/utils/BlockBuffer.h"
 #include "core/utils/Log.h"
 #include "tgfx/core/Canvas.h"
+#include "tgfx/core/ColorFilter.h"
 #include "tgfx/core/Image.h"
 #include "utils/MathExtra.h"
 
@@ -46,6 +47,8 @@ Picture::~Picture() {
   records.clear();
   auto oldBounds = bounds.exchange(nullptr, std::memory_order_acq_rel);
   delete oldBounds;
+  auto oldOpaqueBounds = opaqueBounds.exchange(nullptr, std::memory_order_acq_rel);
+  delete oldOpaqueBounds;
 }
 
 Rect Picture::getBounds() const {
@@ -71,6 +74,192 @@ Rect Picture::getTightBounds(const Matrix* matrix) const {
   return context.getBounds();
 }
 
+/**
+ * Returns true if the fill paints every covered pixel with alpha 1 and either keeps or replaces the
+ * destination, so nothing beneath the covered area shows through.
+ */
+static bool IsOpaqueFill(const Fill& fill) {
+  if (fill.blendMode != BlendMode::SrcOver && fill.blendMode != BlendMode::Src) {
+    return false;
+  }
+  if (fill.color.alpha != 1.0f || fill.maskFilter) {
+    return false;
+  }
+  if (fill.shader && !fill.shader->isOpaque()) {
+    return false;
+  }
+  return !fill.colorFilter || fill.colorFilter->isAlphaUnchanged();
+}
+
+/**
+ * Returns true if the given draw record may lower the alpha of the pixels it touches, for example
+ * a clear or a DstOut draw that punches a hole into the content drawn before it.
+ */
+static bool CanLowerAlpha(const Record* record, const Fill& fill) {
+  switch (fill.blendMode) {
+    case BlendMode::Dst:
+    case BlendMode::SrcOver:
+    case BlendMode::DstOver:
+    case BlendMode::SrcATop:
+    case BlendMode::PlusLighter:
+      return false;
+    case BlendMode::Src:
+      // Images, glyphs and nested pictures may carry their own translucent pixels.
+      return record->type() > RecordType::DrawShape || !IsOpaqueFill(fill);
+    case BlendMode::Clear:
+    case BlendMode::SrcIn:
+    case BlendMode::DstIn:
+    case BlendMode::SrcOut:
+    case BlendMode::DstOut:
+    case BlendMode::DstATop:
+    case BlendMode::Xor:
+    case BlendMode::Modulate:
+      return true;
+    default:
+      // The remaining modes all compute the result alpha as Sa + Da - Sa * Da.
+      return false;
+  }
+}
+
+/**
+ * Returns the local rect that the given draw record covers entirely, or false if the record may
+ * leave gaps inside its bounds. DrawFill records are handled by the caller since they cover the
+ * whole clip.
+ */
+static bool GetCoveredRect(const Record* record, Rect* rect) {
+  switch (record->type()) {
+    case RecordType::DrawRect:
+      *rect = static_cast<const DrawRect*>(record)->rect;
+      return true;
+    case RecordType::DrawRRect: {
+      // Only the cross left between the rounded corners is fully covered, so take its larger arm.
+      auto& rRect = static_cast<const DrawRRect*>(record)->rRect;
+      auto horizontal = rRect.rect.makeInset(0, rRect.radii.y);
+      auto vertical = rRect.rect.makeInset(rRect.radii.x, 0);
+      *rect = horizontal.area() >= vertical.area() ? horizontal : vertical;
+      return !rect->isEmpty();
+    }
+    case RecordType::DrawPath: {
+      auto& path = static_cast<const DrawPath*>(record)->path;
+      return !path.isInverseFillType() && path.isRect(rect);
+    }
+    default:
+      return false;
+  }
+}
+
+static bool IsUnboundedDraw(const Record* record) {
+  switch (record->type()) {
+    case RecordType::DrawFill:
+      return true;
+    case RecordType::DrawPath:
+      return static_cast<const DrawPath*>(record)->path.isInverseFillType();
+    case RecordType::DrawShape:
+      return static_cast<const DrawShape*>(record)->shape->isInverseFillType();
+    case RecordType::DrawPicture:
+      return static_cast<const DrawPicture*>(record)->picture->hasUnboundedFill();
+    case RecordType::DrawLayer:
+      return static_cast<const DrawLayer*>(record)->picture->hasUnboundedFill();
+    default:
+      return false;
+  }
+}
+
+/**
+ * Computes the device bounds the given draw record may touch. Returns false if they are unbounded.
+ */
+static bool GetDrawBounds(const Record* record, PlaybackContext* playback, Rect* bounds) {
+  auto& clip = playback->state().clip;
+  if (IsUnboundedDraw(record)) {
+    if (clip.isInverseFillType()) {
+      return false;
+    }
+    *bounds = clip.getBounds();
+    return true;
+  }
+  MeasureContext context(false);
+  record->playback(&context, playback);
+  *bounds = context.getBounds();
+  return true;
+}
+
+/**
+ * Returns the largest part of the rect left outside the hole.
+ */
+static Rect SubtractRect(const Rect& rect, const Rect& hole) {
+  if (!Rect::Intersects(rect, hole)) {
+    return rect;
+  }
+  Rect pieces[] = {Rect::MakeLTRB(rect.left, rect.top, rect.right, hole.top),
+                   Rect::MakeLTRB(rect.left, hole.bottom, rect.right, rect.bottom),
+                   Rect::MakeLTRB(rect.left, rect.top, hole.left, rect.bottom),
+                   Rect::MakeLTRB(hole.right, rect.top, rect.right, rect.bottom)};
+  auto result = Rect::MakeEmpty();
+  for (auto& piece : pieces) {
+    if (!piece.isEmpty() && piece.area() > result.area()) {
+      result = piece;
+    }
+  }
+  return result;
+}
+
+Rect Picture::getOpaqueBounds() const {
+  if (auto cachedBounds = opaqueBounds.load(std::memory_order_acquire)) {
+    return *cachedBounds;
+  }
+  PlaybackContext playback = {};
+  auto result = Rect::MakeEmpty();
+  for (auto& record : records) {
+    if (record->type() < RecordType::DrawFill) {
+      record->playback(nullptr, &playback);
+      continue;
+    }
+    auto& fill = playback.fill();
+    if (CanLowerAlpha(record.get(), fill)) {
+      // Anything drawn later may punch a hole into the opaque area found so far.
+      Rect bounds = {};
+      if (!GetDrawBounds(record.get(), &playback, &bounds)) {
+        result.setEmpty();
+      } else if (!result.isEmpty()) {
+        result = SubtractRect(result, bounds);
+      }
+      continue;
+    }
+    auto& state = playback.state();
+    if (playback.stroke() != nullptr || !IsOpaqueFill(fill) || !state.matrix.rectStaysRect()) {
+      continue;
+    }
+    auto wideOpen = state.clip.isEmpty() && state.clip.isInverseFillType();
+    Rect clipRect = {};
+    if (!wideOpen && (state.clip.isInverseFillType() || !state.clip.isRect(&clipRect))) {
+      continue;
+    }
+    Rect rect = {};
+    if (record->type() == RecordType::DrawFill) {
+      if (wideOpen) {
+        continue;
+      }
+      rect = clipRect;
+    } else if (GetCoveredRect(record.get(), &rect)) {
+      state.matrix.mapRect(&rect);
+      if (!wideOpen && !rect.intersect(clipRect)) {
+        continue;
+      }
+    } else {
+      continue;
+    }
+    if (rect.area() > result.area()) {
+      result = rect;
+    }
+  }
+  auto newBounds = new Rect(result);
+  Rect* oldBounds = nullptr;
+  if (!opaqueBounds.compare_exchange_strong(oldBounds, newBounds, std::memory_order_acq_rel)) {
+    delete newBounds;
+  }
+  return result;
+}
+
 bool Picture::hitTestPoint(float localX, float localY, bool shapeHitTest) const {
   PlaybackContext playbackContext = {};
   HitTestContext hitTestContext(localX, localY, shapeHitTest);
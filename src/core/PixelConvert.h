@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+
+namespace tgfx {
+/**
+ * Converts count 4-byte pixels between RGBA_8888 and BGRA_8888. If swapRB is true, the red and
+ * blue channels are swapped. If forceOpaque is true, the alpha channel is set to 255. If
+ * premultiply is true, the color channels are multiplied by the alpha channel. The src and dst
+ * may point to the same memory. Uses SIMD instructions when available.
+ */
+void Convert8888Row(const uint8_t* src, uint8_t* dst, int count, bool swapRB, bool forceOpaque,
+                    bool premultiply);
+
+/**
+ * Divides the color channels of count premultiplied 4-byte pixels by their alpha channel, swapping
+ * the red and blue channels if swapRB is true. The results match skcms_Transform(). Uses SIMD
+ * instructions when available.
+ */
+void Unpremultiply8888Row(const uint8_t* src, uint8_t* dst, int count, bool swapRB);
+
+/**
+ * Copies the alpha channel of count 4-byte pixels into a row of ALPHA_8 pixels. Uses SIMD
+ * instructions when available.
+ */
+void ExtractAlphaRow(const uint8_t* src, uint8_t* dst, int count);
+
+/**
+ * Expands count ALPHA_8 pixels into 4-byte pixels with zero color channels. Uses SIMD
+ * instructions when available.
+ */
+void ExpandAlphaRow(const uint8_t* src, uint8_t* dst, int count);
+
+/**
+ * Expands count Gray_8 pixels into opaque 4-byte pixels. Uses SIMD instructions when available.
+ */
+void ExpandGrayRow(const uint8_t* src, uint8_t* dst, int count);
+
+/**
+ * Expands count RGB_565 pixels into opaque RGBA_8888 pixels, or BGRA_8888 pixels if swapRB is
+ * true. Each channel is rounded to the nearest 8-bit value. Uses SIMD instructions when available.
+ */
+void Expand565Row(const uint16_t* src, uint8_t* dst, int count, bool swapRB);
+}  // namespace tgfx
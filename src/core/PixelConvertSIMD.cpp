@@ -0,0 +1,302 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "core/PixelConvert.h"
+// First undef to prevent error when re-included.
+#undef HWY_TARGET_INCLUDE
+// For dynamic dispatch, specify the name of the current file (unfortunately
+// __FILE__ is not reliable) so that foreach_target.h can re-include it.
+#define HWY_TARGET_INCLUDE "core/PixelConvertSIMD.cpp"
+// Generates code for each enabled target by re-including this source file.
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// Must come after foreach_target.h to avoid redefinition errors.
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace tgfx {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+// Returns round(color * alpha / 255) without a division.
+static uint8_t PremultiplyByte(uint8_t color, uint8_t alpha) {
+  auto value = static_cast<uint32_t>(color) * alpha + 128;
+  return static_cast<uint8_t>((value + (value >> 8)) >> 8);
+}
+
+// Follows the float math of skcms_Transform() so both paths produce the same bytes.
+static uint8_t UnpremultiplyByte(uint8_t color, float scale) {
+  auto value = static_cast<float>(color) * (1.0f / 255.0f) * scale;
+  value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint8_t>(value * 255.0f + 0.5f);
+}
+
+static float UnpremultiplyScale(uint8_t alpha) {
+  auto value = static_cast<float>(alpha) * (1.0f / 255.0f);
+  return value > 0.0f ? 1.0f / value : 0.0f;
+}
+
+// Returns round(value * 255 / 31) and round(value * 255 / 63) for 5-bit and 6-bit channels.
+static uint8_t Expand5Bits(uint32_t value) {
+  return static_cast<uint8_t>((value * 527 + 23) >> 6);
+}
+
+static uint8_t Expand6Bits(uint32_t value) {
+  return static_cast<uint8_t>((value * 259 + 33) >> 6);
+}
+
+void Convert8888RowHWYImpl(const uint8_t* src, uint8_t* dst, int count, bool swapRB,
+                           bool forceOpaque, bool premultiply) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(uint16_t) d16;
+  const hn::Rebind<uint8_t, decltype(d16)> d8;
+  auto opaque = hn::Set(d8, 255);
+  auto half = hn::Set(d16, 128);
+  auto lanes = hn::Lanes(d8);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    hn::Vec<decltype(d8)> r, g, b, a;
+    hn::LoadInterleaved4(d8, src + i * 4, r, g, b, a);
+    if (forceOpaque) {
+      a = opaque;
+    }
+    if (premultiply) {
+      auto alpha = hn::PromoteTo(d16, a);
+      auto multiply = [&](hn::Vec<decltype(d8)> color) {
+        auto value = hn::Add(hn::Mul(hn::PromoteTo(d16, color), alpha), half);
+        return hn::DemoteTo(d8, hn::ShiftRight<8>(hn::Add(value, hn::ShiftRight<8>(value))));
+      };
+      r = multiply(r);
+      g = multiply(g);
+      b = multiply(b);
+    }
+    if (swapRB) {
+      hn::StoreInterleaved4(b, g, r, a, d8, dst + i * 4);
+    } else {
+      hn::StoreInterleaved4(r, g, b, a, d8, dst + i * 4);
+    }
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    auto pixel = src + i * 4;
+    uint8_t r = pixel[0];
+    uint8_t g = pixel[1];
+    uint8_t b = pixel[2];
+    uint8_t a = forceOpaque ? 255 : pixel[3];
+    if (premultiply) {
+      r = PremultiplyByte(r, a);
+      g = PremultiplyByte(g, a);
+      b = PremultiplyByte(b, a);
+    }
+    auto out = dst + i * 4;
+    out[0] = swapRB ? b : r;
+    out[1] = g;
+    out[2] = swapRB ? r : b;
+    out[3] = a;
+  }
+}
+
+void Unpremultiply8888RowHWYImpl(const uint8_t* src, uint8_t* dst, int count, bool swapRB) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(float) d;
+  const hn::RebindToSigned<decltype(d)> di;
+  const hn::Rebind<uint8_t, decltype(d)> d8;
+  auto zero = hn::Zero(d);
+  auto one = hn::Set(d, 1.0f);
+  auto inv255 = hn::Set(d, 1.0f / 255.0f);
+  auto scale255 = hn::Set(d, 255.0f);
+  auto half = hn::Set(d, 0.5f);
+  auto lanes = hn::Lanes(d8);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    hn::Vec<decltype(d8)> r, g, b, a;
+    hn::LoadInterleaved4(d8, src + i * 4, r, g, b, a);
+    auto alpha = hn::Mul(hn::ConvertTo(d, hn::PromoteTo(di, a)), inv255);
+    auto scale = hn::IfThenElseZero(hn::Gt(alpha, zero), hn::Div(one, alpha));
+    auto divide = [&](hn::Vec<decltype(d8)> color) {
+      auto value = hn::Mul(hn::Mul(hn::ConvertTo(d, hn::PromoteTo(di, color)), inv255), scale);
+      value = hn::Min(hn::Max(value, zero), one);
+      return hn::DemoteTo(d8, hn::ConvertTo(di, hn::Add(hn::Mul(value, scale255), half)));
+    };
+    r = divide(r);
+    g = divide(g);
+    b = divide(b);
+    if (swapRB) {
+      hn::StoreInterleaved4(b, g, r, a, d8, dst + i * 4);
+    } else {
+      hn::StoreInterleaved4(r, g, b, a, d8, dst + i * 4);
+    }
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    auto pixel = src + i * 4;
+    auto a = pixel[3];
+    auto scale = UnpremultiplyScale(a);
+    auto r = UnpremultiplyByte(pixel[0], scale);
+    auto g = UnpremultiplyByte(pixel[1], scale);
+    auto b = UnpremultiplyByte(pixel[2], scale);
+    auto out = dst + i * 4;
+    out[0] = swapRB ? b : r;
+    out[1] = g;
+    out[2] = swapRB ? r : b;
+    out[3] = a;
+  }
+}
+
+void ExtractAlphaRowHWYImpl(const uint8_t* src, uint8_t* dst, int count) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(uint8_t) d8;
+  auto lanes = hn::Lanes(d8);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    hn::Vec<decltype(d8)> r, g, b, a;
+    hn::LoadInterleaved4(d8, src + i * 4, r, g, b, a);
+    hn::StoreU(a, d8, dst + i);
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    dst[i] = src[i * 4 + 3];
+  }
+}
+
+void ExpandAlphaRowHWYImpl(const uint8_t* src, uint8_t* dst, int count) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(uint8_t) d8;
+  auto zero = hn::Zero(d8);
+  auto lanes = hn::Lanes(d8);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    hn::StoreInterleaved4(zero, zero, zero, hn::LoadU(d8, src + i), d8, dst + i * 4);
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    auto out = dst + i * 4;
+    out[0] = out[1] = out[2] = 0;
+    out[3] = src[i];
+  }
+}
+
+void ExpandGrayRowHWYImpl(const uint8_t* src, uint8_t* dst, int count) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(uint8_t) d8;
+  auto opaque = hn::Set(d8, 255);
+  auto lanes = hn::Lanes(d8);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    auto gray = hn::LoadU(d8, src + i);
+    hn::StoreInterleaved4(gray, gray, gray, opaque, d8, dst + i * 4);
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    auto out = dst + i * 4;
+    out[0] = out[1] = out[2] = src[i];
+    out[3] = 255;
+  }
+}
+
+void Expand565RowHWYImpl(const uint16_t* src, uint8_t* dst, int count, bool swapRB) {
+  std::size_t size = static_cast<size_t>(count);
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(uint16_t) d16;
+  const hn::Rebind<uint8_t, decltype(d16)> d8;
+  auto opaque = hn::Set(d8, 255);
+  auto mask5 = hn::Set(d16, 31);
+  auto mask6 = hn::Set(d16, 63);
+  auto lanes = hn::Lanes(d16);
+  vecSize = size - size % lanes;
+  for (std::size_t i = 0; i < vecSize; i += lanes) {
+    auto pixels = hn::LoadU(d16, src + i);
+    auto r5 = hn::ShiftRight<11>(pixels);
+    auto g6 = hn::And(hn::ShiftRight<5>(pixels), mask6);
+    auto b5 = hn::And(pixels, mask5);
+    auto r = hn::DemoteTo(
+        d8, hn::ShiftRight<6>(hn::Add(hn::Mul(r5, hn::Set(d16, 527)), hn::Set(d16, 23))));
+    auto g = hn::DemoteTo(
+        d8, hn::ShiftRight<6>(hn::Add(hn::Mul(g6, hn::Set(d16, 259)), hn::Set(d16, 33))));
+    auto b = hn::DemoteTo(
+        d8, hn::ShiftRight<6>(hn::Add(hn::Mul(b5, hn::Set(d16, 527)), hn::Set(d16, 23))));
+    if (swapRB) {
+      hn::StoreInterleaved4(b, g, r, opaque, d8, dst + i * 4);
+    } else {
+      hn::StoreInterleaved4(r, g, b, opaque, d8, dst + i * 4);
+    }
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    uint32_t pixel = src[i];
+    auto r = Expand5Bits(pixel >> 11);
+    auto g = Expand6Bits((pixel >> 5) & 63);
+    auto b = Expand5Bits(pixel & 31);
+    auto out = dst + i * 4;
+    out[0] = swapRB ? b : r;
+    out[1] = g;
+    out[2] = swapRB ? r : b;
+    out[3] = 255;
+  }
+}
+}  // namespace HWY_NAMESPACE
+}  // namespace tgfx
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace tgfx {
+HWY_EXPORT(Convert8888RowHWYImpl);
+HWY_EXPORT(Unpremultiply8888RowHWYImpl);
+HWY_EXPORT(ExtractAlphaRowHWYImpl);
+HWY_EXPORT(ExpandAlphaRowHWYImpl);
+HWY_EXPORT(ExpandGrayRowHWYImpl);
+HWY_EXPORT(Expand565RowHWYImpl);
+
+void Convert8888Row(const uint8_t* src, uint8_t* dst, int count, bool swapRB, bool forceOpaque,
+                    bool premultiply) {
+  return HWY_DYNAMIC_DISPATCH(Convert8888RowHWYImpl)(src, dst, count, swapRB, forceOpaque,
+                                                     premultiply);
+}
+
+void Unpremultiply8888Row(const uint8_t* src, uint8_t* dst, int count, bool swapRB) {
+  return HWY_DYNAMIC_DISPATCH(Unpremultiply8888RowHWYImpl)(src, dst, count, swapRB);
+}
+
+void ExtractAlphaRow(const uint8_t* src, uint8_t* dst, int count) {
+  return HWY_DYNAMIC_DISPATCH(ExtractAlphaRowHWYImpl)(src, dst, count);
+}
+
+void ExpandAlphaRow(const uint8_t* src, uint8_t* dst, int count) {
+  return HWY_DYNAMIC_DISPATCH(ExpandAlphaRowHWYImpl)(src, dst, count);
+}
+
+void ExpandGrayRow(const uint8_t* src, uint8_t* dst, int count) {
+  return HWY_DYNAMIC_DISPATCH(ExpandGrayRowHWYImpl)(src, dst, count);
+}
+
+void Expand565Row(const uint16_t* src, uint8_t* dst, int count, bool swapRB) {
+  return HWY_DYNAMIC_DISPATCH(Expand565RowHWYImpl)(src, dst, count, swapRB);
+}
+}  // namespace tgfx
+#endif
@@ -17,8 +17,11 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "tgfx/core/Pixmap.h"
+#include <functional>
 #include <unordered_map>
+#include "core/PixelConvert.h"
 #include "core/PixelRef.h"
+#include "core/utils/RowBandTasks.h"
 #include "skcms.h"
 
 namespace tgfx {
@@ -60,6 +63,82 @@ static const std::unordered_map<AlphaType, gfx::skcms_AlphaFormat> AlphaMapper{
     {AlphaType::Opaque, gfx::skcms_AlphaFormat::skcms_AlphaFormat_Opaque},
 };
 
+using RowConverter = std::function<void(const void* src, void* dst, int count)>;
+
+static bool Is8888(ColorType colorType) {
+  return colorType == ColorType::RGBA_8888 || colorType == ColorType::BGRA_8888;
+}
+
+/**
+ * Returns a SIMD row converter for the common conversions that need no color space math, or
+ * nullptr if the conversion should go through skcms_Transform().
+ */
+static RowConverter GetRowConverter(const ImageInfo& srcInfo, const ImageInfo& dstInfo) {
+  auto srcType = srcInfo.colorType();
+  auto dstType = dstInfo.colorType();
+  auto srcAlpha = srcInfo.alphaType();
+  auto dstAlpha = dstInfo.alphaType();
+  if (srcType == ColorType::ALPHA_8 && dstType == ColorType::ALPHA_8) {
+    return [](const void* src, void* dst, int count) {
+      memcpy(dst, src, static_cast<size_t>(count));
+    };
+  }
+  if (Is8888(srcType) && dstType == ColorType::ALPHA_8) {
+    if (srcAlpha == AlphaType::Opaque) {
+      return nullptr;
+    }
+    return [](const void* src, void* dst, int count) {
+      ExtractAlphaRow(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count);
+    };
+  }
+  if (!Is8888(dstType)) {
+    return nullptr;
+  }
+  bool swapRB = dstType == ColorType::BGRA_8888;
+  if (srcType == ColorType::RGB_565) {
+    return [swapRB](const void* src, void* dst, int count) {
+      Expand565Row(static_cast<const uint16_t*>(src), static_cast<uint8_t*>(dst), count, swapRB);
+    };
+  }
+  if (srcType == ColorType::Gray_8) {
+    return [](const void* src, void* dst, int count) {
+      ExpandGrayRow(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count);
+    };
+  }
+  if (srcType == ColorType::ALPHA_8) {
+    if (srcAlpha == AlphaType::Opaque || dstAlpha == AlphaType::Opaque) {
+      return nullptr;
+    }
+    return [](const void* src, void* dst, int count) {
+      ExpandAlphaRow(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count);
+    };
+  }
+  if (!Is8888(srcType)) {
+    return nullptr;
+  }
+  swapRB = srcType != dstType;
+  if (srcAlpha == AlphaType::Opaque || dstAlpha == AlphaType::Opaque) {
+    if (srcAlpha != AlphaType::Opaque) {
+      return nullptr;
+    }
+    return [swapRB](const void* src, void* dst, int count) {
+      Convert8888Row(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count, swapRB,
+                     true, false);
+    };
+  }
+  if (srcAlpha == AlphaType::Premultiplied && dstAlpha == AlphaType::Unpremultiplied) {
+    return [swapRB](const void* src, void* dst, int count) {
+      Unpremultiply8888Row(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count,
+                           swapRB);
+    };
+  }
+  bool premultiply = srcAlpha == AlphaType::Unpremultiplied && dstAlpha == AlphaType::Premultiplied;
+  return [swapRB, premultiply](const void* src, void* dst, int count) {
+    Convert8888Row(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst), count, swapRB,
+                   false, premultiply);
+  };
+}
+
 static void ConvertPixels(const ImageInfo& srcInfo, const void* srcPixels, const ImageInfo& dstInfo,
                           void* dstPixels) {
   if (srcInfo.colorType() == dstInfo.colorType() && srcInfo.alphaType() == dstInfo.alphaType()) {
@@ -67,18 +146,28 @@ static void ConvertPixels(const ImageInfo& srcInfo, const void* srcPixels, const
                    dstInfo.minRowBytes(), static_cast<size_t>(dstInfo.height()));
     return;
   }
-  auto srcFormat = ColorMapper.at(srcInfo.colorType());
-  auto srcAlpha = AlphaMapper.at(srcInfo.alphaType());
-  auto dstFormat = ColorMapper.at(dstInfo.colorType());
-  auto dstAlpha = AlphaMapper.at(dstInfo.alphaType());
   auto width = dstInfo.width();
-  auto height = dstInfo.height();
-  for (int i = 0; i < height; i++) {
-    gfx::skcms_Transform(srcPixels, srcFormat, srcAlpha, nullptr, dstPixels, dstFormat, dstAlpha,
-                         nullptr, static_cast<size_t>(width));
-    dstPixels = AddOffset(dstPixels, dstInfo.rowBytes());
-    srcPixels = AddOffset(srcPixels, srcInfo.rowBytes());
+  auto converter = GetRowConverter(srcInfo, dstInfo);
+  if (converter == nullptr) {
+    auto srcFormat = ColorMapper.at(srcInfo.colorType());
+    auto srcAlpha = AlphaMapper.at(srcInfo.alphaType());
+    auto dstFormat = ColorMapper.at(dstInfo.colorType());
+    auto dstAlpha = AlphaMapper.at(dstInfo.alphaType());
+    converter = [=](const void* src, void* dst, int count) {
+      gfx::skcms_Transform(src, srcFormat, srcAlpha, nullptr, dst, dstFormat, dstAlpha, nullptr,
+                           static_cast<size_t>(count));
+    };
   }
+  // Rows are independent, so large conversions are split into bands across the thread pool.
+  RunInRowBands(0, dstInfo.height(), width, [&](int top, int bottom) {
+    auto src = AddOffset(srcPixels, srcInfo.rowBytes() * static_cast<size_t>(top));
+    auto dst = AddOffset(dstPixels, dstInfo.rowBytes() * static_cast<size_t>(top));
+    for (int i = top; i < bottom; i++) {
+      converter(src, dst, width);
+      dst = AddOffset(dst, dstInfo.rowBytes());
+      src = AddOffset(src, srcInfo.rowBytes());
+    }
+  });
 }
 
 Pixmap::Pixmap(const ImageInfo& info, const void* pixels) : _info(info), _pixels(pixels) {
@@ -18,6 +18,7 @@
 
 #include "tgfx/core/Recorder.h"
 #include "core/RecordingContext.h"
+#include "core/utils/Profiling.h"
 
 namespace tgfx {
 Recorder::~Recorder() {
@@ -45,6 +46,7 @@ std::shared_ptr<Picture> Recorder::finishRecordingAsPicture() {
   if (!activelyRecording) {
     return nullptr;
   }
+  OperateMark("Recorder::finishRecordingAsPicture");
   activelyRecording = false;
   return recordingContext->finishRecordingAsPicture(optimizeMemory);
 }
@@ -22,8 +22,9 @@
 #include "utils/Log.h"
 
 namespace tgfx {
-ShapeRasterizer::ShapeRasterizer(int width, int height, std::shared_ptr<Shape> shape, AAType aaType)
-    : width(width), height(height), shape(std::move(shape)), aaType(aaType) {
+ShapeRasterizer::ShapeRasterizer(int width, int height, std::shared_ptr<Shape> shape, AAType aaType,
+                                 bool maskOnly)
+    : width(width), height(height), shape(std::move(shape)), aaType(aaType), maskOnly(maskOnly) {
 }
 
 bool ShapeRasterizer::asyncSupport() const {
@@ -40,7 +41,7 @@ std::shared_ptr<ShapeBuffer> ShapeRasterizer::getData() const {
     finalPath.reset();
     finalPath.addRect(Rect::MakeWH(width, height));
   }
-  if (PathTriangulator::ShouldTriangulatePath(finalPath)) {
+  if (!maskOnly && PathTriangulator::ShouldTriangulatePath(finalPath)) {
     auto triangles = makeTriangles(finalPath);
     if (triangles == nullptr) {
       return nullptr;
@@ -39,9 +39,12 @@ struct ShapeBuffer {
 class ShapeRasterizer : public DataSource<ShapeBuffer> {
  public:
   /**
-   * Creates a ShapeRasterizer from a shape.
+   * Creates a ShapeRasterizer from a shape. If maskOnly is true, the shape is always rasterized
+   * into an image buffer clipped to the width and height, which is required when the rasterized
+   * result only covers a tile of the shape.
    */
-  ShapeRasterizer(int width, int height, std::shared_ptr<Shape> shape, AAType aaType);
+  ShapeRasterizer(int width, int height, std::shared_ptr<Shape> shape, AAType aaType,
+                  bool maskOnly = false);
 
   /**
    * Returns true if the ShapeRasterizer supports asynchronous decoding. If so, the getData()
@@ -63,6 +66,7 @@ class ShapeRasterizer : public DataSource<ShapeBuffer> {
   int height = 0;
   std::shared_ptr<Shape> shape = nullptr;
   AAType aaType = AAType::None;
+  bool maskOnly = false;
 
   std::shared_ptr<Data> makeTriangles(const Path& finalPath) const;
 
@@ -50,5 +50,7 @@ class BufferImage : public ResourceImage {
 
  private:
   std::shared_ptr<ImageBuffer> imageBuffer = nullptr;
+
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
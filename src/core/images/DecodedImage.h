@@ -59,5 +59,7 @@ class DecodedImage : public ResourceImage {
 
   DecodedImage(UniqueKey uniqueKey, int width, int height, bool alphaOnly,
                std::shared_ptr<DataSource<ImageBuffer>> source);
+
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
@@ -55,5 +55,7 @@ class GeneratorImage : public ResourceImage {
                                                    const UniqueKey& key) const override;
 
   std::shared_ptr<ImageGenerator> generator = nullptr;
+
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
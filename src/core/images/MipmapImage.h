@@ -60,5 +60,7 @@ class MipmapImage : public ResourceImage {
   std::shared_ptr<ResourceImage> source = nullptr;
 
   MipmapImage(UniqueKey uniqueKey, std::shared_ptr<ResourceImage> source);
+
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
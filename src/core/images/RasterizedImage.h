@@ -64,5 +64,7 @@ class RasterizedImage : public ResourceImage {
 
   RasterizedImage(UniqueKey uniqueKey, std::shared_ptr<Image> source, float rasterizationScale,
                   const SamplingOptions& sampling);
+
+  friend class RasterBuffer;
 };
 }  // namespace tgfx
@@ -0,0 +1,327 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RasterBlend.h"
+#include <algorithm>
+#include <cmath>
+
+namespace tgfx {
+static Color Scale(const Color& color, float factor) {
+  return {color.red * factor, color.green * factor, color.blue * factor, color.alpha * factor};
+}
+
+static Color Add(const Color& a, const Color& b) {
+  return {a.red + b.red, a.green + b.green, a.blue + b.blue, a.alpha + b.alpha};
+}
+
+static float Luminance(const float color[3]) {
+  return 0.3f * color[0] + 0.59f * color[1] + 0.11f * color[2];
+}
+
+static float MinComponent(const float color[3]) {
+  return std::min(std::min(color[0], color[1]), color[2]);
+}
+
+static float MaxComponent(const float color[3]) {
+  return std::max(std::max(color[0], color[1]), color[2]);
+}
+
+// Produces a color with the hue and saturation of hueSat, the luminosity of lumColor, and the
+// given alpha.
+static void SetLuminance(const float hueSat[3], float alpha, const float lumColor[3],
+                         float result[3]) {
+  float diff[3] = {lumColor[0] - hueSat[0], lumColor[1] - hueSat[1], lumColor[2] - hueSat[2]};
+  auto lum = Luminance(diff);
+  for (int i = 0; i < 3; i++) {
+    result[i] = hueSat[i] + lum;
+  }
+  auto outLum = Luminance(result);
+  auto minComp = MinComponent(result);
+  auto maxComp = MaxComponent(result);
+  if (minComp < 0.0f && outLum != minComp) {
+    for (int i = 0; i < 3; i++) {
+      result[i] = outLum + ((result[i] - outLum) * outLum) / (outLum - minComp);
+    }
+  }
+  if (maxComp > alpha && maxComp != outLum) {
+    for (int i = 0; i < 3; i++) {
+      result[i] = outLum + ((result[i] - outLum) * (alpha - outLum)) / (maxComp - outLum);
+    }
+  }
+}
+
+// Replaces the saturation of hueLum with the saturation of satColor, keeping its hue.
+static void SetSaturation(float hueLum[3], const float satColor[3]) {
+  auto sat = MaxComponent(satColor) - MinComponent(satColor);
+  int minIndex = 0;
+  int midIndex = 1;
+  int maxIndex = 2;
+  if (hueLum[0] <= hueLum[1]) {
+    if (hueLum[1] <= hueLum[2]) {
+      minIndex = 0, midIndex = 1, maxIndex = 2;
+    } else if (hueLum[0] <= hueLum[2]) {
+      minIndex = 0, midIndex = 2, maxIndex = 1;
+    } else {
+      minIndex = 2, midIndex = 0, maxIndex = 1;
+    }
+  } else if (hueLum[0] <= hueLum[2]) {
+    minIndex = 1, midIndex = 0, maxIndex = 2;
+  } else if (hueLum[1] <= hueLum[2]) {
+    minIndex = 1, midIndex = 2, maxIndex = 0;
+  } else {
+    minIndex = 2, midIndex = 1, maxIndex = 0;
+  }
+  auto minComp = hueLum[minIndex];
+  auto midComp = hueLum[midIndex];
+  auto maxComp = hueLum[maxIndex];
+  if (minComp < maxComp) {
+    hueLum[midIndex] = sat * (midComp - minComp) / (maxComp - minComp);
+    hueLum[maxIndex] = sat;
+  } else {
+    hueLum[midIndex] = 0.0f;
+    hueLum[maxIndex] = 0.0f;
+  }
+  hueLum[minIndex] = 0.0f;
+}
+
+static float HardLight(float s, float sa, float d, float da) {
+  float result = 0.0f;
+  if (2.0f * s < sa) {
+    result = 2.0f * s * d;
+  } else {
+    result = sa * da - 2.0f * (da - d) * (sa - s);
+  }
+  return result + s * (1.0f - da) + d * (1.0f - sa);
+}
+
+static float ColorDodge(float s, float sa, float d, float da) {
+  if (d == 0.0f) {
+    return s * (1.0f - da);
+  }
+  auto delta = sa - s;
+  if (delta == 0.0f) {
+    return sa * da + s * (1.0f - da) + d * (1.0f - sa);
+  }
+  delta = std::min(da, d * sa / delta);
+  return delta * sa + s * (1.0f - da) + d * (1.0f - sa);
+}
+
+static float ColorBurn(float s, float sa, float d, float da) {
+  if (da == d) {
+    return sa * da + s * (1.0f - da) + d * (1.0f - sa);
+  }
+  if (s == 0.0f) {
+    return d * (1.0f - sa);
+  }
+  auto delta = std::max(0.0f, da - (da - d) * sa / s);
+  return sa * delta + s * (1.0f - da) + d * (1.0f - sa);
+}
+
+// Caller should have already checked that dst alpha > 0.
+static float SoftLight(float s, float sa, float d, float da) {
+  if (2.0f * s <= sa) {
+    return (d * d * (sa - 2.0f * s)) / da + (1.0f - da) * s + d * (-sa + 2.0f * s + 1.0f);
+  }
+  if (4.0f * d <= da) {
+    auto dSqd = d * d;
+    auto dCub = dSqd * d;
+    auto daSqd = da * da;
+    auto daCub = daSqd * da;
+    return (daSqd * (s - d * (3.0f * sa - 6.0f * s - 1.0f)) + 12.0f * da * dSqd * (sa - 2.0f * s) -
+            16.0f * dCub * (sa - 2.0f * s) - daCub * s) /
+           daSqd;
+  }
+  return d * (sa - 2.0f * s + 1.0f) + s - sqrtf(da * d) * (sa - 2.0f * s) - da * s;
+}
+
+static Color BlendNonSeparable(BlendMode mode, const Color& src, const Color& dst) {
+  float s[3] = {src.red, src.green, src.blue};
+  float d[3] = {dst.red, dst.green, dst.blue};
+  auto sa = src.alpha;
+  auto da = dst.alpha;
+  float srcDa[3] = {s[0] * da, s[1] * da, s[2] * da};
+  float dstSa[3] = {d[0] * sa, d[1] * sa, d[2] * sa};
+  float result[3] = {};
+  switch (mode) {
+    case BlendMode::Hue:
+      SetSaturation(srcDa, dstSa);
+      SetLuminance(srcDa, sa * da, dstSa, result);
+      break;
+    case BlendMode::Saturation: {
+      float hueLum[3] = {dstSa[0], dstSa[1], dstSa[2]};
+      SetSaturation(hueLum, srcDa);
+      SetLuminance(hueLum, sa * da, dstSa, result);
+      break;
+    }
+    case BlendMode::Color:
+      SetLuminance(srcDa, sa * da, dstSa, result);
+      break;
+    default:
+      SetLuminance(dstSa, sa * da, srcDa, result);
+      break;
+  }
+  Color color = {};
+  color.red = result[0] + (1.0f - sa) * d[0] + (1.0f - da) * s[0];
+  color.green = result[1] + (1.0f - sa) * d[1] + (1.0f - da) * s[1];
+  color.blue = result[2] + (1.0f - sa) * d[2] + (1.0f - da) * s[2];
+  color.alpha = sa + (1.0f - sa) * da;
+  return color;
+}
+
+static Color BlendSeparable(BlendMode mode, const Color& src, const Color& dst) {
+  auto sa = src.alpha;
+  auto da = dst.alpha;
+  const float s[3] = {src.red, src.green, src.blue};
+  const float d[3] = {dst.red, dst.green, dst.blue};
+  float result[3] = {};
+  auto alpha = sa + (1.0f - sa) * da;
+  for (int i = 0; i < 3; i++) {
+    switch (mode) {
+      case BlendMode::Overlay:
+        // Overlay is Hard-Light with the src and dst reversed
+        result[i] = HardLight(d[i], da, s[i], sa);
+        break;
+      case BlendMode::Darken:
+        result[i] = std::min((1.0f - sa) * d[i] + s[i], (1.0f - da) * s[i] + d[i]);
+        break;
+      case BlendMode::Lighten:
+        result[i] = std::max((1.0f - sa) * d[i] + s[i], (1.0f - da) * s[i] + d[i]);
+        break;
+      case BlendMode::ColorDodge:
+        result[i] = ColorDodge(s[i], sa, d[i], da);
+        break;
+      case BlendMode::ColorBurn:
+        result[i] = ColorBurn(s[i], sa, d[i], da);
+        break;
+      case BlendMode::HardLight:
+        result[i] = HardLight(s[i], sa, d[i], da);
+        break;
+      case BlendMode::SoftLight:
+        if (da == 0.0f) {
+          return src;
+        }
+        result[i] = SoftLight(s[i], sa, d[i], da);
+        break;
+      case BlendMode::Difference:
+        result[i] = s[i] + d[i] - 2.0f * std::min(s[i] * da, d[i] * sa);
+        break;
+      case BlendMode::Exclusion:
+        result[i] = d[i] + s[i] - 2.0f * d[i] * s[i];
+        break;
+      case BlendMode::Multiply:
+        result[i] = (1.0f - sa) * d[i] + (1.0f - da) * s[i] + s[i] * d[i];
+        break;
+      case BlendMode::PlusDarker:
+        result[i] = alpha > 0.0f ? std::clamp(1.0f + s[i] + d[i] - da - sa, 0.0f, 1.0f) : 0.0f;
+        break;
+      default:
+        break;
+    }
+  }
+  return {result[0], result[1], result[2], alpha};
+}
+
+Color BlendColor(BlendMode mode, const Color& src, const Color& dst) {
+  auto sa = src.alpha;
+  auto da = dst.alpha;
+  switch (mode) {
+    case BlendMode::Clear:
+      return Color::Transparent();
+    case BlendMode::Src:
+      return src;
+    case BlendMode::Dst:
+      return dst;
+    case BlendMode::SrcOver:
+      return Add(src, Scale(dst, 1.0f - sa));
+    case BlendMode::DstOver:
+      return Add(dst, Scale(src, 1.0f - da));
+    case BlendMode::SrcIn:
+      return Scale(src, da);
+    case BlendMode::DstIn:
+      return Scale(dst, sa);
+    case BlendMode::SrcOut:
+      return Scale(src, 1.0f - da);
+    case BlendMode::DstOut:
+      return Scale(dst, 1.0f - sa);
+    case BlendMode::SrcATop:
+      return Add(Scale(src, da), Scale(dst, 1.0f - sa));
+    case BlendMode::DstATop:
+      return Add(Scale(dst, sa), Scale(src, 1.0f - da));
+    case BlendMode::Xor:
+      return Add(Scale(src, 1.0f - da), Scale(dst, 1.0f - sa));
+    case BlendMode::PlusLighter:
+      return {std::min(src.red + dst.red, 1.0f), std::min(src.green + dst.green, 1.0f),
+              std::min(src.blue + dst.blue, 1.0f), std::min(sa + da, 1.0f)};
+    case BlendMode::Modulate:
+      return {src.red * dst.red, src.green * dst.green, src.blue * dst.blue, sa * da};
+    case BlendMode::Screen:
+      return {src.red + dst.red - src.red * dst.red,
+              src.green + dst.green - src.green * dst.green,
+              src.blue + dst.blue - src.blue * dst.blue, sa + da - sa * da};
+    case BlendMode::Hue:
+    case BlendMode::Saturation:
+    case BlendMode::Color:
+    case BlendMode::Luminosity:
+      return BlendNonSeparable(mode, src, dst);
+    default:
+      return BlendSeparable(mode, src, dst);
+  }
+}
+
+static Color LoadPixel(const uint8_t* pixel) {
+  return {static_cast<float>(pixel[0]) / 255.0f, static_cast<float>(pixel[1]) / 255.0f,
+          static_cast<float>(pixel[2]) / 255.0f, static_cast<float>(pixel[3]) / 255.0f};
+}
+
+static uint8_t ToByte(float value) {
+  return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+void BlendSpan(BlendMode mode, Color* src, const uint8_t* coverage, uint8_t* dst, int count) {
+  if (mode == BlendMode::SrcOver) {
+    if (coverage != nullptr) {
+      for (int i = 0; i < count; i++) {
+        src[i] = Scale(src[i], static_cast<float>(coverage[i]) / 255.0f);
+      }
+    }
+    SrcOverSpan(src, dst, count);
+    return;
+  }
+  if (mode == BlendMode::Src && coverage == nullptr) {
+    StoreSpan(src, dst, count);
+    return;
+  }
+  for (int i = 0; i < count; i++) {
+    if (coverage != nullptr && coverage[i] == 0) {
+      continue;
+    }
+    auto pixel = dst + i * 4;
+    auto dstColor = LoadPixel(pixel);
+    auto result = BlendColor(mode, src[i], dstColor);
+    if (coverage != nullptr && coverage[i] != 255) {
+      auto factor = static_cast<float>(coverage[i]) / 255.0f;
+      result = Add(Scale(result, factor), Scale(dstColor, 1.0f - factor));
+    }
+    pixel[0] = ToByte(result.red);
+    pixel[1] = ToByte(result.green);
+    pixel[2] = ToByte(result.blue);
+    pixel[3] = ToByte(result.alpha);
+  }
+}
+}  // namespace tgfx
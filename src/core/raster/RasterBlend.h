@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <cstdint>
+#include "tgfx/core/BlendMode.h"
+#include "tgfx/core/Color.h"
+
+namespace tgfx {
+/**
+ * Returns the result of blending the premultiplied src color into the premultiplied dst color with
+ * the given blend mode. The math matches the fragment shaders generated by GLBlend.
+ */
+Color BlendColor(BlendMode mode, const Color& src, const Color& dst);
+
+/**
+ * Blends count premultiplied source colors into a row of premultiplied RGBA_8888 pixels. If the
+ * coverage is not nullptr, each source color is blended with its coverage value (0-255). The src
+ * colors may be modified in place.
+ */
+void BlendSpan(BlendMode mode, Color* src, const uint8_t* coverage, uint8_t* dst, int count);
+
+/**
+ * Blends count premultiplied source colors into a row of RGBA_8888 pixels using SrcOver. Uses SIMD
+ * instructions when available.
+ */
+void SrcOverSpan(const Color* src, uint8_t* dst, int count);
+
+/**
+ * Writes count premultiplied colors into a row of RGBA_8888 pixels, replacing the existing pixels.
+ * Uses SIMD instructions when available.
+ */
+void StoreSpan(const Color* src, uint8_t* dst, int count);
+}  // namespace tgfx
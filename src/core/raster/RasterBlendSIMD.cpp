@@ -0,0 +1,108 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "core/raster/RasterBlend.h"
+// First undef to prevent error when re-included.
+#undef HWY_TARGET_INCLUDE
+// For dynamic dispatch, specify the name of the current file (unfortunately
+// __FILE__ is not reliable) so that foreach_target.h can re-include it.
+#define HWY_TARGET_INCLUDE "core/raster/RasterBlendSIMD.cpp"
+// Generates code for each enabled target by re-including this source file.
+#include "hwy/foreach_target.h"  // IWYU pragma: keep
+
+// Must come after foreach_target.h to avoid redefinition errors.
+#include "hwy/highway.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace tgfx {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+static uint8_t ClampToByte(float value) {
+  value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint8_t>(value * 255.0f + 0.5f);
+}
+
+// Both colors and pixels are interleaved RGBA, so each 128-bit block of floats holds exactly one
+// pixel, which lets Broadcast<3> spread the alpha of every pixel across its own block.
+void SrcOverSpanHWYImpl(const Color* src, uint8_t* dst, int count) {
+  const auto* fsrc = reinterpret_cast<const float*>(src);
+  std::size_t size = static_cast<size_t>(count) * 4;
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(float) d;
+  const hn::RebindToSigned<decltype(d)> di;
+  const hn::Rebind<uint8_t, decltype(d)> du8;
+  auto one = hn::Set(d, 1.0f);
+  auto scale = hn::Set(d, 255.0f);
+  auto invScale = hn::Set(d, 1.0f / 255.0f);
+  vecSize = size - size % hn::Lanes(d);
+  for (std::size_t i = 0; i < vecSize; i += hn::Lanes(d)) {
+    auto srcVec = hn::LoadU(d, &fsrc[i]);
+    auto dstVec = hn::Mul(hn::ConvertTo(d, hn::PromoteTo(di, hn::LoadU(du8, &dst[i]))), invScale);
+    auto srcAlpha = hn::Broadcast<3>(srcVec);
+    auto res = hn::MulAdd(dstVec, hn::Sub(one, srcAlpha), srcVec);
+    res = hn::Min(hn::Max(res, hn::Zero(d)), one);
+    hn::StoreU(hn::DemoteTo(du8, hn::NearestInt(hn::Mul(res, scale))), du8, &dst[i]);
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i += 4) {
+    auto invAlpha = 1.0f - fsrc[i + 3];
+    for (std::size_t j = i; j < i + 4; j++) {
+      dst[j] = ClampToByte(fsrc[j] + static_cast<float>(dst[j]) / 255.0f * invAlpha);
+    }
+  }
+}
+
+void StoreSpanHWYImpl(const Color* src, uint8_t* dst, int count) {
+  const auto* fsrc = reinterpret_cast<const float*>(src);
+  std::size_t size = static_cast<size_t>(count) * 4;
+  std::size_t vecSize = 0;
+#if HWY_TARGET != HWY_SCALAR
+  const HWY_FULL(float) d;
+  const hn::Rebind<uint8_t, decltype(d)> du8;
+  auto one = hn::Set(d, 1.0f);
+  auto scale = hn::Set(d, 255.0f);
+  vecSize = size - size % hn::Lanes(d);
+  for (std::size_t i = 0; i < vecSize; i += hn::Lanes(d)) {
+    auto res = hn::Min(hn::Max(hn::LoadU(d, &fsrc[i]), hn::Zero(d)), one);
+    hn::StoreU(hn::DemoteTo(du8, hn::NearestInt(hn::Mul(res, scale))), du8, &dst[i]);
+  }
+#endif
+  for (std::size_t i = vecSize; i < size; i++) {
+    dst[i] = ClampToByte(fsrc[i]);
+  }
+}
+}  // namespace HWY_NAMESPACE
+}  // namespace tgfx
+HWY_AFTER_NAMESPACE();
+
+#if HWY_ONCE
+namespace tgfx {
+HWY_EXPORT(SrcOverSpanHWYImpl);
+HWY_EXPORT(StoreSpanHWYImpl);
+void SrcOverSpan(const Color* src, uint8_t* dst, int count) {
+  return HWY_DYNAMIC_DISPATCH(SrcOverSpanHWYImpl)(src, dst, count);
+}
+
+void StoreSpan(const Color* src, uint8_t* dst, int count) {
+  return HWY_DYNAMIC_DISPATCH(StoreSpanHWYImpl)(src, dst, count);
+}
+}  // namespace tgfx
+#endif
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RasterBuffer.h"
+#include "core/PixelBuffer.h"
+#include "core/images/BufferImage.h"
+#include "core/images/DecodedImage.h"
+#include "core/images/GeneratorImage.h"
+#include "core/images/MipmapImage.h"
+#include "core/images/PictureImage.h"
+#include "core/images/RasterizedImage.h"
+#include "core/images/SubsetImage.h"
+#include "core/raster/RasterContext.h"
+#include "core/utils/Types.h"
+#include "tgfx/core/ImageCodec.h"
+
+namespace tgfx {
+std::shared_ptr<RasterBuffer> RasterBuffer::Make(int width, int height, bool alphaOnly) {
+  auto info = ImageInfo::Make(width, height, alphaOnly ? ColorType::ALPHA_8 : ColorType::RGBA_8888,
+                              AlphaType::Premultiplied);
+  if (info.isEmpty()) {
+    return nullptr;
+  }
+  auto rasterBuffer = std::shared_ptr<RasterBuffer>(new RasterBuffer(info));
+  if (rasterBuffer->buffer.isEmpty()) {
+    return nullptr;
+  }
+  rasterBuffer->buffer.clear();
+  return rasterBuffer;
+}
+
+std::shared_ptr<RasterBuffer> RasterBuffer::MakeFrom(std::shared_ptr<ImageBuffer> imageBuffer) {
+  if (imageBuffer == nullptr || !imageBuffer->isPixelBuffer()) {
+    return nullptr;
+  }
+  auto pixelBuffer = std::static_pointer_cast<PixelBuffer>(imageBuffer);
+  auto result = RasterBuffer::Make(pixelBuffer->width(), pixelBuffer->height(),
+                                   pixelBuffer->isAlphaOnly());
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto pixels = pixelBuffer->lockPixels();
+  if (pixels == nullptr) {
+    return nullptr;
+  }
+  auto success = Pixmap(pixelBuffer->info(), pixels).readPixels(result->info(), result->row(0));
+  pixelBuffer->unlockPixels();
+  return success ? result : nullptr;
+}
+
+static std::shared_ptr<RasterBuffer> ReadCodec(const ImageCodec* codec) {
+  auto result = RasterBuffer::Make(codec->width(), codec->height(), codec->isAlphaOnly());
+  if (result == nullptr || !codec->readPixels(result->info(), result->row(0))) {
+    return nullptr;
+  }
+  return result;
+}
+
+static std::shared_ptr<RasterBuffer> ReadSubset(const SubsetImage* image) {
+  auto source = RasterBuffer::MakeFrom(image->source);
+  if (source == nullptr) {
+    return nullptr;
+  }
+  auto result = RasterBuffer::Make(image->width(), image->height(), source->isAlphaOnly());
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto x = static_cast<int>(image->bounds.left);
+  auto y = static_cast<int>(image->bounds.top);
+  if (!source->pixmap().readPixels(result->info(), result->row(0), x, y)) {
+    return nullptr;
+  }
+  return result;
+}
+
+static std::shared_ptr<RasterBuffer> ReadRasterized(const RasterizedImage* image,
+                                                    std::shared_ptr<Image> source, float scale,
+                                                    const SamplingOptions& sampling) {
+  auto result = RasterBuffer::Make(image->width(), image->height());
+  if (result == nullptr) {
+    return nullptr;
+  }
+  RasterContext context(result);
+  context.drawImage(std::move(source), sampling, MCState(Matrix::MakeScale(scale)),
+                    {Color::White(), BlendMode::Src});
+  return result;
+}
+
+static std::shared_ptr<RasterBuffer> ReadPicture(const PictureImage* image) {
+  auto result = RasterBuffer::Make(image->width(), image->height());
+  if (result == nullptr) {
+    return nullptr;
+  }
+  RasterContext context(result);
+  auto matrix = image->matrix ? *image->matrix : Matrix::I();
+  context.drawPicture(image->picture, MCState(matrix));
+  return result;
+}
+
+std::shared_ptr<RasterBuffer> RasterBuffer::MakeFrom(std::shared_ptr<Image> image) {
+  if (image == nullptr) {
+    return nullptr;
+  }
+  switch (Types::Get(image.get())) {
+    case Types::ImageType::Buffer:
+      return MakeFrom(static_cast<const BufferImage*>(image.get())->imageBuffer);
+    case Types::ImageType::Decoded:
+      return MakeFrom(static_cast<const DecodedImage*>(image.get())->source->getData());
+    case Types::ImageType::Codec:
+    case Types::ImageType::Generator: {
+      auto generator = static_cast<const GeneratorImage*>(image.get())->generator.get();
+      if (!generator->isImageCodec()) {
+        return MakeFrom(generator->makeBuffer(false));
+      }
+      return ReadCodec(static_cast<const ImageCodec*>(generator));
+    }
+    case Types::ImageType::Subset:
+      return ReadSubset(static_cast<const SubsetImage*>(image.get()));
+    case Types::ImageType::Mipmap:
+      return MakeFrom(static_cast<const MipmapImage*>(image.get())->source);
+    case Types::ImageType::Rasterized: {
+      auto rasterizedImage = static_cast<const RasterizedImage*>(image.get());
+      return ReadRasterized(rasterizedImage, rasterizedImage->source,
+                            rasterizedImage->rasterizationScale, rasterizedImage->sampling);
+    }
+    case Types::ImageType::Picture:
+      return ReadPicture(static_cast<const PictureImage*>(image.get()));
+    default:
+      break;
+  }
+  return nullptr;
+}
+
+RasterBuffer::RasterBuffer(const ImageInfo& info) : _info(info), buffer(info.byteSize()) {
+}
+
+std::shared_ptr<Image> RasterBuffer::makeImage() const {
+  auto pixels = Data::MakeWithCopy(buffer.data(), buffer.size());
+  return Image::MakeFrom(_info, std::move(pixels));
+}
+}  // namespace tgfx
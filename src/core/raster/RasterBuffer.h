@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "tgfx/core/Buffer.h"
+#include "tgfx/core/Color.h"
+#include "tgfx/core/Image.h"
+#include "tgfx/core/ImageBuffer.h"
+#include "tgfx/core/Pixmap.h"
+
+namespace tgfx {
+/**
+ * RasterBuffer is a block of CPU pixels used by the raster backend. Color buffers are stored as
+ * premultiplied RGBA_8888, and alpha-only buffers are stored as ALPHA_8.
+ */
+class RasterBuffer {
+ public:
+  /**
+   * Creates a new RasterBuffer with the specified size. All pixels are initialized to transparent.
+   * Returns nullptr if the width or height is not greater than zero.
+   */
+  static std::shared_ptr<RasterBuffer> Make(int width, int height, bool alphaOnly = false);
+
+  /**
+   * Decodes the pixels of the given image into a new RasterBuffer. Returns nullptr if the image is
+   * nullptr or its pixels can not be read without a GPU context, e.g. texture-backed images.
+   */
+  static std::shared_ptr<RasterBuffer> MakeFrom(std::shared_ptr<Image> image);
+
+  int width() const {
+    return _info.width();
+  }
+
+  int height() const {
+    return _info.height();
+  }
+
+  bool isAlphaOnly() const {
+    return _info.isAlphaOnly();
+  }
+
+  const ImageInfo& info() const {
+    return _info;
+  }
+
+  /**
+   * Returns a Pixmap that shares the pixels of the RasterBuffer.
+   */
+  Pixmap pixmap() const {
+    return Pixmap(_info, buffer.data());
+  }
+
+  /**
+   * Returns the address of the first pixel in the specified row.
+   */
+  uint8_t* row(int y) const {
+    return buffer.bytes() + static_cast<size_t>(y) * _info.rowBytes();
+  }
+
+  /**
+   * Returns the premultiplied color of the pixel at the specified location. The location must be
+   * inside the buffer.
+   */
+  Color getColor(int x, int y) const {
+    auto pixel = row(y);
+    if (_info.isAlphaOnly()) {
+      return {0.0f, 0.0f, 0.0f, static_cast<float>(pixel[x]) / 255.0f};
+    }
+    pixel += x * 4;
+    return {static_cast<float>(pixel[0]) / 255.0f, static_cast<float>(pixel[1]) / 255.0f,
+            static_cast<float>(pixel[2]) / 255.0f, static_cast<float>(pixel[3]) / 255.0f};
+  }
+
+  /**
+   * Returns an Image that shares a copy of the current pixels.
+   */
+  std::shared_ptr<Image> makeImage() const;
+
+ private:
+  ImageInfo _info = {};
+  Buffer buffer = {};
+
+  static std::shared_ptr<RasterBuffer> MakeFrom(std::shared_ptr<ImageBuffer> imageBuffer);
+
+  explicit RasterBuffer(const ImageInfo& info);
+};
+}  // namespace tgfx
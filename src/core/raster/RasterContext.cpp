@@ -0,0 +1,470 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RasterContext.h"
+#include <cmath>
+#include <cstring>
+#include "core/PathRasterizer.h"
+#include "core/filters/ShaderMaskFilter.h"
+#include "core/raster/RasterBlend.h"
+#include "core/raster/RasterFilter.h"
+#include "core/shapes/TextShape.h"
+#include "core/utils/Log.h"
+#include "core/utils/MathExtra.h"
+#include "core/utils/RectToRectMatrix.h"
+#include "core/utils/RowBandTasks.h"
+#include "core/utils/Types.h"
+
+namespace tgfx {
+static uint8_t MulDiv255(uint8_t a, uint8_t b) {
+  auto product = static_cast<unsigned>(a) * static_cast<unsigned>(b) + 128;
+  return static_cast<uint8_t>((product + (product >> 8)) >> 8);
+}
+
+static bool IsPixelAligned(const Rect& rect) {
+  return rect.left == std::floor(rect.left) && rect.top == std::floor(rect.top) &&
+         rect.right == std::floor(rect.right) && rect.bottom == std::floor(rect.bottom);
+}
+
+static std::shared_ptr<RasterBuffer> RasterizePath(const Path& path, const Rect& bounds,
+                                                   bool antiAlias) {
+  auto width = static_cast<int>(bounds.width());
+  auto height = static_cast<int>(bounds.height());
+  auto mask = RasterBuffer::Make(width, height, true);
+  if (mask == nullptr) {
+    return nullptr;
+  }
+  auto matrix = Matrix::MakeTrans(-bounds.left, -bounds.top);
+  auto rasterizer = PathRasterizer::MakeFrom(width, height, path, antiAlias, &matrix);
+  if (rasterizer == nullptr || !rasterizer->readPixels(mask->info(), mask->row(0))) {
+    return nullptr;
+  }
+  return mask;
+}
+
+static float EdgeCoverage(float start, float end, float pixel) {
+  return std::clamp(std::min(end, pixel + 1.0f) - std::max(start, pixel), 0.0f, 1.0f);
+}
+
+static std::shared_ptr<RasterBuffer> RasterizeRect(const Rect& rect, const Rect& bounds) {
+  auto width = static_cast<int>(bounds.width());
+  auto height = static_cast<int>(bounds.height());
+  auto mask = RasterBuffer::Make(width, height, true);
+  if (mask == nullptr) {
+    return nullptr;
+  }
+  std::vector<float> columns(static_cast<size_t>(width));
+  for (int x = 0; x < width; x++) {
+    columns[static_cast<size_t>(x)] =
+        EdgeCoverage(rect.left, rect.right, bounds.left + static_cast<float>(x));
+  }
+  for (int y = 0; y < height; y++) {
+    auto rowCoverage = EdgeCoverage(rect.top, rect.bottom, bounds.top + static_cast<float>(y));
+    auto row = mask->row(y);
+    for (int x = 0; x < width; x++) {
+      row[x] = static_cast<uint8_t>(std::lround(columns[static_cast<size_t>(x)] * rowCoverage *
+                                                255.0f));
+    }
+  }
+  return mask;
+}
+
+static void ShadeColors(const RasterShader* shader, const Color& paintColor, int x, int y,
+                        int count, Color* colors) {
+  if (shader == nullptr) {
+    std::fill(colors, colors + count, paintColor.premultiply());
+    return;
+  }
+  shader->shadeSpan(x, y, count, colors);
+  if (shader->isAlphaOnly()) {
+    auto color = paintColor.premultiply();
+    for (int i = 0; i < count; i++) {
+      auto alpha = colors[i].alpha;
+      colors[i] = {color.red * alpha, color.green * alpha, color.blue * alpha,
+                   color.alpha * alpha};
+    }
+  } else if (paintColor.alpha != 1.0f) {
+    for (int i = 0; i < count; i++) {
+      auto& color = colors[i];
+      color = {color.red * paintColor.alpha, color.green * paintColor.alpha,
+               color.blue * paintColor.alpha, color.alpha * paintColor.alpha};
+    }
+  }
+}
+
+RasterContext::RasterContext(std::shared_ptr<RasterBuffer> buffer) : _buffer(std::move(buffer)) {
+  DEBUG_ASSERT(_buffer != nullptr && !_buffer->isAlphaOnly());
+}
+
+Rect RasterContext::getClipBounds(const Path& clip) const {
+  auto bounds = Rect::MakeWH(_buffer->width(), _buffer->height());
+  if (clip.isInverseFillType()) {
+    return bounds;
+  }
+  auto clipBounds = clip.getBounds();
+  clipBounds.roundOut();
+  if (!clipBounds.intersect(bounds)) {
+    clipBounds.setEmpty();
+  }
+  return clipBounds;
+}
+
+void RasterContext::drawFill(const Fill& fill) {
+  fillMask(Rect::MakeWH(_buffer->width(), _buffer->height()), nullptr, MCState{}.clip, fill,
+           nullptr);
+}
+
+void RasterContext::drawRect(const Rect& rect, const MCState& state, const Fill& fill) {
+  if (!state.matrix.rectStaysRect()) {
+    Path path = {};
+    path.addRect(rect);
+    drawPath(path, state, fill);
+    return;
+  }
+  fillRect(state.matrix.mapRect(rect), state.clip, fill.makeWithMatrix(state.matrix));
+}
+
+void RasterContext::drawRRect(const RRect& rRect, const MCState& state, const Fill& fill,
+                              const Stroke* stroke) {
+  Path path = {};
+  path.addRRect(rRect);
+  if (stroke != nullptr && !stroke->applyToPath(&path)) {
+    return;
+  }
+  drawPath(path, state, fill);
+}
+
+void RasterContext::drawPath(const Path& path, const MCState& state, const Fill& fill) {
+  auto devicePath = path;
+  devicePath.transform(state.matrix);
+  fillPath(devicePath, state.clip, fill.makeWithMatrix(state.matrix));
+}
+
+void RasterContext::drawShape(std::shared_ptr<Shape> shape, const MCState& state,
+                              const Fill& fill) {
+  DEBUG_ASSERT(shape != nullptr);
+  drawPath(shape->getPath(), state, fill);
+}
+
+void RasterContext::drawImage(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                              const MCState& state, const Fill& fill) {
+  DEBUG_ASSERT(image != nullptr);
+  auto rect = Rect::MakeWH(image->width(), image->height());
+  drawImageRect(std::move(image), rect, rect, sampling, state, fill, SrcRectConstraint::Fast);
+}
+
+void RasterContext::drawImageRect(std::shared_ptr<Image> image, const Rect& srcRect,
+                                  const Rect& dstRect, const SamplingOptions& sampling,
+                                  const MCState& state, const Fill& fill,
+                                  SrcRectConstraint constraint) {
+  auto buffer = RasterBuffer::MakeFrom(std::move(image));
+  if (buffer == nullptr) {
+    return;
+  }
+  drawBuffer(std::move(buffer), srcRect, dstRect, sampling, state,
+             fill.makeWithMatrix(state.matrix), constraint);
+}
+
+void RasterContext::drawGlyphRunList(std::shared_ptr<GlyphRunList> glyphRunList,
+                                     const MCState& state, const Fill& fill, const Stroke* stroke) {
+  DEBUG_ASSERT(glyphRunList != nullptr);
+  auto maxScale = state.matrix.getMaxScale();
+  if (FloatNearlyZero(maxScale)) {
+    return;
+  }
+  if (!glyphRunList->hasColor() && glyphRunList->hasOutlines()) {
+    std::shared_ptr<Shape> shape = std::make_shared<TextShape>(std::move(glyphRunList), maxScale);
+    shape = Shape::ApplyMatrix(std::move(shape), Matrix::MakeScale(1.0f / maxScale));
+    shape = Shape::ApplyStroke(std::move(shape), stroke);
+    drawShape(std::move(shape), state, fill);
+    return;
+  }
+  for (auto& glyphRun : glyphRunList->glyphRuns()) {
+    drawGlyphsAsImage(glyphRun, state, fill, stroke);
+  }
+}
+
+void RasterContext::drawPicture(std::shared_ptr<Picture> picture, const MCState& state) {
+  DEBUG_ASSERT(picture != nullptr);
+  picture->playback(this, state);
+}
+
+void RasterContext::drawLayer(std::shared_ptr<Picture> picture, std::shared_ptr<ImageFilter> filter,
+                              const MCState& state, const Fill& fill) {
+  DEBUG_ASSERT(fill.shader == nullptr);
+  Matrix viewMatrix = {};
+  Rect bounds = {};
+  if (filter) {
+    if (picture->hasUnboundedFill()) {
+      Matrix invertMatrix = {};
+      if (!state.matrix.invert(&invertMatrix)) {
+        return;
+      }
+      bounds = invertMatrix.mapRect(getClipBounds(state.clip));
+    } else {
+      bounds = picture->getBounds();
+    }
+  } else {
+    bounds = getClipBounds(state.clip);
+    if (!picture->hasUnboundedFill()) {
+      auto deviceBounds = state.matrix.mapRect(picture->getBounds());
+      if (!bounds.intersect(deviceBounds)) {
+        return;
+      }
+    }
+    viewMatrix = state.matrix;
+  }
+  if (bounds.isEmpty()) {
+    return;
+  }
+  auto width = static_cast<int>(ceilf(bounds.width()));
+  auto height = static_cast<int>(ceilf(bounds.height()));
+  auto layer = RasterBuffer::Make(width, height);
+  if (layer == nullptr) {
+    return;
+  }
+  viewMatrix.postTranslate(-bounds.x(), -bounds.y());
+  RasterContext layerContext(layer);
+  picture->playback(&layerContext, MCState(viewMatrix));
+  if (filter) {
+    Point offset = {};
+    layer = ApplyImageFilter(filter.get(), std::move(layer), &offset);
+    if (layer == nullptr) {
+      return;
+    }
+    viewMatrix.preTranslate(-offset.x, -offset.y);
+  }
+  Matrix invertMatrix = {};
+  if (!viewMatrix.invert(&invertMatrix)) {
+    return;
+  }
+  MCState drawState = state;
+  drawState.matrix.preConcat(invertMatrix);
+  auto layerRect = Rect::MakeWH(layer->width(), layer->height());
+  drawBuffer(std::move(layer), layerRect, layerRect, {}, drawState,
+             fill.makeWithMatrix(state.matrix), SrcRectConstraint::Fast);
+}
+
+void RasterContext::drawBuffer(std::shared_ptr<RasterBuffer> image, const Rect& srcRect,
+                               const Rect& dstRect, const SamplingOptions& sampling,
+                               const MCState& state, const Fill& deviceFill,
+                               SrcRectConstraint constraint) {
+  Matrix deviceToImage = {};
+  if (!state.matrix.invert(&deviceToImage)) {
+    return;
+  }
+  deviceToImage.postConcat(MakeRectToRectMatrix(dstRect, srcRect));
+  auto subset = constraint == SrcRectConstraint::Strict ? &srcRect : nullptr;
+  auto shader = RasterShader::MakeImage(std::move(image), TileMode::Clamp, TileMode::Clamp,
+                                        sampling, deviceToImage, subset);
+  if (shader == nullptr) {
+    return;
+  }
+  if (state.matrix.rectStaysRect()) {
+    fillRect(state.matrix.mapRect(dstRect), state.clip, deviceFill, std::move(shader));
+    return;
+  }
+  Path path = {};
+  path.addRect(dstRect);
+  path.transform(state.matrix);
+  fillPath(path, state.clip, deviceFill, std::move(shader));
+}
+
+void RasterContext::drawGlyphsAsImage(const GlyphRun& glyphRun, const MCState& state,
+                                      const Fill& fill, const Stroke* stroke) {
+  if (glyphRun.font.getTypeface() == nullptr) {
+    return;
+  }
+  auto maxScale = state.matrix.getMaxScale();
+  auto font = glyphRun.font.makeWithSize(glyphRun.font.getSize() * maxScale);
+  std::unique_ptr<Stroke> scaledStroke = nullptr;
+  if (stroke) {
+    scaledStroke = std::make_unique<Stroke>(*stroke);
+    scaledStroke->width *= maxScale;
+  }
+  auto deviceFill = fill.makeWithMatrix(state.matrix);
+  for (size_t i = 0; i < glyphRun.glyphs.size(); i++) {
+    Matrix glyphMatrix = {};
+    auto glyphCodec = font.getImage(glyphRun.glyphs[i], scaledStroke.get(), &glyphMatrix);
+    if (glyphCodec == nullptr) {
+      continue;
+    }
+    auto glyphBuffer =
+        RasterBuffer::Make(glyphCodec->width(), glyphCodec->height(), glyphCodec->isAlphaOnly());
+    if (glyphBuffer == nullptr ||
+        !glyphCodec->readPixels(glyphBuffer->info(), glyphBuffer->row(0))) {
+      continue;
+    }
+    auto& position = glyphRun.positions[i];
+    glyphMatrix.postScale(1.0f / maxScale, 1.0f / maxScale);
+    glyphMatrix.postTranslate(position.x, position.y);
+    auto glyphState = state;
+    glyphState.matrix.preConcat(glyphMatrix);
+    auto glyphRect = Rect::MakeWH(glyphBuffer->width(), glyphBuffer->height());
+    drawBuffer(std::move(glyphBuffer), glyphRect, glyphRect, {}, glyphState, deviceFill,
+               SrcRectConstraint::Fast);
+  }
+}
+
+void RasterContext::fillRect(const Rect& deviceRect, const Path& clip, const Fill& fill,
+                             std::unique_ptr<RasterShader> imageShader) {
+  auto bounds = deviceRect;
+  if (!fill.antiAlias) {
+    bounds.round();
+  }
+  if (IsPixelAligned(bounds)) {
+    fillMask(bounds, nullptr, clip, fill, std::move(imageShader));
+    return;
+  }
+  bounds.roundOut();
+  if (!bounds.intersect(getClipBounds(clip))) {
+    return;
+  }
+  auto mask = RasterizeRect(deviceRect, bounds);
+  if (mask == nullptr) {
+    return;
+  }
+  fillMask(bounds, std::move(mask), clip, fill, std::move(imageShader));
+}
+
+void RasterContext::fillPath(const Path& devicePath, const Path& clip, const Fill& fill,
+                             std::unique_ptr<RasterShader> imageShader) {
+  auto bounds = getClipBounds(clip);
+  if (!devicePath.isInverseFillType()) {
+    if (devicePath.isEmpty()) {
+      return;
+    }
+    auto pathBounds = devicePath.getBounds();
+    pathBounds.roundOut();
+    if (!bounds.intersect(pathBounds)) {
+      return;
+    }
+  }
+  if (bounds.isEmpty()) {
+    return;
+  }
+  auto mask = RasterizePath(devicePath, bounds, fill.antiAlias);
+  if (mask == nullptr) {
+    return;
+  }
+  fillMask(bounds, std::move(mask), clip, fill, std::move(imageShader));
+}
+
+void RasterContext::fillMask(const Rect& maskBounds, std::shared_ptr<RasterBuffer> mask,
+                             const Path& clip, const Fill& fill,
+                             std::unique_ptr<RasterShader> imageShader) {
+  auto bounds = maskBounds;
+  if (!bounds.intersect(getClipBounds(clip))) {
+    return;
+  }
+  std::shared_ptr<RasterBuffer> clipMask = nullptr;
+  Rect clipRect = {};
+  auto wideOpen = clip.isInverseFillType() && clip.isEmpty();
+  if (!wideOpen && !(clip.isRect(&clipRect) && IsPixelAligned(clipRect))) {
+    clipMask = RasterizePath(clip, bounds, true);
+    if (clipMask == nullptr) {
+      return;
+    }
+  }
+  auto shader = std::move(imageShader);
+  if (shader == nullptr && fill.shader != nullptr) {
+    shader = RasterShader::Make(fill.shader.get(), {});
+    if (shader == nullptr) {
+      return;
+    }
+  }
+  std::unique_ptr<RasterShader> maskShader = nullptr;
+  bool maskInverted = false;
+  auto maskFilter = fill.maskFilter.get();
+  if (maskFilter != nullptr) {
+    if (Types::Get(maskFilter) != Types::MaskFilterType::Shader) {
+      // Drawing without the mask would paint outside of it, so the draw is dropped instead.
+      LOGE("RasterContext::fillMask() unsupported mask filter type, skipped.");
+      return;
+    }
+    auto shaderMaskFilter = static_cast<const ShaderMaskFilter*>(maskFilter);
+    maskShader = RasterShader::Make(shaderMaskFilter->getShader().get(), {});
+    if (maskShader == nullptr) {
+      return;
+    }
+    maskInverted = shaderMaskFilter->isInverted();
+  }
+  auto left = static_cast<int>(bounds.left);
+  auto top = static_cast<int>(bounds.top);
+  auto width = static_cast<int>(bounds.width());
+  auto maskLeft = static_cast<int>(maskBounds.left);
+  auto maskTop = static_cast<int>(maskBounds.top);
+  auto hasCoverage = mask != nullptr || clipMask != nullptr || maskShader != nullptr;
+  RunInRowBands(top, static_cast<int>(bounds.bottom), width, [&](int startY, int endY) {
+    std::vector<Color> colors(static_cast<size_t>(width));
+    std::vector<Color> maskColors(maskShader ? static_cast<size_t>(width) : 0);
+    std::vector<uint8_t> coverage(static_cast<size_t>(width), 255);
+    for (int y = startY; y < endY; y++) {
+      int start = 0;
+      int end = width;
+      bool fullCoverage = true;
+      if (hasCoverage) {
+        if (mask != nullptr) {
+          memcpy(coverage.data(), mask->row(y - maskTop) + (left - maskLeft),
+                 static_cast<size_t>(width));
+        } else {
+          std::fill(coverage.begin(), coverage.end(), 255);
+        }
+        if (clipMask != nullptr) {
+          auto clipRow = clipMask->row(y - top);
+          for (int i = 0; i < width; i++) {
+            coverage[static_cast<size_t>(i)] = MulDiv255(coverage[static_cast<size_t>(i)],
+                                                         clipRow[i]);
+          }
+        }
+        if (maskShader != nullptr) {
+          maskShader->shadeSpan(left, y, width, maskColors.data());
+          for (int i = 0; i < width; i++) {
+            auto alpha = maskColors[static_cast<size_t>(i)].alpha;
+            if (maskInverted) {
+              alpha = 1.0f - alpha;
+            }
+            auto value = static_cast<uint8_t>(std::lround(std::clamp(alpha, 0.0f, 1.0f) * 255.f));
+            coverage[static_cast<size_t>(i)] = MulDiv255(coverage[static_cast<size_t>(i)], value);
+          }
+        }
+        while (start < end && coverage[static_cast<size_t>(start)] == 0) {
+          start++;
+        }
+        while (end > start && coverage[static_cast<size_t>(end - 1)] == 0) {
+          end--;
+        }
+        if (start == end) {
+          continue;
+        }
+        fullCoverage = std::all_of(coverage.begin() + start, coverage.begin() + end,
+                                   [](uint8_t value) { return value == 255; });
+      }
+      auto count = end - start;
+      ShadeColors(shader.get(), fill.color, left + start, y, count, colors.data());
+      if (fill.colorFilter != nullptr) {
+        FilterColors(fill.colorFilter.get(), colors.data(), count);
+      }
+      auto dst = _buffer->row(y) + static_cast<size_t>(left + start) * 4;
+      BlendSpan(fill.blendMode, colors.data(), fullCoverage ? nullptr : coverage.data() + start,
+                dst, count);
+    }
+  });
+}
+}  // namespace tgfx
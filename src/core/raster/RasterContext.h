@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "core/DrawContext.h"
+#include "core/raster/RasterBuffer.h"
+#include "core/raster/RasterShader.h"
+
+namespace tgfx {
+/**
+ * RasterContext is a DrawContext that rasterizes drawing commands directly into CPU pixels without
+ * a GPU. Geometry is converted to coverage masks by the PathRasterizer, shaders, color filters and
+ * blend modes are evaluated in spans, and large draws are split into row bands that run on the
+ * Task thread pool.
+ */
+class RasterContext : public DrawContext {
+ public:
+  explicit RasterContext(std::shared_ptr<RasterBuffer> buffer);
+
+  /**
+   * Returns the pixels this context draws into.
+   */
+  const std::shared_ptr<RasterBuffer>& buffer() const {
+    return _buffer;
+  }
+
+  void drawFill(const Fill& fill) override;
+
+  void drawRect(const Rect& rect, const MCState& state, const Fill& fill) override;
+
+  void drawRRect(const RRect& rRect, const MCState& state, const Fill& fill,
+                 const Stroke* stroke) override;
+
+  void drawPath(const Path& path, const MCState& state, const Fill& fill) override;
+
+  void drawShape(std::shared_ptr<Shape> shape, const MCState& state, const Fill& fill) override;
+
+  void drawImage(std::shared_ptr<Image> image, const SamplingOptions& sampling,
+                 const MCState& state, const Fill& fill) override;
+
+  void drawImageRect(std::shared_ptr<Image> image, const Rect& srcRect, const Rect& dstRect,
+                     const SamplingOptions& sampling, const MCState& state, const Fill& fill,
+                     SrcRectConstraint constraint) override;
+
+  void drawGlyphRunList(std::shared_ptr<GlyphRunList> glyphRunList, const MCState& state,
+                        const Fill& fill, const Stroke* stroke) override;
+
+  void drawPicture(std::shared_ptr<Picture> picture, const MCState& state) override;
+
+  void drawLayer(std::shared_ptr<Picture> picture, std::shared_ptr<ImageFilter> filter,
+                 const MCState& state, const Fill& fill) override;
+
+ private:
+  std::shared_ptr<RasterBuffer> _buffer = nullptr;
+
+  Rect getClipBounds(const Path& clip) const;
+
+  void drawBuffer(std::shared_ptr<RasterBuffer> image, const Rect& srcRect, const Rect& dstRect,
+                  const SamplingOptions& sampling, const MCState& state, const Fill& deviceFill,
+                  SrcRectConstraint constraint);
+
+  void drawGlyphsAsImage(const GlyphRun& glyphRun, const MCState& state, const Fill& fill,
+                         const Stroke* stroke);
+
+  void fillRect(const Rect& deviceRect, const Path& clip, const Fill& fill,
+                std::unique_ptr<RasterShader> imageShader = nullptr);
+
+  void fillPath(const Path& devicePath, const Path& clip, const Fill& fill,
+                std::unique_ptr<RasterShader> imageShader = nullptr);
+
+  void fillMask(const Rect& maskBounds, std::shared_ptr<RasterBuffer> mask, const Path& clip,
+                const Fill& fill, std::unique_ptr<RasterShader> imageShader);
+};
+}  // namespace tgfx
@@ -0,0 +1,285 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RasterFilter.h"
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "core/filters/BlurImageFilter.h"
+#include "core/filters/ColorImageFilter.h"
+#include "core/filters/ComposeImageFilter.h"
+#include "core/filters/DropShadowImageFilter.h"
+#include "core/filters/InnerShadowImageFilter.h"
+#include "core/raster/RasterBlend.h"
+#include "core/raster/RasterShader.h"
+#include "core/utils/RowBandTasks.h"
+#include "core/utils/Types.h"
+
+namespace tgfx {
+// Creates a color buffer covering the given bounds in the source space, with the source pixels
+// copied to their position.
+static std::shared_ptr<RasterBuffer> MakeExpandedCopy(const RasterBuffer* source,
+                                                      const Rect& bounds) {
+  auto result = RasterBuffer::Make(static_cast<int>(bounds.width()),
+                                   static_cast<int>(bounds.height()));
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto pixmap = result->pixmap();
+  pixmap.writePixels(source->info(), source->row(0), static_cast<int>(-bounds.left),
+                     static_cast<int>(-bounds.top));
+  return result;
+}
+
+// Three successive box blurs of this radius approximate a gaussian blur with the given sigma.
+static int BoxRadius(float sigma) {
+  return static_cast<int>(roundf((sqrtf(4.0f * sigma * sigma + 1.0f) - 1.0f) * 0.5f));
+}
+
+// Blurs count pixels of premultiplied RGBA floats spaced by stride floats, treating the pixels
+// outside the line as transparent.
+static void BoxBlurLine(float* line, int count, int stride, int radius, std::vector<float>* temp) {
+  temp->resize(static_cast<size_t>(count) * 4);
+  auto source = temp->data();
+  for (int i = 0; i < count; i++) {
+    memcpy(source + i * 4, line + i * stride, sizeof(float) * 4);
+  }
+  auto scale = 1.0f / static_cast<float>(radius * 2 + 1);
+  float sum[4] = {};
+  for (int i = 0; i < std::min(radius, count); i++) {
+    for (int c = 0; c < 4; c++) {
+      sum[c] += source[i * 4 + c];
+    }
+  }
+  for (int i = 0; i < count; i++) {
+    auto enter = i + radius;
+    auto leave = i - radius - 1;
+    for (int c = 0; c < 4; c++) {
+      if (enter < count) {
+        sum[c] += source[enter * 4 + c];
+      }
+      if (leave >= 0) {
+        sum[c] -= source[leave * 4 + c];
+      }
+      line[i * stride + c] = sum[c] * scale;
+    }
+  }
+}
+
+static std::shared_ptr<RasterBuffer> ApplyBlur(const BlurImageFilter* filter,
+                                               const RasterBuffer* source, Point* offset) {
+  auto bounds = filter->filterBounds(Rect::MakeWH(source->width(), source->height()));
+  bounds.roundOut();
+  auto result = MakeExpandedCopy(source, bounds);
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto width = result->width();
+  auto height = result->height();
+  std::vector<float> pixels(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+  RunInRowBands(0, height, width, [&](int top, int bottom) {
+    for (int y = top; y < bottom; y++) {
+      auto row = result->row(y);
+      auto line = pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(width) * 4;
+      for (int i = 0; i < width * 4; i++) {
+        line[i] = static_cast<float>(row[i]) / 255.0f;
+      }
+    }
+  });
+  auto radiusX = BoxRadius(filter->blurrinessX);
+  auto radiusY = BoxRadius(filter->blurrinessY);
+  if (radiusX > 0) {
+    RunInRowBands(0, height, width, [&](int top, int bottom) {
+      std::vector<float> temp = {};
+      for (int y = top; y < bottom; y++) {
+        auto line = pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(width) * 4;
+        for (int pass = 0; pass < 3; pass++) {
+          BoxBlurLine(line, width, 4, radiusX, &temp);
+        }
+      }
+    });
+  }
+  if (radiusY > 0) {
+    // Columns are split into bands as well, so each band owns a vertical strip of the buffer.
+    RunInRowBands(0, width, height, [&](int left, int right) {
+      std::vector<float> temp = {};
+      for (int x = left; x < right; x++) {
+        auto line = pixels.data() + static_cast<size_t>(x) * 4;
+        for (int pass = 0; pass < 3; pass++) {
+          BoxBlurLine(line, height, width * 4, radiusY, &temp);
+        }
+      }
+    });
+  }
+  RunInRowBands(0, height, width, [&](int top, int bottom) {
+    for (int y = top; y < bottom; y++) {
+      auto line = pixels.data() + static_cast<size_t>(y) * static_cast<size_t>(width) * 4;
+      StoreSpan(reinterpret_cast<const Color*>(line), result->row(y), width);
+    }
+  });
+  offset->set(bounds.left, bounds.top);
+  return result;
+}
+
+// Returns the alpha of the shadow pixel that lands on (x, y) in the source space.
+static float ShadowAlpha(const RasterBuffer* shadow, const Point& shadowOffset, int x, int y) {
+  auto shadowX = x - static_cast<int>(roundf(shadowOffset.x));
+  auto shadowY = y - static_cast<int>(roundf(shadowOffset.y));
+  if (shadowX < 0 || shadowY < 0 || shadowX >= shadow->width() || shadowY >= shadow->height()) {
+    return 0.0f;
+  }
+  return shadow->getColor(shadowX, shadowY).alpha;
+}
+
+static Color SourceColor(const RasterBuffer* source, int x, int y) {
+  if (x < 0 || y < 0 || x >= source->width() || y >= source->height()) {
+    return Color::Transparent();
+  }
+  return source->getColor(x, y);
+}
+
+template <typename ShadowFunc>
+static std::shared_ptr<RasterBuffer> ApplyShadow(const ImageFilter* filter,
+                                                 const ImageFilter* blurFilter, float dx,
+                                                 float dy,
+                                                 const std::shared_ptr<RasterBuffer>& source,
+                                                 Point* offset, ShadowFunc shadowFunc) {
+  auto bounds = filter->filterBounds(Rect::MakeWH(source->width(), source->height()));
+  bounds.roundOut();
+  auto result = RasterBuffer::Make(static_cast<int>(bounds.width()),
+                                   static_cast<int>(bounds.height()));
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto shadowOffset = Point::Zero();
+  auto shadow = source;
+  if (blurFilter != nullptr) {
+    shadow = ApplyImageFilter(blurFilter, source, &shadowOffset);
+  }
+  shadowOffset.offset(dx, dy);
+  auto left = static_cast<int>(bounds.left);
+  auto top = static_cast<int>(bounds.top);
+  auto width = result->width();
+  RunInRowBands(0, result->height(), width, [&](int startRow, int endRow) {
+    std::vector<Color> colors(static_cast<size_t>(width));
+    for (int y = startRow; y < endRow; y++) {
+      for (int x = 0; x < width; x++) {
+        auto sourceColor = SourceColor(source.get(), x + left, y + top);
+        auto shadowAlpha =
+            shadow ? ShadowAlpha(shadow.get(), shadowOffset, x + left, y + top) : 0.0f;
+        colors[static_cast<size_t>(x)] = shadowFunc(sourceColor, shadowAlpha);
+      }
+      StoreSpan(colors.data(), result->row(y), width);
+    }
+  });
+  offset->set(bounds.left, bounds.top);
+  return result;
+}
+
+static std::shared_ptr<RasterBuffer> ApplyDropShadow(const DropShadowImageFilter* filter,
+                                                     const std::shared_ptr<RasterBuffer>& source,
+                                                     Point* offset) {
+  auto color = filter->color.premultiply();
+  auto shadowOnly = filter->shadowOnly;
+  return ApplyShadow(filter, filter->blurFilter.get(), filter->dx, filter->dy, source, offset,
+                     [&](const Color& sourceColor, float shadowAlpha) {
+                       Color shadowColor = {color.red * shadowAlpha, color.green * shadowAlpha,
+                                            color.blue * shadowAlpha, color.alpha * shadowAlpha};
+                       if (shadowOnly) {
+                         return shadowColor;
+                       }
+                       return BlendColor(BlendMode::SrcOver, sourceColor, shadowColor);
+                     });
+}
+
+static std::shared_ptr<RasterBuffer> ApplyInnerShadow(const InnerShadowImageFilter* filter,
+                                                      const std::shared_ptr<RasterBuffer>& source,
+                                                      Point* offset) {
+  auto color = filter->color.premultiply();
+  auto shadowOnly = filter->shadowOnly;
+  return ApplyShadow(filter, filter->blurFilter.get(), filter->dx, filter->dy, source, offset,
+                     [&](const Color& sourceColor, float shadowAlpha) {
+                       auto factor = 1.0f - shadowAlpha;
+                       Color shadowColor = {color.red * factor, color.green * factor,
+                                            color.blue * factor, color.alpha * factor};
+                       auto mode = shadowOnly ? BlendMode::SrcIn : BlendMode::SrcATop;
+                       return BlendColor(mode, shadowColor, sourceColor);
+                     });
+}
+
+static std::shared_ptr<RasterBuffer> ApplyColorFilter(const ColorFilter* colorFilter,
+                                                      const RasterBuffer* source, Point* offset) {
+  auto result = MakeExpandedCopy(source, Rect::MakeWH(source->width(), source->height()));
+  if (result == nullptr) {
+    return nullptr;
+  }
+  auto width = result->width();
+  RunInRowBands(0, result->height(), width, [&](int top, int bottom) {
+    std::vector<Color> colors(static_cast<size_t>(width));
+    for (int y = top; y < bottom; y++) {
+      for (int x = 0; x < width; x++) {
+        colors[static_cast<size_t>(x)] = result->getColor(x, y);
+      }
+      FilterColors(colorFilter, colors.data(), width);
+      StoreSpan(colors.data(), result->row(y), width);
+    }
+  });
+  offset->set(0, 0);
+  return result;
+}
+
+std::shared_ptr<RasterBuffer> ApplyImageFilter(const ImageFilter* filter,
+                                               std::shared_ptr<RasterBuffer> source,
+                                               Point* offset) {
+  DEBUG_ASSERT(offset != nullptr);
+  if (source == nullptr) {
+    return nullptr;
+  }
+  offset->set(0, 0);
+  if (filter == nullptr) {
+    return source;
+  }
+  switch (Types::Get(filter)) {
+    case Types::ImageFilterType::Blur:
+      return ApplyBlur(static_cast<const BlurImageFilter*>(filter), source.get(), offset);
+    case Types::ImageFilterType::DropShadow:
+      return ApplyDropShadow(static_cast<const DropShadowImageFilter*>(filter), source, offset);
+    case Types::ImageFilterType::InnerShadow:
+      return ApplyInnerShadow(static_cast<const InnerShadowImageFilter*>(filter), source, offset);
+    case Types::ImageFilterType::Color:
+      return ApplyColorFilter(static_cast<const ColorImageFilter*>(filter)->filter.get(),
+                              source.get(), offset);
+    case Types::ImageFilterType::Compose: {
+      auto result = std::move(source);
+      for (auto& child : static_cast<const ComposeImageFilter*>(filter)->filters) {
+        Point childOffset = {};
+        result = ApplyImageFilter(child.get(), std::move(result), &childOffset);
+        if (result == nullptr) {
+          return nullptr;
+        }
+        offset->offset(childOffset.x, childOffset.y);
+      }
+      return result;
+    }
+    case Types::ImageFilterType::Runtime:
+      break;
+  }
+  return nullptr;
+}
+}  // namespace tgfx
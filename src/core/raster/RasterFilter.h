@@ -0,0 +1,34 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "core/raster/RasterBuffer.h"
+#include "tgfx/core/ImageFilter.h"
+
+namespace tgfx {
+/**
+ * Applies the image filter to the source pixels on the CPU. The offset receives the position of
+ * the returned pixels relative to the source. Returns nullptr if the result is empty or the filter
+ * can not be evaluated on the CPU, e.g. runtime filters.
+ */
+std::shared_ptr<RasterBuffer> ApplyImageFilter(const ImageFilter* filter,
+                                               std::shared_ptr<RasterBuffer> source,
+                                               Point* offset);
+}  // namespace tgfx
@@ -0,0 +1,388 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RasterShader.h"
+#include <algorithm>
+#include <cmath>
+#include "core/filters/AlphaThresholdColorFilter.h"
+#include "core/filters/ComposeColorFilter.h"
+#include "core/filters/MatrixColorFilter.h"
+#include "core/filters/ModeColorFilter.h"
+#include "core/raster/RasterBlend.h"
+#include "core/shaders/BlendShader.h"
+#include "core/shaders/ColorFilterShader.h"
+#include "core/shaders/ColorShader.h"
+#include "core/shaders/GradientShader.h"
+#include "core/shaders/ImageShader.h"
+#include "core/shaders/MatrixShader.h"
+#include "core/utils/Types.h"
+
+namespace tgfx {
+class ColorRasterShader : public RasterShader {
+ public:
+  explicit ColorRasterShader(const Color& color) : color(color.premultiply()) {
+  }
+
+  void shadeSpan(int, int, int count, Color* dst) const override {
+    std::fill(dst, dst + count, color);
+  }
+
+ private:
+  Color color = {};
+};
+
+class GradientRasterShader : public RasterShader {
+ public:
+  GradientRasterShader(const GradientShader* shader, const Matrix& deviceToLocal)
+      : colors(shader->originalColors), positions(shader->originalPositions),
+        deviceToUnit(deviceToLocal) {
+    deviceToUnit.postConcat(shader->pointsToUnit);
+    GradientInfo info = {};
+    type = shader->asGradient(&info);
+    if (type == GradientType::Conic) {
+      bias = -info.radiuses[0] / 360.0f;
+      scale = 360.0f / (info.radiuses[1] - info.radiuses[0]);
+    }
+  }
+
+  void shadeSpan(int x, int y, int count, Color* dst) const override {
+    auto point = deviceToUnit.mapXY(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+    auto stepX = deviceToUnit.getScaleX();
+    auto stepY = deviceToUnit.getSkewY();
+    for (int i = 0; i < count; i++) {
+      dst[i] = colorAt(computeT(point));
+      point.x += stepX;
+      point.y += stepY;
+    }
+  }
+
+ private:
+  std::vector<Color> colors = {};
+  std::vector<float> positions = {};
+  Matrix deviceToUnit = {};
+  GradientType type = GradientType::Linear;
+  float bias = 0.0f;
+  float scale = 1.0f;
+
+  float computeT(const Point& point) const {
+    switch (type) {
+      case GradientType::Radial:
+        return Point::Length(point.x, point.y);
+      case GradientType::Conic: {
+        auto angle = atan2f(-point.y, -point.x);
+        return ((angle * 0.15915494309180001f + 0.5f) + bias) * scale;
+      }
+      case GradientType::Diamond:
+        return std::max(fabsf(point.x), fabsf(point.y));
+      default:
+        return point.x;
+    }
+  }
+
+  Color colorAt(float t) const {
+    if (!(t > 0.0f)) {
+      return colors.front().premultiply();
+    }
+    if (t >= 1.0f) {
+      return colors.back().premultiply();
+    }
+    auto next = std::upper_bound(positions.begin(), positions.end(), t) - positions.begin();
+    auto index = static_cast<size_t>(std::clamp(next, static_cast<decltype(next)>(1),
+                                                static_cast<decltype(next)>(colors.size() - 1)));
+    auto& start = colors[index - 1];
+    auto& end = colors[index];
+    auto range = positions[index] - positions[index - 1];
+    auto factor = range > 0.0f ? (t - positions[index - 1]) / range : 1.0f;
+    Color color = {start.red + (end.red - start.red) * factor,
+                   start.green + (end.green - start.green) * factor,
+                   start.blue + (end.blue - start.blue) * factor,
+                   start.alpha + (end.alpha - start.alpha) * factor};
+    return color.premultiply();
+  }
+};
+
+static int TileCoordinate(int coord, int start, int end, TileMode tileMode, bool* valid) {
+  auto size = end - start;
+  coord -= start;
+  switch (tileMode) {
+    case TileMode::Repeat:
+      coord %= size;
+      if (coord < 0) {
+        coord += size;
+      }
+      break;
+    case TileMode::Mirror: {
+      auto period = size * 2;
+      coord %= period;
+      if (coord < 0) {
+        coord += period;
+      }
+      if (coord >= size) {
+        coord = period - 1 - coord;
+      }
+      break;
+    }
+    case TileMode::Decal:
+      if (coord < 0 || coord >= size) {
+        *valid = false;
+        return 0;
+      }
+      break;
+    default:
+      coord = std::clamp(coord, 0, size - 1);
+      break;
+  }
+  return coord + start;
+}
+
+class ImageRasterShader : public RasterShader {
+ public:
+  ImageRasterShader(std::shared_ptr<RasterBuffer> buffer, TileMode tileModeX, TileMode tileModeY,
+                    const SamplingOptions& sampling, const Matrix& deviceToImage,
+                    const Rect& subset)
+      : buffer(std::move(buffer)), tileModeX(tileModeX), tileModeY(tileModeY),
+        linear(sampling.filterMode == FilterMode::Linear), deviceToImage(deviceToImage) {
+    left = static_cast<int>(floorf(subset.left));
+    top = static_cast<int>(floorf(subset.top));
+    right = static_cast<int>(ceilf(subset.right));
+    bottom = static_cast<int>(ceilf(subset.bottom));
+  }
+
+  bool isAlphaOnly() const override {
+    return buffer->isAlphaOnly();
+  }
+
+  void shadeSpan(int x, int y, int count, Color* dst) const override {
+    auto point = deviceToImage.mapXY(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+    auto stepX = deviceToImage.getScaleX();
+    auto stepY = deviceToImage.getSkewY();
+    for (int i = 0; i < count; i++) {
+      dst[i] = linear ? sampleLinear(point.x, point.y) : sampleNearest(point.x, point.y);
+      point.x += stepX;
+      point.y += stepY;
+    }
+  }
+
+ private:
+  std::shared_ptr<RasterBuffer> buffer = nullptr;
+  TileMode tileModeX = TileMode::Clamp;
+  TileMode tileModeY = TileMode::Clamp;
+  bool linear = false;
+  Matrix deviceToImage = {};
+  int left = 0;
+  int top = 0;
+  int right = 0;
+  int bottom = 0;
+
+  Color fetch(int x, int y) const {
+    bool valid = true;
+    x = TileCoordinate(x, left, right, tileModeX, &valid);
+    y = TileCoordinate(y, top, bottom, tileModeY, &valid);
+    return valid ? buffer->getColor(x, y) : Color::Transparent();
+  }
+
+  Color sampleNearest(float u, float v) const {
+    return fetch(static_cast<int>(floorf(u)), static_cast<int>(floorf(v)));
+  }
+
+  Color sampleLinear(float u, float v) const {
+    u -= 0.5f;
+    v -= 0.5f;
+    auto x0 = floorf(u);
+    auto y0 = floorf(v);
+    auto fx = u - x0;
+    auto fy = v - y0;
+    auto ix = static_cast<int>(x0);
+    auto iy = static_cast<int>(y0);
+    auto c00 = fetch(ix, iy);
+    auto c10 = fetch(ix + 1, iy);
+    auto c01 = fetch(ix, iy + 1);
+    auto c11 = fetch(ix + 1, iy + 1);
+    Color result = {};
+    for (int i = 0; i < 4; i++) {
+      auto topValue = c00[i] + (c10[i] - c00[i]) * fx;
+      auto bottomValue = c01[i] + (c11[i] - c01[i]) * fx;
+      result[i] = topValue + (bottomValue - topValue) * fy;
+    }
+    return result;
+  }
+};
+
+class BlendRasterShader : public RasterShader {
+ public:
+  BlendRasterShader(BlendMode mode, std::unique_ptr<RasterShader> dst,
+                    std::unique_ptr<RasterShader> src)
+      : mode(mode), dst(std::move(dst)), src(std::move(src)) {
+  }
+
+  void shadeSpan(int x, int y, int count, Color* result) const override {
+    std::vector<Color> srcColors(static_cast<size_t>(count));
+    dst->shadeSpan(x, y, count, result);
+    src->shadeSpan(x, y, count, srcColors.data());
+    for (int i = 0; i < count; i++) {
+      result[i] = BlendColor(mode, srcColors[static_cast<size_t>(i)], result[i]);
+    }
+  }
+
+ private:
+  BlendMode mode = BlendMode::SrcOver;
+  std::unique_ptr<RasterShader> dst = nullptr;
+  std::unique_ptr<RasterShader> src = nullptr;
+};
+
+class ColorFilterRasterShader : public RasterShader {
+ public:
+  ColorFilterRasterShader(std::unique_ptr<RasterShader> shader,
+                          std::shared_ptr<ColorFilter> colorFilter)
+      : shader(std::move(shader)), colorFilter(std::move(colorFilter)) {
+  }
+
+  void shadeSpan(int x, int y, int count, Color* dst) const override {
+    shader->shadeSpan(x, y, count, dst);
+    FilterColors(colorFilter.get(), dst, count);
+  }
+
+ private:
+  std::unique_ptr<RasterShader> shader = nullptr;
+  std::shared_ptr<ColorFilter> colorFilter = nullptr;
+};
+
+std::unique_ptr<RasterShader> RasterShader::Make(const Shader* shader,
+                                                 const Matrix& deviceToLocal) {
+  if (shader == nullptr) {
+    return nullptr;
+  }
+  switch (Types::Get(shader)) {
+    case Types::ShaderType::Color:
+      return std::make_unique<ColorRasterShader>(static_cast<const ColorShader*>(shader)->color);
+    case Types::ShaderType::Gradient:
+      return std::make_unique<GradientRasterShader>(static_cast<const GradientShader*>(shader),
+                                                    deviceToLocal);
+    case Types::ShaderType::Image: {
+      auto imageShader = static_cast<const ImageShader*>(shader);
+      auto buffer = RasterBuffer::MakeFrom(imageShader->image);
+      return MakeImage(std::move(buffer), imageShader->tileModeX, imageShader->tileModeY,
+                       imageShader->sampling, deviceToLocal);
+    }
+    case Types::ShaderType::Matrix: {
+      auto matrixShader = static_cast<const MatrixShader*>(shader);
+      Matrix invertMatrix = {};
+      if (!matrixShader->matrix.invert(&invertMatrix)) {
+        return nullptr;
+      }
+      auto totalMatrix = deviceToLocal;
+      totalMatrix.postConcat(invertMatrix);
+      return Make(matrixShader->source.get(), totalMatrix);
+    }
+    case Types::ShaderType::Blend: {
+      auto blendShader = static_cast<const BlendShader*>(shader);
+      auto dst = Make(blendShader->dst.get(), deviceToLocal);
+      auto src = Make(blendShader->src.get(), deviceToLocal);
+      if (dst == nullptr || src == nullptr) {
+        return nullptr;
+      }
+      return std::make_unique<BlendRasterShader>(blendShader->mode, std::move(dst),
+                                                 std::move(src));
+    }
+    case Types::ShaderType::ColorFilter: {
+      auto filterShader = static_cast<const ColorFilterShader*>(shader);
+      auto source = Make(filterShader->shader.get(), deviceToLocal);
+      if (source == nullptr) {
+        return nullptr;
+      }
+      return std::make_unique<ColorFilterRasterShader>(std::move(source),
+                                                       filterShader->colorFilter);
+    }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<RasterShader> RasterShader::MakeImage(std::shared_ptr<RasterBuffer> buffer,
+                                                      TileMode tileModeX, TileMode tileModeY,
+                                                      const SamplingOptions& sampling,
+                                                      const Matrix& deviceToImage,
+                                                      const Rect* subset) {
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+  auto bounds = Rect::MakeWH(buffer->width(), buffer->height());
+  if (subset != nullptr && !bounds.intersect(*subset)) {
+    return nullptr;
+  }
+  return std::make_unique<ImageRasterShader>(std::move(buffer), tileModeX, tileModeY, sampling,
+                                             deviceToImage, bounds);
+}
+
+static void ApplyMatrix(const std::array<float, 20>& matrix, Color* colors, int count) {
+  for (int i = 0; i < count; i++) {
+    auto& color = colors[i];
+    auto alpha = std::max(color.alpha, 9.9999997473787516e-05f);
+    float input[4] = {color.red / alpha, color.green / alpha, color.blue / alpha, color.alpha};
+    float output[4] = {};
+    for (size_t row = 0; row < 4; row++) {
+      auto values = &matrix[row * 5];
+      output[row] = values[0] * input[0] + values[1] * input[1] + values[2] * input[2] +
+                    values[3] * input[3] + values[4];
+      output[row] = std::clamp(output[row], 0.0f, 1.0f);
+    }
+    color = {output[0] * output[3], output[1] * output[3], output[2] * output[3], output[3]};
+  }
+}
+
+void FilterColors(const ColorFilter* colorFilter, Color* colors, int count) {
+  if (colorFilter == nullptr) {
+    return;
+  }
+  switch (Types::Get(colorFilter)) {
+    case Types::ColorFilterType::Blend: {
+      auto modeFilter = static_cast<const ModeColorFilter*>(colorFilter);
+      auto filterColor = modeFilter->color.premultiply();
+      for (int i = 0; i < count; i++) {
+        colors[i] = BlendColor(modeFilter->mode, filterColor, colors[i]);
+      }
+      break;
+    }
+    case Types::ColorFilterType::Matrix:
+      ApplyMatrix(static_cast<const MatrixColorFilter*>(colorFilter)->matrix, colors, count);
+      break;
+    case Types::ColorFilterType::AlphaThreshold: {
+      auto threshold = static_cast<const AlphaThresholdColorFilter*>(colorFilter)->threshold;
+      for (int i = 0; i < count; i++) {
+        auto color = colors[i].unpremultiply();
+        color.alpha = colors[i].alpha >= threshold ? 1.0f : 0.0f;
+        colors[i] = color;
+      }
+      break;
+    }
+    case Types::ColorFilterType::Compose: {
+      auto composeFilter = static_cast<const ComposeColorFilter*>(colorFilter);
+      FilterColors(composeFilter->inner.get(), colors, count);
+      FilterColors(composeFilter->outer.get(), colors, count);
+      break;
+    }
+    case Types::ColorFilterType::Luma:
+      for (int i = 0; i < count; i++) {
+        auto& color = colors[i];
+        auto luma = 0.2126f * color.red + 0.7152f * color.green + 0.0722f * color.blue;
+        color = {luma, luma, luma, luma};
+      }
+      break;
+  }
+}
+}  // namespace tgfx
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "core/raster/RasterBuffer.h"
+#include "tgfx/core/ColorFilter.h"
+#include "tgfx/core/Matrix.h"
+#include "tgfx/core/SamplingOptions.h"
+#include "tgfx/core/Shader.h"
+#include "tgfx/core/TileMode.h"
+
+namespace tgfx {
+/**
+ * RasterShader evaluates a Shader on the CPU. It is the raster counterpart of the fragment
+ * processors created by Shader::asFragmentProcessor().
+ */
+class RasterShader {
+ public:
+  /**
+   * Creates a RasterShader for the given shader. The deviceToLocal matrix maps device coordinates
+   * to the coordinate space of the shader. Returns nullptr if the shader can not be evaluated on
+   * the CPU.
+   */
+  static std::unique_ptr<RasterShader> Make(const Shader* shader, const Matrix& deviceToLocal);
+
+  /**
+   * Creates a RasterShader that samples the given pixels. The deviceToImage matrix maps device
+   * coordinates to the pixel coordinates of the buffer. If the subset is not nullptr, sampling is
+   * restricted to it.
+   */
+  static std::unique_ptr<RasterShader> MakeImage(std::shared_ptr<RasterBuffer> buffer,
+                                                 TileMode tileModeX, TileMode tileModeY,
+                                                 const SamplingOptions& sampling,
+                                                 const Matrix& deviceToImage,
+                                                 const Rect* subset = nullptr);
+
+  virtual ~RasterShader() = default;
+
+  /**
+   * Returns true if the shader produces alpha values only. The colors of an alpha-only shader are
+   * taken from the paint color instead.
+   */
+  virtual bool isAlphaOnly() const {
+    return false;
+  }
+
+  /**
+   * Writes the premultiplied colors of count pixels starting at (x, y) into dst. Pixels are sampled
+   * at their centers.
+   */
+  virtual void shadeSpan(int x, int y, int count, Color* dst) const = 0;
+};
+
+/**
+ * Applies the color filter to count premultiplied colors in place.
+ */
+void FilterColors(const ColorFilter* colorFilter, Color* colors, int count);
+}  // namespace tgfx
@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "tgfx/core/RasterSurface.h"
+#include "core/raster/RasterContext.h"
+
+namespace tgfx {
+std::shared_ptr<RasterSurface> RasterSurface::Make(int width, int height) {
+  auto buffer = RasterBuffer::Make(width, height);
+  if (buffer == nullptr) {
+    return nullptr;
+  }
+  return std::shared_ptr<RasterSurface>(new RasterSurface(std::move(buffer)));
+}
+
+RasterSurface::RasterSurface(std::shared_ptr<RasterBuffer> buffer) : buffer(std::move(buffer)) {
+}
+
+RasterSurface::~RasterSurface() {
+  delete canvas;
+  delete rasterContext;
+}
+
+int RasterSurface::width() const {
+  return buffer->width();
+}
+
+int RasterSurface::height() const {
+  return buffer->height();
+}
+
+Canvas* RasterSurface::getCanvas() {
+  if (canvas == nullptr) {
+    rasterContext = new RasterContext(buffer);
+    canvas = new Canvas(rasterContext);
+  }
+  return canvas;
+}
+
+std::shared_ptr<Image> RasterSurface::makeImageSnapshot() const {
+  return buffer->makeImage();
+}
+
+bool RasterSurface::readPixels(const ImageInfo& dstInfo, void* dstPixels, int srcX,
+                               int srcY) const {
+  return buffer->pixmap().readPixels(dstInfo, dstPixels, srcX, srcY);
+}
+}  // namespace tgfx
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "MappedFile.h"
+#include <cstdint>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tgfx {
+// Small files are cheaper to read in one go than to map, since each mapping costs a few syscalls
+// and at least one page fault.
+static constexpr int64_t MinMappedFileSize = 16 * 1024;
+
+#if defined(_WIN32)
+
+static void UnmapFileProc(const void* data, void*) {
+  UnmapViewOfFile(data);
+}
+
+std::shared_ptr<Data> MapFile(const std::string& filePath, FileAccess) {
+  auto file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+  LARGE_INTEGER fileSize = {};
+  if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < MinMappedFileSize ||
+      static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX) {
+    CloseHandle(file);
+    return nullptr;
+  }
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return nullptr;
+  }
+  // The view keeps the mapping object alive, so the handle can be closed right away.
+  auto memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (memory == nullptr) {
+    return nullptr;
+  }
+  return Data::MakeAdopted(memory, static_cast<size_t>(fileSize.QuadPart), UnmapFileProc);
+}
+
+#elif defined(__EMSCRIPTEN__)
+
+std::shared_ptr<Data> MapFile(const std::string&, FileAccess) {
+  // mmap() on the emscripten file system copies the file anyway.
+  return nullptr;
+}
+
+#else
+
+static void UnmapFileProc(const void* data, void* context) {
+  munmap(const_cast<void*>(data), reinterpret_cast<size_t>(context));
+}
+
+std::shared_ptr<Data> MapFile(const std::string& filePath, FileAccess access) {
+  auto fd = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat fileStat = {};
+  if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) ||
+      fileStat.st_size < MinMappedFileSize ||
+      static_cast<uint64_t>(fileStat.st_size) > SIZE_MAX) {
+    close(fd);
+    return nullptr;
+  }
+  auto length = static_cast<size_t>(fileStat.st_size);
+  auto memory = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping holds its own reference to the file.
+  close(fd);
+  if (memory == MAP_FAILED) {
+    return nullptr;
+  }
+  // Sequential reads benefit from aggressive readahead, while random reads would only waste it on
+  // pages that are never touched. The hint is advisory, so a failure is harmless.
+  madvise(memory, length, access == FileAccess::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+  return Data::MakeAdopted(memory, length, UnmapFileProc, reinterpret_cast<void*>(length));
+}
+
+#endif
+}  // namespace tgfx
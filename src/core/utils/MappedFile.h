@@ -0,0 +1,49 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <string>
+#include "tgfx/core/Data.h"
+
+namespace tgfx {
+/**
+ * Describes how the bytes of a mapped file are going to be read, so the OS can tune its readahead.
+ */
+enum class FileAccess {
+  /**
+   * The file is read from front to back once, like the input of a stream or an image codec.
+   */
+  Sequential,
+  /**
+   * The file is read at scattered offsets, like the tables of a font file.
+   */
+  Random
+};
+
+/**
+ * Maps the whole file at the given path into memory read-only and returns a Data object that
+ * unmaps it when released. The pages are loaded lazily by the OS instead of being copied into the
+ * heap, so only the bytes actually touched count towards the resident memory. Returns nullptr if
+ * the file can't be opened, is too small to be worth mapping, or the platform doesn't support
+ * memory mapping, in which case the caller should fall back to reading the file.
+ * Note: The file must not be truncated or rewritten while the returned Data is alive. Reading a
+ * truncated page of the mapping raises SIGBUS, and rewritten pages may show the new contents.
+ */
+std::shared_ptr<Data> MapFile(const std::string& filePath, FileAccess access);
+}  // namespace tgfx
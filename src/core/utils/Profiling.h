@@ -19,12 +19,6 @@
 #ifdef TGFX_USE_INSPECTOR
 #include "Define.h"
 #else
-#define FrameMark
-
-#define ScopedMark(type, active)
-#define OperateMark(type)
-#define TaskMark(type)
-
 #define AttributeName(name, value)
 #define AttributeTGFXName(name, value)
 #define AttributeNameFloatArray(name, value, size)
@@ -33,4 +27,26 @@
 
 #define SEND_LAYER_DATA(data)
 #define LAYER_CALLBACK(x)
-#endif
\ No newline at end of file
+#endif
+
+#ifdef TGFX_USE_TRACE
+#include "core/utils/TraceScope.h"
+
+#define TGFX_TRACE_CONCAT_IMPL(a, b) a##b
+#define TGFX_TRACE_CONCAT(a, b) TGFX_TRACE_CONCAT_IMPL(a, b)
+
+#define FrameMark tgfx::Tracer::MarkFrame()
+
+#define ScopedMark(name, active) \
+  tgfx::TraceScope TGFX_TRACE_CONCAT(traceScope, __LINE__)(name, active)
+#define OperateMark(name) ScopedMark(name, true)
+#define TaskMark(name) ScopedMark(name, true)
+#define CounterMark(counter, value) tgfx::TraceCount(tgfx::TraceCounter::counter, value)
+#else
+#define FrameMark
+
+#define ScopedMark(name, active)
+#define OperateMark(name)
+#define TaskMark(name)
+#define CounterMark(counter, value)
+#endif
@@ -0,0 +1,59 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "RowBandTasks.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "tgfx/core/Task.h"
+
+namespace tgfx {
+// Bands smaller than this are not worth the cost of scheduling a task.
+static constexpr int MinPixelsPerBand = 64 * 1024;
+
+static int GetBandLimit() {
+  static const int cpuCores = static_cast<int>(std::thread::hardware_concurrency());
+  return std::max(cpuCores, 1);
+}
+
+void RunInRowBands(int top, int bottom, int width, const std::function<void(int, int)>& block) {
+  auto rows = bottom - top;
+  if (rows <= 0 || width <= 0) {
+    return;
+  }
+  auto area = static_cast<int64_t>(rows) * width;
+  auto bandCount = static_cast<int>(std::min(static_cast<int64_t>(GetBandLimit()),
+                                             std::max(area / MinPixelsPerBand, int64_t(1))));
+  bandCount = std::min(bandCount, rows);
+  if (bandCount <= 1) {
+    block(top, bottom);
+    return;
+  }
+  auto rowsPerBand = (rows + bandCount - 1) / bandCount;
+  std::vector<std::shared_ptr<Task>> tasks = {};
+  for (int start = top + rowsPerBand; start < bottom; start += rowsPerBand) {
+    auto end = std::min(start + rowsPerBand, bottom);
+    tasks.push_back(Task::Run([&block, start, end]() { block(start, end); }));
+  }
+  block(top, std::min(top + rowsPerBand, bottom));
+  for (auto& task : tasks) {
+    task->wait();
+  }
+}
+}  // namespace tgfx
@@ -0,0 +1,31 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <functional>
+
+namespace tgfx {
+/**
+ * Splits the rows in [top, bottom) into horizontal bands and runs the block for each band, passing
+ * the first row and the end row of the band. Bands run in parallel on the Task thread pool when
+ * the area is large enough, and the function returns only after all bands have finished.
+ */
+void RunInRowBands(int top, int bottom, int width, const std::function<void(int, int)>& block);
+}  // namespace tgfx
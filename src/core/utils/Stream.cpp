@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <utility>
 #include "core/utils/Log.h"
+#include "core/utils/MappedFile.h"
 #include "tgfx/core/Data.h"
 
 namespace tgfx {
@@ -135,6 +136,10 @@ std::unique_ptr<Stream> Stream::MakeFromFile(const std::string& filePath) {
         return stream;
       }
     }
+  } else if (auto data = MapFile(filePath, FileAccess::Sequential)) {
+    // Reads from the mapping go straight to the page cache, and getMemoryBase() lets parsers
+    // access the file without copying it at all.
+    return std::make_unique<MemoryStream>(std::move(data));
   }
   auto file = fopen(filePath.c_str(), "rb");
   if (file == nullptr) {
@@ -20,6 +20,7 @@
 #include <cmath>
 #include <cstdlib>
 #include "core/utils/Log.h"
+#include "core/utils/Profiling.h"
 
 #ifdef __APPLE__
 #include <sys/sysctl.h>
@@ -64,6 +65,7 @@ void TaskGroup::RunLoop(TaskGroup* taskGroup) {
       }
       continue;
     }
+    TaskMark("TaskGroup::RunLoop");
     task->execute();
   }
 }
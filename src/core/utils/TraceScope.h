@@ -0,0 +1,45 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "tgfx/core/Tracer.h"
+
+namespace tgfx {
+/**
+ * TraceScope records a timed zone into the ring buffer of the current thread, from its creation to
+ * its destruction. It records nothing if the Tracer is inactive or the active flag is false. The
+ * name must be a string literal or outlive the Tracer.
+ */
+class TraceScope {
+ public:
+  explicit TraceScope(const char* name, bool active = true);
+
+  ~TraceScope();
+
+ private:
+  const char* name = nullptr;
+  int64_t startTime = -1;
+};
+
+/**
+ * Adds the value to the specified counter of the current frame if the Tracer is active.
+ */
+void TraceCount(TraceCounter counter, uint64_t value = 1);
+}  // namespace tgfx
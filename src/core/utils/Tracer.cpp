@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "TraceScope.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/WriteStream.h"
+
+namespace tgfx {
+static constexpr size_t MaxFrameCount = 600;
+static constexpr size_t CounterCount = static_cast<size_t>(TraceCounter::Count);
+
+static const char* CounterNames[CounterCount] = {
+    "DrawCalls",   "DrawOps",         "TextureUploads", "BufferUploads",
+    "UploadBytes", "CacheHits",       "CacheMisses",    "ProgramCompiles",
+    "TileDraws",   "TileRefinements", "TilePrefetches"};
+
+struct TraceEvent {
+  const char* name = nullptr;
+  int64_t startTime = 0;
+  int64_t duration = 0;
+};
+
+/**
+ * A fixed-size ring buffer of events written by a single thread.
+ */
+class TraceBuffer {
+ public:
+  TraceBuffer(uint32_t threadID, uint32_t generation, size_t capacity)
+      : threadID(threadID), generation(generation), events(capacity) {
+  }
+
+  uint32_t threadID = 0;
+  uint32_t generation = 0;
+  std::vector<TraceEvent> events = {};
+  std::atomic<uint64_t> count = {0};
+
+  void addEvent(const char* name, int64_t startTime, int64_t duration) {
+    auto index = count.load(std::memory_order_relaxed);
+    events[index % events.size()] = {name, startTime, duration};
+    count.store(index + 1, std::memory_order_release);
+  }
+};
+
+class TraceState {
+ public:
+  std::atomic_bool active = {false};
+  std::atomic<uint32_t> generation = {0};
+  std::atomic<int64_t> startTime = {0};
+  std::array<std::atomic<uint64_t>, CounterCount> counters = {};
+  std::mutex locker = {};
+  size_t capacity = 0;
+  uint32_t nextThreadID = 0;
+  uint64_t frameIndex = 0;
+  std::vector<std::shared_ptr<TraceBuffer>> buffers = {};
+  std::deque<FrameCounters> frames = {};
+};
+
+static TraceState& GetState() {
+  static auto& state = *new TraceState();
+  return state;
+}
+
+static TraceBuffer* GetThreadBuffer(TraceState& state) {
+  static thread_local std::shared_ptr<TraceBuffer> threadBuffer = nullptr;
+  auto generation = state.generation.load(std::memory_order_acquire);
+  if (threadBuffer == nullptr || threadBuffer->generation != generation) {
+    std::lock_guard<std::mutex> autoLock(state.locker);
+    auto threadID = threadBuffer ? threadBuffer->threadID : state.nextThreadID++;
+    threadBuffer = std::make_shared<TraceBuffer>(threadID, state.generation.load(), state.capacity);
+    state.buffers.push_back(threadBuffer);
+  }
+  return threadBuffer.get();
+}
+
+TraceScope::TraceScope(const char* name, bool active) : name(name) {
+  if (active && GetState().active.load(std::memory_order_relaxed)) {
+    startTime = Clock::Now();
+  }
+}
+
+TraceScope::~TraceScope() {
+  if (startTime < 0) {
+    return;
+  }
+  auto& state = GetState();
+  if (!state.active.load(std::memory_order_relaxed)) {
+    return;
+  }
+  auto endTime = Clock::Now();
+  auto buffer = GetThreadBuffer(state);
+  buffer->addEvent(name, startTime - state.startTime.load(std::memory_order_relaxed),
+                   endTime - startTime);
+}
+
+void TraceCount(TraceCounter counter, uint64_t value) {
+  auto& state = GetState();
+  if (state.active.load(std::memory_order_relaxed)) {
+    state.counters[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+  }
+}
+
+void Tracer::Start(size_t eventsPerThread) {
+  auto& state = GetState();
+  std::lock_guard<std::mutex> autoLock(state.locker);
+  state.active = false;
+  state.buffers.clear();
+  state.frames.clear();
+  for (auto& counter : state.counters) {
+    counter = 0;
+  }
+  state.capacity = std::max(eventsPerThread, static_cast<size_t>(1));
+  state.frameIndex = 0;
+  state.startTime = Clock::Now();
+  state.generation++;
+  state.active = true;
+}
+
+void Tracer::Stop() {
+  GetState().active = false;
+}
+
+bool Tracer::IsActive() {
+  return GetState().active.load(std::memory_order_relaxed);
+}
+
+void Tracer::MarkFrame() {
+  auto& state = GetState();
+  if (!state.active.load(std::memory_order_relaxed)) {
+    return;
+  }
+  FrameCounters frame = {};
+  frame.timestamp = Clock::Now() - state.startTime;
+  for (size_t i = 0; i < CounterCount; i++) {
+    frame.values[i] = state.counters[i].exchange(0, std::memory_order_relaxed);
+  }
+  std::lock_guard<std::mutex> autoLock(state.locker);
+  frame.frameIndex = state.frameIndex++;
+  state.frames.push_back(frame);
+  if (state.frames.size() > MaxFrameCount) {
+    state.frames.pop_front();
+  }
+}
+
+std::vector<FrameCounters> Tracer::GetFrameCounters() {
+  auto& state = GetState();
+  std::lock_guard<std::mutex> autoLock(state.locker);
+  return {state.frames.begin(), state.frames.end()};
+}
+
+static void AppendEvent(std::string* json, const TraceEvent& event, uint32_t threadID) {
+  json->append(R"({"name":")");
+  json->append(event.name);
+  json->append(R"(","cat":"tgfx","ph":"X","pid":1,"tid":)");
+  json->append(std::to_string(threadID));
+  json->append(R"(,"ts":)");
+  json->append(std::to_string(event.startTime));
+  json->append(R"(,"dur":)");
+  json->append(std::to_string(event.duration));
+  json->append("},\n");
+}
+
+static void AppendFrame(std::string* json, const FrameCounters& frame) {
+  json->append(R"({"name":"Frame","cat":"tgfx","ph":"i","s":"g","pid":1,"tid":0,"ts":)");
+  json->append(std::to_string(frame.timestamp));
+  json->append(R"(,"args":{"index":)");
+  json->append(std::to_string(frame.frameIndex));
+  json->append("}},\n");
+  json->append(R"({"name":"FrameCounters","ph":"C","pid":1,"ts":)");
+  json->append(std::to_string(frame.timestamp));
+  json->append(R"(,"args":{)");
+  for (size_t i = 0; i < CounterCount; i++) {
+    if (i > 0) {
+      json->append(",");
+    }
+    json->append("\"");
+    json->append(CounterNames[i]);
+    json->append("\":");
+    json->append(std::to_string(frame.values[i]));
+  }
+  json->append("}},\n");
+}
+
+bool Tracer::WriteChromeTrace(const std::string& filePath) {
+  auto& state = GetState();
+  std::string json = "{\"traceEvents\":[\n";
+  {
+    std::lock_guard<std::mutex> autoLock(state.locker);
+    for (auto& buffer : state.buffers) {
+      auto count = buffer->count.load(std::memory_order_acquire);
+      auto capacity = static_cast<uint64_t>(buffer->events.size());
+      auto first = count > capacity ? count - capacity : 0;
+      for (auto i = first; i < count; i++) {
+        AppendEvent(&json, buffer->events[i % capacity], buffer->threadID);
+      }
+    }
+    for (auto& frame : state.frames) {
+      AppendFrame(&json, frame);
+    }
+  }
+  // The metadata event terminates the list so that every event above can end with a comma.
+  json.append(R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"tgfx"}})");
+  json.append("\n],\"displayTimeUnit\":\"ms\"}\n");
+  auto stream = WriteStream::MakeFromFile(filePath);
+  if (stream == nullptr || !stream->writeText(json)) {
+    return false;
+  }
+  stream->flush();
+  return true;
+}
+}  // namespace tgfx
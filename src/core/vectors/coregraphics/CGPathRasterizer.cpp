@@ -20,6 +20,7 @@
 #include <CoreGraphics/CGBitmapContext.h>
 #include "core/PixelBuffer.h"
 #include "core/utils/GammaCorrection.h"
+#include "core/utils/Profiling.h"
 #include "platform/apple/BitmapContextUtil.h"
 #include "tgfx/core/PathTypes.h"
 
@@ -117,6 +118,7 @@ bool CGPathRasterizer::readPixels(const ImageInfo& dstInfo, void* dstPixels) con
   if (dstPixels == nullptr || dstInfo.isEmpty()) {
     return false;
   }
+  OperateMark("PathRasterizer::readPixels");
   auto path = shape->getPath();
   if (path.isEmpty()) {
     return false;
@@ -22,6 +22,7 @@
 #include "FTRasterTarget.h"
 #include "core/utils/ClearPixels.h"
 #include "core/utils/GammaCorrection.h"
+#include "core/utils/Profiling.h"
 
 namespace tgfx {
 static void Iterator(PathVerb verb, const Point points[4], void* info) {
@@ -60,6 +61,7 @@ bool FTPathRasterizer::readPixels(const ImageInfo& dstInfo, void* dstPixels) con
   if (dstPixels == nullptr || dstInfo.isEmpty()) {
     return false;
   }
+  OperateMark("PathRasterizer::readPixels");
   auto path = shape->getPath();
   if (path.isEmpty()) {
     return false;
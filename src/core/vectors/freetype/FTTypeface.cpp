@@ -22,6 +22,7 @@
 #include FT_TRUETYPE_TABLES_H
 #include "FTScalerContext.h"
 #include "SystemFont.h"
+#include "core/utils/MappedFile.h"
 #include "core/utils/UniqueID.h"
 #include "tgfx/core/UTF.h"
 
@@ -84,6 +85,13 @@ static FT_Face CreateFTFace(const FTFontData& data) {
 }
 
 std::shared_ptr<FTTypeface> FTTypeface::Make(FTFontData data) {
+  if (data.data == nullptr && !data.path.empty()) {
+    // Let FreeType read the font straight from the mapped file instead of through stdio. Mapping
+    // only reserves address space, so the pages of a large font collection are loaded on demand
+    // when FreeType first touches them. The tables are looked up at scattered offsets, so the
+    // readahead is turned off. The mapping lives as long as the typeface.
+    data.data = MapFile(data.path, FileAccess::Random);
+  }
   auto face = CreateFTFace(data);
   if (face == nullptr) {
     return nullptr;
@@ -19,6 +19,7 @@
 #include "WebPathRasterizer.h"
 #include <emscripten/val.h>
 #include "ReadPixelsFromCanvasImage.h"
+#include "core/utils/Profiling.h"
 
 using namespace emscripten;
 
@@ -60,6 +61,7 @@ bool WebPathRasterizer::readPixels(const ImageInfo& dstInfo, void* dstPixels) co
   if (dstPixels == nullptr || dstInfo.isEmpty()) {
     return false;
   }
+  OperateMark("PathRasterizer::readPixels");
   auto path = shape->getPath();
   if (path.isEmpty()) {
     return false;
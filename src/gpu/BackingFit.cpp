@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "BackingFit.h"
+#include <algorithm>
+#include "core/utils/MathExtra.h"
+
+namespace tgfx {
+static constexpr int MinApproxSize = 16;
+static constexpr int MagicTol = 1024;
+static constexpr int MaxApproxAreaScale = 2;
+
+int GetApproxSize(int value) {
+  value = std::max(MinApproxSize, value);
+  if (IsPow2(value)) {
+    return value;
+  }
+  int ceilPow2 = NextPow2(value);
+  if (value <= MagicTol) {
+    return ceilPow2;
+  }
+  int floorPow2 = ceilPow2 >> 1;
+  int mid = floorPow2 + (floorPow2 >> 1);
+  if (value <= mid) {
+    return mid;
+  }
+  return ceilPow2;
+}
+
+std::vector<ISize> GetApproxSizes(int width, int height, int maxSize) {
+  auto baseWidth = std::min(GetApproxSize(width), std::max(width, maxSize));
+  auto baseHeight = std::min(GetApproxSize(height), std::max(height, maxSize));
+  std::vector<ISize> sizes = {ISize::Make(baseWidth, baseHeight)};
+  auto maxArea = static_cast<int64_t>(baseWidth) * baseHeight * MaxApproxAreaScale;
+  for (int w = baseWidth; w <= maxSize; w = GetApproxSize(w + 1)) {
+    if (static_cast<int64_t>(w) * baseHeight > maxArea) {
+      break;
+    }
+    for (int h = baseHeight; h <= maxSize; h = GetApproxSize(h + 1)) {
+      if (static_cast<int64_t>(w) * h > maxArea) {
+        break;
+      }
+      if (w != baseWidth || h != baseHeight) {
+        sizes.push_back(ISize::Make(w, h));
+      }
+    }
+  }
+  std::stable_sort(sizes.begin() + 1, sizes.end(), [](const ISize& a, const ISize& b) {
+    return static_cast<int64_t>(a.width) * a.height < static_cast<int64_t>(b.width) * b.height;
+  });
+  return sizes;
+}
+}  // namespace tgfx
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <vector>
+#include "tgfx/core/Size.h"
+
 namespace tgfx {
 /**
  * Indicates whether a backing store needs to be an exact match or can be larger than is strictly
@@ -34,4 +37,19 @@ enum class BackingFit {
    */
   Approx = 1,
 };
+
+/**
+ * Maps the value to a larger size class. Values <= 1024 pop up to the next power of 2, and those
+ * above 1024 only go up half the floor power of 2.
+ */
+int GetApproxSize(int value);
+
+/**
+ * Returns the backing store sizes that can hold a width x height texture created with
+ * BackingFit::Approx, sorted by area from the smallest. The first one is the approximate size of
+ * the request itself, the rest are neighbouring size classes whose area is at most twice as large.
+ * Reusing an idle texture from any of them bounds the wasted memory while letting requests of
+ * slightly varying sizes share the same scratch textures. Sizes larger than maxSize are skipped.
+ */
+std::vector<ISize> GetApproxSizes(int width, int height, int maxSize);
 }  // namespace tgfx
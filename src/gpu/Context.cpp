@@ -20,6 +20,7 @@
 #include "core/AtlasManager.h"
 #include "core/utils/BlockBuffer.h"
 #include "core/utils/Log.h"
+#include "core/utils/Profiling.h"
 #include "core/utils/SlidingWindowTracker.h"
 #include "gpu/DrawingManager.h"
 #include "gpu/GlobalCache.h"
@@ -76,6 +77,7 @@ bool Context::flush(BackendSemaphore* signalSemaphore) {
     _resourceCache->advanceFrameAndPurge();
     _maxValueTracker->addValue(_drawingBuffer->size());
     _drawingBuffer->clear(_maxValueTracker->getMaxValue());
+    FrameMark;
   }
   return semaphoreInserted;
 }
@@ -129,10 +131,39 @@ bool Context::purgeResourcesUntilMemoryTo(size_t bytesLimit) {
   return _resourceCache->purgeUntilMemoryTo(bytesLimit);
 }
 
+size_t Context::cacheLimit(ResourceCategory category) const {
+  return _resourceCache->cacheLimit(category);
+}
+
+void Context::setCacheLimit(ResourceCategory category, size_t bytesLimit) {
+  _resourceCache->setCacheLimit(category, bytesLimit);
+}
+
+void Context::onMemoryPressure(MemoryPressureLevel level) {
+  _resourceCache->purgeScratchResourcesTo(0);
+  if (level == MemoryPressureLevel::Low) {
+    return;
+  }
+  _resourceCache->purgeCategory(ResourceCategory::RenderTarget);
+  if (level == MemoryPressureLevel::Moderate) {
+    return;
+  }
+  // Pending draws keep their own references to the atlas textures, so the atlases can be dropped
+  // safely and will be rebuilt by the next text drawing.
+  _atlasManager->releaseAll();
+  _resourceCache->purgeCategory(ResourceCategory::Atlas);
+  _resourceCache->purgeUntilMemoryTo(0);
+}
+
+MemoryStats Context::memoryStats() const {
+  return _resourceCache->memoryStats();
+}
+
 void Context::releaseAll(bool releaseGPU) {
   _drawingManager->releaseAll();
   _atlasManager->releaseAll();
   _globalCache->releaseAll();
+  _proxyProvider->releaseAll(releaseGPU);
   _resourceCache->releaseAll(releaseGPU);
 }
 }  // namespace tgfx
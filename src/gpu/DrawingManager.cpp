@@ -20,6 +20,7 @@
 #include "ProxyProvider.h"
 #include "core/AtlasCellDecodeTask.h"
 #include "core/AtlasManager.h"
+#include "core/utils/Profiling.h"
 #include "gpu/proxies/RenderTargetProxy.h"
 #include "gpu/proxies/TextureProxy.h"
 #include "gpu/tasks/RenderTargetCopyTask.h"
@@ -123,6 +124,7 @@ void DrawingManager::addResourceTask(PlacementPtr<ResourceTask> resourceTask,
 }
 
 bool DrawingManager::flush() {
+  OperateMark("DrawingManager::flush");
   while (!compositors.empty()) {
     auto compositor = compositors.back();
     // The makeClosed() method may add more compositors to the list.
@@ -148,7 +150,12 @@ bool DrawingManager::flush() {
   if (renderPass == nullptr) {
     renderPass = RenderPass::Make(context);
   }
-  for (auto& task : renderTasks) {
+  // Textures of proxies are created lazily when the first task using them executes, and they return
+  // to the scratch pool once the last task referencing them is released. Executing the tasks in
+  // dependency order therefore lets intermediate render targets with non-overlapping lifetimes
+  // share the same physical textures.
+  for (auto index : sortRenderTasks()) {
+    auto& task = renderTasks[index];
     task->execute(renderPass.get());
     task = nullptr;
   }
@@ -156,6 +163,16 @@ bool DrawingManager::flush() {
   return true;
 }
 
+std::vector<size_t> DrawingManager::sortRenderTasks() const {
+  RenderTaskGraph graph = {};
+  for (auto& task : renderTasks) {
+    RenderTaskProxies proxies = {};
+    task->collectProxies(&proxies);
+    graph.addTask(std::move(proxies));
+  }
+  return graph.sort();
+}
+
 void DrawingManager::releaseAll() {
   compositors.clear();
   resourceTasks.clear();
@@ -90,6 +90,8 @@ class DrawingManager {
 
   void clearAtlasCellCodecTasks();
 
+  std::vector<size_t> sortRenderTasks() const;
+
   friend class OpsCompositor;
 };
 }  // namespace tgfx
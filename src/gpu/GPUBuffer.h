@@ -47,6 +47,10 @@ class GPUBuffer : public Resource {
   BufferType _bufferType;
   size_t _size;
 
+  ResourceCategory defaultCategory() const override {
+    return ResourceCategory::Buffer;
+  }
+
   GPUBuffer(BufferType bufferType, size_t sizeInBytes)
       : _bufferType(bufferType), _size(sizeInBytes) {
   }
@@ -18,6 +18,7 @@
 
 #include "GlobalCache.h"
 #include "core/PixelBuffer.h"
+#include "core/utils/Profiling.h"
 #include "gpu/GradientGenerator.h"
 #include "gpu/ProxyProvider.h"
 #include "gpu/ops/RRectDrawOp.h"
@@ -44,6 +45,8 @@ std::shared_ptr<Program> GlobalCache::getProgram(const ProgramCreator* programCr
     program->cachedPosition = programLRU.begin();
     return program;
   }
+  OperateMark("GlobalCache::createProgram");
+  CounterMark(ProgramCompiles, 1);
   auto newProgram = programCreator->createProgram(context);
   if (newProgram == nullptr) {
     return nullptr;
@@ -95,6 +98,7 @@ std::shared_ptr<TextureProxy> GlobalCache::getGradient(const Color* colors, cons
   if (textureProxy == nullptr) {
     return nullptr;
   }
+  textureProxy->setResourceCategory(ResourceCategory::Gradient);
   auto gradientTexture = std::make_unique<GradientTexture>(textureProxy, bytesKey);
   gradientLRU.push_front(gradientTexture.get());
   gradientTexture->cachedPosition = gradientLRU.begin();
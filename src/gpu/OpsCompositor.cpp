@@ -188,10 +188,31 @@ void OpsCompositor::fillShape(std::shared_ptr<Shape> shape, const MCState& state
     deviceBounds = shape->isInverseFillType() ? clipBounds : shape->getBounds();
   }
   auto aaType = getAAType(fill);
-  auto shapeProxy = proxyProvider()->createGPUShapeProxy(shape, aaType, clipBounds, renderFlags);
-  auto drawOp =
-      ShapeDrawOp::Make(std::move(shapeProxy), fill.color.premultiply(), uvMatrix, aaType);
-  addDrawOp(std::move(drawOp), clip, fill, localBounds, deviceBounds);
+  // Large shapes are split into tiles, and only the tiles visible in the clip are drawn.
+  auto shapeProxies =
+      proxyProvider()->createGPUShapeProxies(std::move(shape), aaType, clipBounds, renderFlags);
+  auto color = fill.color.premultiply();
+  for (auto& shapeProxy : shapeProxies) {
+    auto tileLocalBounds = localBounds;
+    auto tileDeviceBounds = deviceBounds;
+    if (auto textureProxy = shapeProxy->getTextureProxy()) {
+      // Narrow the bounds to the part of the shape covered by this tile, so a blend mode that
+      // reads the destination only copies the pixels under the tile.
+      auto tileBounds = Rect::MakeWH(textureProxy->width(), textureProxy->height());
+      shapeProxy->getDrawingMatrix().mapRect(&tileBounds);
+      if (!tileBounds.intersect(clipBounds)) {
+        continue;
+      }
+      if (tileLocalBounds.has_value()) {
+        tileLocalBounds = ClipLocalBounds(*tileLocalBounds, state.matrix, tileBounds);
+      }
+      if (tileDeviceBounds.has_value() && !tileDeviceBounds->intersect(tileBounds)) {
+        continue;
+      }
+    }
+    auto drawOp = ShapeDrawOp::Make(std::move(shapeProxy), color, uvMatrix, aaType);
+    addDrawOp(std::move(drawOp), clip, fill, tileLocalBounds, tileDeviceBounds);
+  }
 }
 
 void OpsCompositor::discardAll() {
@@ -264,6 +285,24 @@ static bool IsPixelAligned(const Rect& rect) {
          fabsf(roundf(rect.bottom) - rect.bottom) <= BOUNDS_TOLERANCE;
 }
 
+/**
+ * Returns true if every rect has an opaque color. If checkAlignment is true, each rect must also
+ * land on pixel boundaries, where antialiasing leaves no partially covered pixels.
+ */
+static bool AllRectsAreOpaque(const std::vector<PlacementPtr<RectRecord>>& rects,
+                              bool checkAlignment) {
+  for (auto& record : rects) {
+    if (record->color.alpha != 1.0f) {
+      return false;
+    }
+    if (checkAlignment && (!record->viewMatrix.rectStaysRect() ||
+                           !IsPixelAligned(record->viewMatrix.mapRect(record->rect)))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 static bool RRectUseScale(Context* context) {
   return !context->caps()->floatIs32Bits;
 }
@@ -342,6 +381,17 @@ void OpsCompositor::flushPendingOps(PendingOpType type, Path clip, Fill fill) {
     }
   }
 
+  bool opaqueSource = false;
+  if (pendingType == PendingOpType::Rect && pendingFill.blendMode == BlendMode::SrcOver &&
+      pendingFill.isOpaque() && AllRectsAreOpaque(pendingRects, aaType == AAType::Coverage)) {
+    // Pixel-aligned rects get the same result without antialiasing, which also lets them replace
+    // the destination instead of blending with it.
+    if (aaType == AAType::Coverage) {
+      aaType = AAType::None;
+    }
+    opaqueSource = true;
+  }
+
   switch (pendingType) {
     case PendingOpType::Rect:
       if (pendingRects.size() == 1) {
@@ -390,7 +440,7 @@ void OpsCompositor::flushPendingOps(PendingOpType type, Path clip, Fill fill) {
     }
     drawOp->addColorFP(std::move(processor));
   }
-  addDrawOp(std::move(drawOp), pendingClip, pendingFill, localBounds, deviceBounds);
+  addDrawOp(std::move(drawOp), pendingClip, pendingFill, localBounds, deviceBounds, opaqueSource);
 }
 
 static void FlipYIfNeeded(Rect* rect, const RenderTargetProxy* renderTarget) {
@@ -629,7 +679,7 @@ DstTextureInfo OpsCompositor::makeDstTextureInfo(const Rect& deviceBounds, AATyp
 
 void OpsCompositor::addDrawOp(PlacementPtr<DrawOp> op, const Path& clip, const Fill& fill,
                               const std::optional<Rect>& localBounds,
-                              const std::optional<Rect>& deviceBounds) {
+                              const std::optional<Rect>& deviceBounds, bool opaqueSource) {
   if (op == nullptr || fill.nothingToDraw() || (clip.isEmpty() && !clip.isInverseFillType())) {
     return;
   }
@@ -671,14 +721,20 @@ void OpsCompositor::addDrawOp(PlacementPtr<DrawOp> op, const Path& clip, const F
     op->addCoverageFP(std::move(clipMask));
   }
   op->setScissorRect(scissorRect);
-  op->setBlendMode(fill.blendMode);
-  if (BlendModeNeedDstTexture(fill.blendMode, op->hasCoverage())) {
+  auto blendMode = fill.blendMode;
+  if (opaqueSource && blendMode == BlendMode::SrcOver && !op->hasCoverage()) {
+    // An opaque source that fully covers its pixels overwrites the destination anyway, so the
+    // blending can be turned off.
+    blendMode = BlendMode::Src;
+  }
+  op->setBlendMode(blendMode);
+  if (BlendModeNeedDstTexture(blendMode, op->hasCoverage())) {
     auto dstTextureInfo = makeDstTextureInfo(deviceBounds.value_or(Rect::MakeEmpty()), aaType);
     if (!context->caps()->frameBufferFetchSupport && dstTextureInfo.textureProxy == nullptr) {
       return;
     }
     auto xferProcessor =
-        PorterDuffXferProcessor::Make(drawingBuffer(), fill.blendMode, std::move(dstTextureInfo));
+        PorterDuffXferProcessor::Make(drawingBuffer(), blendMode, std::move(dstTextureInfo));
     op->setXferProcessor(std::move(xferProcessor));
   }
   ops.emplace_back(std::move(op));
@@ -695,4 +751,28 @@ void OpsCompositor::fillTextAtlas(std::shared_ptr<TextureProxy> textureProxy, co
   auto record = drawingBuffer()->make<RectRecord>(rect, state.matrix, fill.color.premultiply());
   pendingRects.emplace_back(std::move(record));
 }
+
+void OpsCompositor::fillTextAtlasQuads(const std::shared_ptr<TextureProxy>& textureProxy,
+                                       const AtlasQuad* quads, size_t count, const MCState& state,
+                                       const Fill& fill) {
+  DEBUG_ASSERT(textureProxy != nullptr);
+  auto color = fill.color.premultiply();
+  size_t index = 0;
+  while (index < count) {
+    if (!canAppend(PendingOpType::Atlas, state.clip, fill) || pendingAtlasTexture != textureProxy) {
+      flushPendingOps(PendingOpType::Atlas, state.clip, fill);
+      pendingAtlasTexture = textureProxy;
+    }
+    auto batchCount = std::min(count - index, RectDrawOp::MaxNumRects - pendingRects.size());
+    pendingRects.reserve(pendingRects.size() + batchCount);
+    for (auto end = index + batchCount; index < end; index++) {
+      auto& quad = quads[index];
+      auto viewMatrix = quad.matrix;
+      viewMatrix.postConcat(state.matrix);
+      viewMatrix.preTranslate(-quad.rect.x(), -quad.rect.y());
+      auto record = drawingBuffer()->make<RectRecord>(quad.rect, viewMatrix, color);
+      pendingRects.emplace_back(std::move(record));
+    }
+  }
+}
 }  // namespace tgfx
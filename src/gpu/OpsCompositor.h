@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "core/DirectMaskCache.h"
 #include "core/MCState.h"
 #include "gpu/ops/RRectDrawOp.h"
 #include "gpu/ops/RectDrawOp.h"
@@ -80,6 +81,13 @@ class OpsCompositor {
   void fillTextAtlas(std::shared_ptr<TextureProxy> textureProxy, const Rect& rect,
                      const MCState& state, const Fill& fill);
 
+  /**
+   * Fills a batch of atlas quads from the same texture proxy. Each quad's matrix is concatenated
+   * with the state matrix. This is the bulk version of fillTextAtlas() for cached glyph runs.
+   */
+  void fillTextAtlasQuads(const std::shared_ptr<TextureProxy>& textureProxy, const AtlasQuad* quads,
+                          size_t count, const MCState& state, const Fill& fill);
+
   /**
    * Discard all pending operations.
    */
@@ -143,7 +151,8 @@ class OpsCompositor {
                                                                  Rect* scissorRect);
   DstTextureInfo makeDstTextureInfo(const Rect& deviceBounds, AAType aaType);
   void addDrawOp(PlacementPtr<DrawOp> op, const Path& clip, const Fill& fill,
-                 const std::optional<Rect>& localBounds, const std::optional<Rect>& deviceBounds);
+                 const std::optional<Rect>& localBounds, const std::optional<Rect>& deviceBounds,
+                 bool opaqueSource = false);
 
   friend class DrawingManager;
   friend class PendingOpsAutoReset;
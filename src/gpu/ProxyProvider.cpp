@@ -17,6 +17,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ProxyProvider.h"
+#include <algorithm>
+#include <cmath>
 #include "core/ShapeRasterizer.h"
 #include "core/shapes/MatrixShape.h"
 #include "core/utils/MathExtra.h"
@@ -33,6 +35,10 @@
 #include "tgfx/core/RenderFlags.h"
 
 namespace tgfx {
+// The initial and maximum sizes of a single region of the vertex ring buffer.
+static constexpr size_t MinVertexRingRegionSize = 1 << 20;  // 1MB
+static constexpr size_t MaxVertexRingRegionSize = 1 << 24;  // 16MB
+
 ProxyProvider::ProxyProvider(Context* context)
     : context(context), vertexBlockBuffer(1 << 14, 1 << 21) {  // 16kb, 2MB
 }
@@ -79,13 +85,19 @@ std::shared_ptr<VertexBufferProxy> ProxyProvider::createVertexBuffer(
   }
   DEBUG_ASSERT(!sharedVertexBufferFlushed);
   auto byteSize = provider->vertexCount() * sizeof(float);
+  size_t offset = 0;
+  auto vertices = allocateRingVertices(byteSize, &offset);
+  if (vertices != nullptr) {
+    writeVertices(std::move(provider), vertices, renderFlags, &ringVertexBufferTasks);
+    return std::make_shared<VertexBufferProxy>(ringVertexBuffer, offset, byteSize);
+  }
   auto lastBlock = vertexBlockBuffer.currentBlock();
-  auto vertices = reinterpret_cast<float*>(vertexBlockBuffer.allocate(byteSize));
+  vertices = reinterpret_cast<float*>(vertexBlockBuffer.allocate(byteSize));
   if (vertices == nullptr) {
     LOGE("ProxyProvider::createVertexBuffer() Failed to allocate memory!");
     return nullptr;
   }
-  auto offset = lastBlock.second;
+  offset = lastBlock.second;
   auto currentBlock = vertexBlockBuffer.currentBlock();
   if (lastBlock.first != nullptr && lastBlock.first != currentBlock.first) {
     DEBUG_ASSERT(sharedVertexBuffer != nullptr);
@@ -93,23 +105,61 @@ std::shared_ptr<VertexBufferProxy> ProxyProvider::createVertexBuffer(
     uploadSharedVertexBuffer(std::move(data));
     offset = 0;
   }
+  writeVertices(std::move(provider), vertices, renderFlags, &sharedVertexBufferTasks);
+  if (sharedVertexBuffer == nullptr) {
+    sharedVertexBuffer = std::shared_ptr<GPUBufferProxy>(new GPUBufferProxy(BufferType::Vertex));
+    addResourceProxy(sharedVertexBuffer);
+  }
+  return std::make_shared<VertexBufferProxy>(sharedVertexBuffer, offset, byteSize);
+}
+
+float* ProxyProvider::allocateRingVertices(size_t byteSize, size_t* offset) {
+  if (!vertexRingBufferChecked) {
+    vertexRingBufferChecked = true;
+    resetVertexRingBuffer(MinVertexRingRegionSize);
+  }
+  if (vertexRingBuffer == nullptr) {
+    return nullptr;
+  }
+  ringVertexBytes += byteSize;
+  auto vertices = reinterpret_cast<float*>(vertexRingBuffer->allocate(byteSize, offset));
+  if (vertices == nullptr) {
+    // The remaining vertices of this flush go to the block buffer, and the ring grows afterward.
+    ringVertexBufferOverflowed = true;
+  }
+  return vertices;
+}
+
+void ProxyProvider::writeVertices(PlacementPtr<VertexProvider> provider, float* vertices,
+                                  uint32_t renderFlags,
+                                  std::vector<std::shared_ptr<Task>>* tasks) {
 #ifdef TGFX_USE_THREADS
   if (renderFlags & RenderFlags::DisableAsyncTask) {
     provider->getVertices(vertices);
   } else {
     auto task = std::make_shared<VertexProviderTask>(std::move(provider), vertices);
     Task::Run(task);
-    sharedVertexBufferTasks.push_back(std::move(task));
+    tasks->push_back(std::move(task));
   }
 #else
   USE(renderFlags);
+  USE(tasks);
   provider->getVertices(vertices);
 #endif
-  if (sharedVertexBuffer == nullptr) {
-    sharedVertexBuffer = std::shared_ptr<GPUBufferProxy>(new GPUBufferProxy(BufferType::Vertex));
-    addResourceProxy(sharedVertexBuffer);
+}
+
+void ProxyProvider::resetVertexRingBuffer(size_t regionSize) {
+  if (vertexRingBuffer != nullptr) {
+    // Proxies created in the current flush keep the old buffer alive until they are executed.
+    vertexRingBuffer->release(true);
+  }
+  vertexRingBuffer = VertexRingBuffer::Make(context, regionSize);
+  ringVertexBuffer = nullptr;
+  if (vertexRingBuffer != nullptr) {
+    ringVertexBuffer = std::shared_ptr<GPUBufferProxy>(new GPUBufferProxy(BufferType::Vertex));
+    ringVertexBuffer->resource = vertexRingBuffer->buffer();
+    addResourceProxy(ringVertexBuffer);
   }
-  return std::make_shared<VertexBufferProxy>(sharedVertexBuffer, offset, byteSize);
 }
 
 void ProxyProvider::flushSharedVertexBuffer() {
@@ -122,11 +172,40 @@ void ProxyProvider::flushSharedVertexBuffer() {
 }
 
 void ProxyProvider::clearSharedVertexBuffer() {
+  for (auto& task : ringVertexBufferTasks) {
+    task->wait();
+  }
+  ringVertexBufferTasks.clear();
+  if (vertexRingBuffer != nullptr) {
+    vertexRingBuffer->unmap();
+    auto regionSize = vertexRingBuffer->regionSize();
+    if (ringVertexBufferOverflowed && regionSize < MaxVertexRingRegionSize) {
+      while (regionSize < ringVertexBytes && regionSize < MaxVertexRingRegionSize) {
+        regionSize *= 2;
+      }
+      resetVertexRingBuffer(regionSize);
+    }
+  }
+  ringVertexBytes = 0;
+  ringVertexBufferOverflowed = false;
   maxValueTracker.addValue(vertexBlockBuffer.size());
   vertexBlockBuffer.clear(maxValueTracker.getMaxValue());
   sharedVertexBufferFlushed = false;
 }
 
+void ProxyProvider::releaseAll(bool releaseGPU) {
+  for (auto& task : ringVertexBufferTasks) {
+    task->cancel();
+  }
+  ringVertexBufferTasks.clear();
+  if (vertexRingBuffer != nullptr) {
+    vertexRingBuffer->release(releaseGPU);
+    vertexRingBuffer = nullptr;
+  }
+  ringVertexBuffer = nullptr;
+  vertexRingBufferChecked = false;
+}
+
 void ProxyProvider::uploadSharedVertexBuffer(std::shared_ptr<Data> data) {
   DEBUG_ASSERT(sharedVertexBuffer != nullptr);
   auto dataSource =
@@ -148,6 +227,87 @@ static UniqueKey AppendClipBoundsKey(const UniqueKey& uniqueKey, const Rect& cli
   return UniqueKey::Append(uniqueKey, bytesKey.data(), bytesKey.size());
 }
 
+static UniqueKey AppendNonAntialiasKey(const UniqueKey& uniqueKey) {
+  static const auto NonAntialiasShapeType = UniqueID::Next();
+  return UniqueKey::Append(uniqueKey, &NonAntialiasShapeType, 1);
+}
+
+static constexpr float ShapeScaleBucketsPerOctave = 8.0f;
+static constexpr size_t MaxScalesPerShape = 8;
+static constexpr size_t MaxShapeScaleEntries = 4096;
+static constexpr size_t MaxPendingShapeTasks = 32;
+
+/**
+ * A shape split into a base shape scaled by a uniform factor and the remaining matrix that maps
+ * the scaled shape to the device. The scaled shape is what gets rasterized and cached, while the
+ * drawing matrix is applied when drawing the cache.
+ */
+struct ScaledShape {
+  std::shared_ptr<Shape> shape = nullptr;
+  // The shape without the uniform scale, or nullptr if no scale was extracted.
+  std::shared_ptr<Shape> baseShape = nullptr;
+  float scale = 1.0f;
+  Matrix drawingMatrix = {};
+};
+
+static float QuantizeScale(float scale) {
+  auto bucket = std::round(std::log2(scale) * ShapeScaleBucketsPerOctave);
+  return std::exp2(bucket / ShapeScaleBucketsPerOctave);
+}
+
+static ScaledShape ExtractDrawingMatrix(std::shared_ptr<Shape> shape, bool quantizeScale = false) {
+  if (shape->type() != Shape::Type::Matrix || shape->isInverseFillType()) {
+    return {std::move(shape)};
+  }
+  auto matrixShape = std::static_pointer_cast<MatrixShape>(shape);
+  auto scales = matrixShape->matrix.getAxisScales();
+  if (scales.x != scales.y) {
+    return {std::move(shape)};
+  }
+  DEBUG_ASSERT(scales.x != 0);
+  auto scale = quantizeScale ? QuantizeScale(scales.x) : scales.x;
+  ScaledShape result = {};
+  result.baseShape = matrixShape->shape;
+  result.scale = scale;
+  result.shape = Shape::ApplyMatrix(result.baseShape, Matrix::MakeScale(scale));
+  result.drawingMatrix = matrixShape->matrix;
+  result.drawingMatrix.preScale(1.0f / scale, 1.0f / scale);
+  return result;
+}
+
+static UniqueKey AppendTileKey(const UniqueKey& uniqueKey, int tileX, int tileY) {
+  static const auto TiledShapeType = UniqueID::Next();
+  BytesKey bytesKey(3);
+  bytesKey.write(TiledShapeType);
+  bytesKey.write(static_cast<uint32_t>(tileX));
+  bytesKey.write(static_cast<uint32_t>(tileY));
+  return UniqueKey::Append(uniqueKey, bytesKey.data(), bytesKey.size());
+}
+
+static UniqueKey GetShapeKey(const Shape* shape, AAType aaType) {
+  auto uniqueKey = shape->getUniqueKey();
+  return aaType == AAType::None ? AppendNonAntialiasKey(uniqueKey) : uniqueKey;
+}
+
+static Rect GetShapeBounds(const Shape* shape, AAType aaType) {
+  auto bounds = shape->getBounds();
+  if (aaType != AAType::None) {
+    // Add a 1-pixel outset to preserve antialiasing results.
+    bounds.outset(1.0f, 1.0f);
+  }
+  return bounds;
+}
+
+static UniqueKey GetTriangleKey(const UniqueKey& uniqueKey) {
+  static const auto TriangleShapeType = UniqueID::Next();
+  return UniqueKey::Append(uniqueKey, &TriangleShapeType, 1);
+}
+
+static UniqueKey GetTextureKey(const UniqueKey& uniqueKey) {
+  static const auto TextureShapeType = UniqueID::Next();
+  return UniqueKey::Append(uniqueKey, &TextureShapeType, 1);
+}
+
 std::shared_ptr<GPUShapeProxy> ProxyProvider::createGPUShapeProxy(std::shared_ptr<Shape> shape,
                                                                   AAType aaType,
                                                                   const Rect& clipBounds,
@@ -155,72 +315,256 @@ std::shared_ptr<GPUShapeProxy> ProxyProvider::createGPUShapeProxy(std::shared_pt
   if (shape == nullptr) {
     return nullptr;
   }
-  Matrix drawingMatrix = {};
   auto isInverseFillType = shape->isInverseFillType();
-  if (shape->type() == Shape::Type::Matrix && !isInverseFillType) {
-    auto matrixShape = std::static_pointer_cast<MatrixShape>(shape);
-    auto scales = matrixShape->matrix.getAxisScales();
-    if (scales.x == scales.y) {
-      DEBUG_ASSERT(scales.x != 0);
-      drawingMatrix = matrixShape->matrix;
-      drawingMatrix.preScale(1.0f / scales.x, 1.0f / scales.x);
-      shape = Shape::ApplyMatrix(matrixShape->shape, Matrix::MakeScale(scales.x));
-    }
-  }
-  auto shapeBounds = shape->getBounds();
-  auto uniqueKey = shape->getUniqueKey();
+  auto scaled = ExtractDrawingMatrix(std::move(shape));
+  auto uniqueKey = scaled.shape->getUniqueKey();
   if (isInverseFillType) {
+    auto shapeBounds = scaled.shape->getBounds();
     uniqueKey =
         AppendClipBoundsKey(uniqueKey, clipBounds.makeOffset(-shapeBounds.left, -shapeBounds.top));
   }
-  if (aaType != AAType::None) {
-    // Add a 1-pixel outset to preserve antialiasing results.
-    shapeBounds.outset(1.0f, 1.0f);
-  } else {
-    static const auto NonAntialiasShapeType = UniqueID::Next();
-    uniqueKey = UniqueKey::Append(uniqueKey, &NonAntialiasShapeType, 1);
+  if (aaType == AAType::None) {
+    uniqueKey = AppendNonAntialiasKey(uniqueKey);
   }
-  auto bounds = isInverseFillType ? clipBounds : shapeBounds;
-  drawingMatrix.preTranslate(bounds.x(), bounds.y());
-  static const auto TriangleShapeType = UniqueID::Next();
-  static const auto TextureShapeType = UniqueID::Next();
-  auto triangleKey = UniqueKey::Append(uniqueKey, &TriangleShapeType, 1);
+  auto bounds = isInverseFillType ? clipBounds : GetShapeBounds(scaled.shape.get(), aaType);
+  return createShapeProxy(uniqueKey, std::move(scaled.shape), bounds, scaled.drawingMatrix, aaType,
+                          false, renderFlags);
+}
+
+std::vector<std::shared_ptr<GPUShapeProxy>> ProxyProvider::createGPUShapeProxies(
+    std::shared_ptr<Shape> shape, AAType aaType, const Rect& clipBounds, uint32_t renderFlags) {
+  if (shape == nullptr) {
+    return {};
+  }
+  if (shape->isInverseFillType()) {
+    return {createGPUShapeProxy(std::move(shape), aaType, clipBounds, renderFlags)};
+  }
+  auto scaled = ExtractDrawingMatrix(std::move(shape), shapeScaleFallback);
+  auto shapeBounds = GetShapeBounds(scaled.shape.get(), aaType);
+  auto uniqueKey = GetShapeKey(scaled.shape.get(), aaType);
+  if (shapeBounds.width() <= TiledShapeThreshold && shapeBounds.height() <= TiledShapeThreshold) {
+    if (scaled.baseShape != nullptr) {
+      auto baseKey = GetShapeKey(scaled.baseShape.get(), aaType);
+      auto shapeProxy = findShapeScaleFallback(scaled, baseKey, uniqueKey, shapeBounds, aaType);
+      if (shapeProxy != nullptr) {
+        return {std::move(shapeProxy)};
+      }
+      addShapeScale(baseKey, scaled.scale);
+    }
+    return {createShapeProxy(uniqueKey, std::move(scaled.shape), shapeBounds, scaled.drawingMatrix,
+                             aaType, false, renderFlags)};
+  }
+  Matrix inverseMatrix = {};
+  if (!scaled.drawingMatrix.invert(&inverseMatrix)) {
+    return {};
+  }
+  // The tile grid is anchored at the origin of the shape's coordinate space rather than the device,
+  // so the tiles keep their keys while the shape is translated, e.g. when panning.
+  shapeBounds.roundOut();
+  auto visibleBounds = inverseMatrix.mapRect(clipBounds);
+  if (!visibleBounds.intersect(shapeBounds)) {
+    return {};
+  }
+  auto tileSize = static_cast<float>(ShapeTileSize);
+  auto startX = static_cast<int>(floorf(visibleBounds.left / tileSize));
+  auto startY = static_cast<int>(floorf(visibleBounds.top / tileSize));
+  auto endX = static_cast<int>(ceilf(visibleBounds.right / tileSize));
+  auto endY = static_cast<int>(ceilf(visibleBounds.bottom / tileSize));
+  std::vector<std::shared_ptr<GPUShapeProxy>> shapeProxies = {};
+  shapeProxies.reserve(static_cast<size_t>(endX - startX) * static_cast<size_t>(endY - startY));
+  for (int tileY = startY; tileY < endY; tileY++) {
+    for (int tileX = startX; tileX < endX; tileX++) {
+      auto tileBounds = Rect::MakeXYWH(static_cast<float>(tileX) * tileSize,
+                                       static_cast<float>(tileY) * tileSize, tileSize, tileSize);
+      if (!tileBounds.intersect(shapeBounds)) {
+        continue;
+      }
+      auto tileKey = AppendTileKey(uniqueKey, tileX, tileY);
+      auto shapeProxy = createShapeProxy(tileKey, scaled.shape, tileBounds, scaled.drawingMatrix,
+                                         aaType, true, renderFlags);
+      if (shapeProxy != nullptr) {
+        shapeProxies.push_back(std::move(shapeProxy));
+      }
+    }
+  }
+  return shapeProxies;
+}
+
+std::shared_ptr<GPUShapeProxy> ProxyProvider::findShapeProxy(const UniqueKey& uniqueKey,
+                                                             const Matrix& drawingMatrix) {
   // The triangle and texture proxies might be created by previous tasks that are still in progress.
   // One of them might not have the corresponding resources in the cache yet, so we need to wrap
   // both of them into the GPUShapeProxy.
-  auto triangleProxy = findOrWrapGPUBufferProxy(triangleKey);
-  auto textureKey = UniqueKey::Append(uniqueKey, &TextureShapeType, 1);
-  auto textureProxy = findOrWrapTextureProxy(textureKey);
-  if (triangleProxy != nullptr || textureProxy != nullptr) {
-    return std::make_shared<GPUShapeProxy>(drawingMatrix, std::move(triangleProxy),
-                                           std::move(textureProxy));
+  auto triangleProxy = findOrWrapGPUBufferProxy(GetTriangleKey(uniqueKey));
+  auto textureProxy = findOrWrapTextureProxy(GetTextureKey(uniqueKey));
+  if (triangleProxy == nullptr && textureProxy == nullptr) {
+    return nullptr;
+  }
+  return std::make_shared<GPUShapeProxy>(drawingMatrix, std::move(triangleProxy),
+                                         std::move(textureProxy));
+}
+
+std::shared_ptr<GPUShapeProxy> ProxyProvider::findShapeScaleFallback(const ScaledShape& scaled,
+                                                                     const UniqueKey& baseKey,
+                                                                     const UniqueKey& uniqueKey,
+                                                                     const Rect& bounds,
+                                                                     AAType aaType) {
+  if (!shapeScaleFallback) {
+    return nullptr;
+  }
+  auto boundsMatrix = scaled.drawingMatrix;
+  boundsMatrix.preTranslate(bounds.x(), bounds.y());
+  if (auto shapeProxy = findShapeProxy(uniqueKey, boundsMatrix)) {
+    return shapeProxy;
+  }
+  auto pendingTask = pendingShapeTasks.find(uniqueKey);
+  if (pendingTask != pendingShapeTasks.end() &&
+      pendingTask->second->status() == TaskStatus::Finished) {
+    // The raster at the requested scale is ready, let createShapeProxy() upload it.
+    return nullptr;
+  }
+  auto result = shapeScales.find(baseKey);
+  if (result == shapeScales.end()) {
+    return nullptr;
+  }
+  auto& shapeScale = result->second;
+  shapeScaleLRU.erase(shapeScale->cachedPosition);
+  shapeScaleLRU.push_back(shapeScale.get());
+  shapeScale->cachedPosition = std::prev(shapeScaleLRU.end());
+  // Try the cached scales from the closest to the farthest one in log space.
+  auto& scales = shapeScale->scales;
+  auto sortedScales = scales;
+  auto logScale = std::log2(scaled.scale);
+  std::sort(sortedScales.begin(), sortedScales.end(), [logScale](float a, float b) {
+    return std::fabs(std::log2(a) - logScale) < std::fabs(std::log2(b) - logScale);
+  });
+  for (auto scale : sortedScales) {
+    auto fallbackShape = Shape::ApplyMatrix(scaled.baseShape, Matrix::MakeScale(scale));
+    auto fallbackBounds = GetShapeBounds(fallbackShape.get(), aaType);
+    auto fallbackMatrix = scaled.drawingMatrix;
+    fallbackMatrix.preScale(scaled.scale / scale, scaled.scale / scale);
+    fallbackMatrix.preTranslate(fallbackBounds.x(), fallbackBounds.y());
+    auto shapeProxy = findShapeProxy(GetShapeKey(fallbackShape.get(), aaType), fallbackMatrix);
+    if (shapeProxy == nullptr) {
+      // The cache at this scale has been purged.
+      scales.erase(std::find(scales.begin(), scales.end(), scale));
+      continue;
+    }
+    if (pendingTask == pendingShapeTasks.end()) {
+      addPendingShapeTask(uniqueKey, scaled.shape, bounds, aaType);
+    }
+    return shapeProxy;
+  }
+  return nullptr;
+}
+
+void ProxyProvider::addShapeScale(const UniqueKey& baseKey, float scale) {
+  if (!shapeScaleFallback) {
+    return;
   }
+  auto& shapeScale = shapeScales[baseKey];
+  if (shapeScale == nullptr) {
+    shapeScale = std::make_unique<ShapeScales>(baseKey);
+  } else {
+    shapeScaleLRU.erase(shapeScale->cachedPosition);
+  }
+  shapeScaleLRU.push_back(shapeScale.get());
+  shapeScale->cachedPosition = std::prev(shapeScaleLRU.end());
+  auto& scales = shapeScale->scales;
+  auto result = std::find(scales.begin(), scales.end(), scale);
+  if (result != scales.end()) {
+    scales.erase(result);
+  } else if (scales.size() >= MaxScalesPerShape) {
+    scales.erase(scales.begin());
+  }
+  scales.push_back(scale);
+  while (shapeScaleLRU.size() > MaxShapeScaleEntries) {
+    auto oldest = shapeScaleLRU.front();
+    shapeScaleLRU.pop_front();
+    shapeScales.erase(oldest->baseKey);
+  }
+}
+
+void ProxyProvider::addPendingShapeTask(const UniqueKey& uniqueKey, std::shared_ptr<Shape> shape,
+                                        const Rect& bounds, AAType aaType) {
+#ifdef TGFX_USE_THREADS
   auto width = static_cast<int>(ceilf(bounds.width()));
   auto height = static_cast<int>(ceilf(bounds.height()));
   shape = Shape::ApplyMatrix(std::move(shape), Matrix::MakeTrans(-bounds.x(), -bounds.y()));
   auto rasterizer = std::make_unique<ShapeRasterizer>(width, height, std::move(shape), aaType);
+  if (!rasterizer->asyncSupport()) {
+    return;
+  }
+  auto task = std::make_shared<DataTask<ShapeBuffer>>(std::move(rasterizer));
+  Task::Run(task);
+  pendingShapeTasks[uniqueKey] = std::move(task);
+  pendingShapeKeys.push_back(uniqueKey);
+  while (pendingShapeKeys.size() > MaxPendingShapeTasks) {
+    auto oldest = pendingShapeTasks.find(pendingShapeKeys.front());
+    if (oldest != pendingShapeTasks.end()) {
+      oldest->second->cancel();
+      pendingShapeTasks.erase(oldest);
+    }
+    pendingShapeKeys.pop_front();
+  }
+#else
+  USE(uniqueKey);
+  USE(shape);
+  USE(bounds);
+  USE(aaType);
+#endif
+}
+
+std::shared_ptr<GPUShapeProxy> ProxyProvider::createShapeProxy(const UniqueKey& uniqueKey,
+                                                               std::shared_ptr<Shape> shape,
+                                                               const Rect& bounds,
+                                                               const Matrix& drawingMatrix,
+                                                               AAType aaType, bool maskOnly,
+                                                               uint32_t renderFlags) {
+  auto boundsMatrix = drawingMatrix;
+  boundsMatrix.preTranslate(bounds.x(), bounds.y());
+  if (auto shapeProxy = findShapeProxy(uniqueKey, boundsMatrix)) {
+    return shapeProxy;
+  }
+  auto width = static_cast<int>(ceilf(bounds.width()));
+  auto height = static_cast<int>(ceilf(bounds.height()));
   std::unique_ptr<DataSource<ShapeBuffer>> dataSource = nullptr;
-#ifdef TGFX_USE_THREADS
-  if (!(renderFlags & RenderFlags::DisableAsyncTask) && rasterizer->asyncSupport()) {
-    dataSource = DataSource<ShapeBuffer>::Async(std::move(rasterizer));
+  auto pendingTask = pendingShapeTasks.find(uniqueKey);
+  if (pendingTask != pendingShapeTasks.end()) {
+    // Reuse the raster started while the shape was drawn from a fallback scale.
+    dataSource = std::make_unique<AsyncDataSource<ShapeBuffer>>(std::move(pendingTask->second));
+    pendingShapeTasks.erase(pendingTask);
+    auto pendingKey = std::find(pendingShapeKeys.begin(), pendingShapeKeys.end(), uniqueKey);
+    if (pendingKey != pendingShapeKeys.end()) {
+      pendingShapeKeys.erase(pendingKey);
+    }
   } else {
-    dataSource = std::move(rasterizer);
-  }
+    shape = Shape::ApplyMatrix(std::move(shape), Matrix::MakeTrans(-bounds.x(), -bounds.y()));
+    auto rasterizer =
+        std::make_unique<ShapeRasterizer>(width, height, std::move(shape), aaType, maskOnly);
+#ifdef TGFX_USE_THREADS
+    if (!(renderFlags & RenderFlags::DisableAsyncTask) && rasterizer->asyncSupport()) {
+      dataSource = DataSource<ShapeBuffer>::Async(std::move(rasterizer));
+    } else {
+      dataSource = std::move(rasterizer);
+    }
 #else
-  dataSource = std::move(rasterizer);
+    dataSource = std::move(rasterizer);
 #endif
-  triangleProxy = std::shared_ptr<GPUBufferProxy>(new GPUBufferProxy(BufferType::Vertex));
+  }
+  auto triangleKey = GetTriangleKey(uniqueKey);
+  auto triangleProxy = std::shared_ptr<GPUBufferProxy>(new GPUBufferProxy(BufferType::Vertex));
   addResourceProxy(triangleProxy, triangleKey);
-  textureProxy =
+  auto textureProxy =
       std::shared_ptr<TextureProxy>(new TextureProxy(width, height, PixelFormat::ALPHA_8, true));
-  addResourceProxy(textureProxy, textureKey);
+  addResourceProxy(textureProxy, GetTextureKey(uniqueKey));
   auto task = context->drawingBuffer()->make<ShapeBufferUploadTask>(triangleProxy, textureProxy,
                                                                     std::move(dataSource));
   if (!(renderFlags & RenderFlags::DisableCache)) {
     task->textureProxy = textureProxy;
   }
   context->drawingManager()->addResourceTask(std::move(task), triangleKey, renderFlags);
-  return std::make_shared<GPUShapeProxy>(drawingMatrix, triangleProxy, textureProxy);
+  return std::make_shared<GPUShapeProxy>(boundsMatrix, triangleProxy, textureProxy);
 }
 
 std::shared_ptr<TextureProxy> ProxyProvider::createTextureProxyByImageSource(
@@ -288,30 +632,6 @@ std::shared_ptr<TextureProxy> ProxyProvider::createTextureProxy(
                                          mipmapped, renderFlags);
 }
 
-static constexpr int MinApproxSize = 16;
-static constexpr int MagicTol = 1024;
-
-/**
- * Map 'value' to a larger multiple of 2. Values <= 'MagicTol' will pop up to the next power of 2.
- * Those above 'MagicTol' will only go up half the floor power of 2.
- */
-int GetApproxSize(int value) {
-  value = std::max(MinApproxSize, value);
-  if (IsPow2(value)) {
-    return value;
-  }
-  int ceilPow2 = NextPow2(value);
-  if (value <= MagicTol) {
-    return ceilPow2;
-  }
-  int floorPow2 = ceilPow2 >> 1;
-  int mid = floorPow2 + (floorPow2 >> 1);
-  if (value <= mid) {
-    return mid;
-  }
-  return ceilPow2;
-}
-
 std::shared_ptr<TextureProxy> ProxyProvider::createTextureProxy(
     const UniqueKey& uniqueKey, int width, int height, PixelFormat format, bool mipmapped,
     ImageOrigin origin, BackingFit backingFit, uint32_t renderFlags) {
@@ -327,6 +647,7 @@ std::shared_ptr<TextureProxy> ProxyProvider::createTextureProxy(
   auto textureProxy = std::shared_ptr<DefaultTextureProxy>(
       new DefaultTextureProxy(width, height, format, hasMipmaps, origin));
   if (backingFit == BackingFit::Approx) {
+    textureProxy->_backingFit = BackingFit::Approx;
     textureProxy->_backingStoreWidth = GetApproxSize(width);
     textureProxy->_backingStoreHeight = GetApproxSize(height);
   }
@@ -409,6 +730,7 @@ std::shared_ptr<RenderTargetProxy> ProxyProvider::createRenderTargetProxy(
   auto proxy = std::shared_ptr<TextureRenderTargetProxy>(
       new TextureRenderTargetProxy(width, height, format, sampleCount, hasMipmaps, origin));
   if (backingFit == BackingFit::Approx) {
+    proxy->_backingFit = BackingFit::Approx;
     proxy->_backingStoreWidth = GetApproxSize(width);
     proxy->_backingStoreHeight = GetApproxSize(height);
   }
@@ -18,11 +18,15 @@
 
 #pragma once
 
+#include <deque>
+#include <list>
+#include "core/DataSource.h"
 #include "core/utils/BlockBuffer.h"
 #include "core/utils/SlidingWindowTracker.h"
 #include "gpu/AAType.h"
 #include "gpu/BackingFit.h"
 #include "gpu/VertexProvider.h"
+#include "gpu/VertexRingBuffer.h"
 #include "gpu/proxies/GPUBufferProxy.h"
 #include "gpu/proxies/GPUShapeProxy.h"
 #include "gpu/proxies/RenderTargetProxy.h"
@@ -32,6 +36,19 @@
 #include "tgfx/core/Shape.h"
 
 namespace tgfx {
+struct ShapeBuffer;
+struct ScaledShape;
+
+/**
+ * Shapes larger than this size in device pixels are rasterized as tiles.
+ */
+static constexpr float TiledShapeThreshold = 2048.0f;
+
+/**
+ * The width and height of the mask tiles of a tiled shape.
+ */
+static constexpr int ShapeTileSize = 512;
+
 /**
  * A factory for creating proxy-derived objects.
  */
@@ -83,6 +100,31 @@ class ProxyProvider {
                                                      const Rect& clipBounds,
                                                      uint32_t renderFlags = 0);
 
+  /**
+   * Creates GPUShapeProxies for the given Shape, whose content is only needed within the clipBounds
+   * in device space. Shapes larger than TiledShapeThreshold in either dimension are rasterized as a
+   * grid of ShapeTileSize mask tiles, and only the tiles intersecting the clipBounds are created.
+   * The tiles are cached by the shape's key and their tile indices, so panning over a large shape
+   * reuses the tiles already rasterized. Smaller shapes return a single proxy, the same as
+   * createGPUShapeProxy().
+   */
+  std::vector<std::shared_ptr<GPUShapeProxy>> createGPUShapeProxies(std::shared_ptr<Shape> shape,
+                                                                    AAType aaType,
+                                                                    const Rect& clipBounds,
+                                                                    uint32_t renderFlags = 0);
+
+  /**
+   * Enables or disables drawing scaled shapes from cached rasters at a nearby scale. While enabled,
+   * the scales of shapes are quantized into buckets before rasterizing. If a bucket has no cache
+   * yet but another scale of the same shape does, the closest cached raster is drawn scaled right
+   * away, and the raster for the bucket is generated asynchronously for later frames. This trades
+   * temporary blur for smooth interactive zooming, so the shapes should be drawn again with the
+   * fallback disabled once the zooming stops.
+   */
+  void setShapeScaleFallback(bool enabled) {
+    shapeScaleFallback = enabled;
+  }
+
   /*
    * Creates a TextureProxy for the given ImageBuffer. The image buffer will be released after being
    * uploaded to the GPU.
@@ -162,11 +204,31 @@ class ProxyProvider {
   void flushSharedVertexBuffer();
 
   /**
-   * Clears the block buffer used for shared vertex buffer.
+   * Finishes the vertex writes into the mapped ring buffer and clears the block buffer used for
+   * shared vertex buffer. Must be called before executing the render tasks of a flush.
    */
   void clearSharedVertexBuffer();
 
+  /**
+   * Releases the persistent vertex ring buffer. The GPU objects are freed only if releaseGPU is
+   * true.
+   */
+  void releaseAll(bool releaseGPU);
+
  private:
+  /**
+   * The scales at which a base shape has been rasterized, ordered from the oldest to the most
+   * recently used one.
+   */
+  struct ShapeScales {
+    explicit ShapeScales(UniqueKey baseKey) : baseKey(std::move(baseKey)) {
+    }
+
+    UniqueKey baseKey = {};
+    std::vector<float> scales = {};
+    std::list<ShapeScales*>::iterator cachedPosition = {};
+  };
+
   Context* context = nullptr;
   ResourceKeyMap<std::weak_ptr<ResourceProxy>> proxyMap = {};
   bool sharedVertexBufferFlushed = false;
@@ -174,13 +236,49 @@ class ProxyProvider {
   std::vector<std::shared_ptr<Task>> sharedVertexBufferTasks = {};
   BlockBuffer vertexBlockBuffer = {};
   SlidingWindowTracker maxValueTracker = {10};
+  bool vertexRingBufferChecked = false;
+  std::unique_ptr<VertexRingBuffer> vertexRingBuffer = nullptr;
+  std::shared_ptr<GPUBufferProxy> ringVertexBuffer = nullptr;
+  std::vector<std::shared_ptr<Task>> ringVertexBufferTasks = {};
+  size_t ringVertexBytes = 0;
+  bool ringVertexBufferOverflowed = false;
+  bool shapeScaleFallback = false;
+  std::list<ShapeScales*> shapeScaleLRU = {};
+  ResourceKeyMap<std::unique_ptr<ShapeScales>> shapeScales = {};
+  ResourceKeyMap<std::shared_ptr<DataTask<ShapeBuffer>>> pendingShapeTasks = {};
+  std::deque<UniqueKey> pendingShapeKeys = {};
 
   std::shared_ptr<GPUBufferProxy> findOrWrapGPUBufferProxy(const UniqueKey& uniqueKey);
 
+  std::shared_ptr<GPUShapeProxy> findShapeProxy(const UniqueKey& uniqueKey,
+                                                const Matrix& drawingMatrix);
+
+  std::shared_ptr<GPUShapeProxy> findShapeScaleFallback(const ScaledShape& scaled,
+                                                        const UniqueKey& baseKey,
+                                                        const UniqueKey& uniqueKey,
+                                                        const Rect& bounds, AAType aaType);
+
+  void addShapeScale(const UniqueKey& baseKey, float scale);
+
+  void addPendingShapeTask(const UniqueKey& uniqueKey, std::shared_ptr<Shape> shape,
+                           const Rect& bounds, AAType aaType);
+
+  std::shared_ptr<GPUShapeProxy> createShapeProxy(const UniqueKey& uniqueKey,
+                                                  std::shared_ptr<Shape> shape, const Rect& bounds,
+                                                  const Matrix& drawingMatrix, AAType aaType,
+                                                  bool maskOnly, uint32_t renderFlags);
+
   void addResourceProxy(std::shared_ptr<ResourceProxy> proxy, const UniqueKey& uniqueKey = {});
 
   void uploadSharedVertexBuffer(std::shared_ptr<Data> data);
 
+  float* allocateRingVertices(size_t byteSize, size_t* offset);
+
+  void writeVertices(PlacementPtr<VertexProvider> provider, float* vertices, uint32_t renderFlags,
+                     std::vector<std::shared_ptr<Task>>* tasks);
+
+  void resetVertexRingBuffer(size_t regionSize);
+
   std::shared_ptr<TextureProxy> createTextureProxyByImageSource(
       const UniqueKey& uniqueKey, std::shared_ptr<DataSource<ImageBuffer>> source, int width,
       int height, bool alphaOnly, bool mipmapped = false, uint32_t renderFlags = 0);
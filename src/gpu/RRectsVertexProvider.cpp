@@ -102,11 +102,16 @@ RRectsVertexProvider::RRectsVertexProvider(PlacementArray<RRectRecord>&& rects,
 }
 
 size_t RRectsVertexProvider::vertexCount() const {
-  auto floatCount = rects.size() * 4 * 36;
+  // Each rrect has 16 vertices made of a position, ellipse offsets and reciprocal radii, plus the
+  // optional color and scale. Slots of absent attributes are not reserved.
+  size_t perVertexCount = 8;
+  if (bitFields.hasColor) {
+    perVertexCount += 1;
+  }
   if (bitFields.useScale) {
-    floatCount += rects.size() * 4 * 4;
+    perVertexCount += 1;
   }
-  return floatCount;
+  return rects.size() * 16 * perVertexCount;
 }
 
 void RRectsVertexProvider::getVertices(float* vertices) const {
@@ -17,9 +17,35 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "RectsVertexProvider.h"
+#include <cmath>
+#include <cstring>
 #include "gpu/Quad.h"
 
 namespace tgfx {
+// The largest subset bound that can be packed, stored as twice its value in an unsigned short.
+static constexpr float MaxPackedSubsetValue = 32767.5f;
+
+static bool CanPackSubsetValue(float value) {
+  auto doubled = value * 2.0f;
+  return value >= 0.0f && value <= MaxPackedSubsetValue && doubled == std::floor(doubled);
+}
+
+static void WriteSubset(float* vertices, int& index, const Rect& subset, bool packed) {
+  if (!packed) {
+    vertices[index++] = subset.left;
+    vertices[index++] = subset.top;
+    vertices[index++] = subset.right;
+    vertices[index++] = subset.bottom;
+    return;
+  }
+  uint16_t values[4] = {static_cast<uint16_t>(subset.left * 2.0f),
+                        static_cast<uint16_t>(subset.top * 2.0f),
+                        static_cast<uint16_t>(subset.right * 2.0f),
+                        static_cast<uint16_t>(subset.bottom * 2.0f)};
+  memcpy(vertices + index, values, sizeof(values));
+  index += 2;
+}
+
 static void WriteUByte4Color(float* vertices, int& index, const Color& color) {
   auto bytes = reinterpret_cast<uint8_t*>(&vertices[index++]);
   bytes[0] = static_cast<uint8_t>(color.red * 255);
@@ -43,7 +69,7 @@ class AARectsVertexProvider : public RectsVertexProvider {
       perVertexCount += 1;
     }
     if (static_cast<UVSubsetMode>(bitFields.subsetMode) != UVSubsetMode::None) {
-      perVertexCount += 4;
+      perVertexCount += bitFields.packedSubset ? 2 : 4;
     }
     return rects.size() * 2 * 4 * perVertexCount;
   }
@@ -84,10 +110,7 @@ class AARectsVertexProvider : public RectsVertexProvider {
             WriteUByte4Color(vertices, index, record->color);
           }
           if (needSubset) {
-            vertices[index++] = subset.left;
-            vertices[index++] = subset.top;
-            vertices[index++] = subset.right;
-            vertices[index++] = subset.bottom;
+            WriteSubset(vertices, index, subset, bitFields.packedSubset);
           }
         }
       }
@@ -110,7 +133,7 @@ class NonAARectsVertexProvider : public RectsVertexProvider {
       perVertexCount += 1;
     }
     if (static_cast<UVSubsetMode>(bitFields.subsetMode) != UVSubsetMode::None) {
-      perVertexCount += 4;
+      perVertexCount += bitFields.packedSubset ? 2 : 4;
     }
     return rects.size() * 4 * perVertexCount;
   }
@@ -135,10 +158,7 @@ class NonAARectsVertexProvider : public RectsVertexProvider {
           WriteUByte4Color(vertices, index, record->color);
         }
         if (needSubset) {
-          vertices[index++] = subset.left;
-          vertices[index++] = subset.top;
-          vertices[index++] = subset.right;
-          vertices[index++] = subset.bottom;
+          WriteSubset(vertices, index, subset, bitFields.packedSubset);
         }
       }
     }
@@ -183,6 +203,20 @@ RectsVertexProvider::RectsVertexProvider(PlacementArray<RectRecord>&& rects, AAT
   bitFields.hasUVCoord = hasUVCoord;
   bitFields.hasColor = hasColor;
   bitFields.subsetMode = static_cast<uint8_t>(subsetMode);
+  bitFields.packedSubset = false;
+  if (subsetMode == UVSubsetMode::None) {
+    return;
+  }
+  // Subsets land on the half-pixel grid in most cases, so they can be packed losslessly. A
+  // single subset that does not fit keeps the whole batch on the float format.
+  for (auto& record : this->rects) {
+    auto subset = getSubset(record->uvRect);
+    if (!CanPackSubsetValue(subset.left) || !CanPackSubsetValue(subset.top) ||
+        !CanPackSubsetValue(subset.right) || !CanPackSubsetValue(subset.bottom)) {
+      return;
+    }
+  }
+  bitFields.packedSubset = true;
 }
 
 Rect RectsVertexProvider::getSubset(const Rect& rect) const {
@@ -119,6 +119,14 @@ class RectsVertexProvider : public VertexProvider {
     return static_cast<UVSubsetMode>(bitFields.subsetMode) != UVSubsetMode::None;
   }
 
+  /**
+   * Returns true if the subset rects are packed as unsigned shorts holding twice their values,
+   * which is chosen when every subset of the provider lies on the half-pixel grid.
+   */
+  bool hasPackedSubset() const {
+    return bitFields.packedSubset;
+  }
+
  protected:
   PlacementArray<RectRecord> rects = {};
   struct {
@@ -126,6 +134,7 @@ class RectsVertexProvider : public VertexProvider {
     bool hasUVCoord : 1;
     bool hasColor : 1;
     uint8_t subsetMode : 2;
+    bool packedSubset : 1;
   } bitFields = {};
 
   Rect getSubset(const Rect& rect) const;
@@ -21,6 +21,8 @@
 #include "core/Atlas.h"
 #include "core/AtlasCell.h"
 #include "core/AtlasManager.h"
+#include "core/DirectMaskCache.h"
+#include "core/GlyphRunList.h"
 #include "core/PathRasterizer.h"
 #include "core/PathRef.h"
 #include "core/PathTriangulator.h"
@@ -219,20 +221,17 @@ void RenderContext::drawGlyphRunList(std::shared_ptr<GlyphRunList> glyphRunList,
     return;
   }
 
+  auto compositor = getOpsCompositor();
+  if (compositor == nullptr) {
+    return;
+  }
+  auto directMaskCache = getDirectMaskCache(glyphRunList.get(), state.matrix.getMaxScale(), stroke);
   std::vector<GlyphRun> rejectedGlyphRuns = {};
-  const auto& glyphRuns = glyphRunList->glyphRuns();
-  for (size_t i = 0; i < glyphRuns.size(); ++i) {
-    auto& run = glyphRuns[i];
-    if (run.font.getTypeface() == nullptr) {
-      continue;
+  for (auto& run : directMaskCache->runs) {
+    drawGlyphsAsDirectMask(run, state, fill);
+    if (!run.rejectedGlyphRun.glyphs.empty()) {
+      rejectedGlyphRuns.push_back(run.rejectedGlyphRun);
     }
-    GlyphRun rejectedGlyphRun = {};
-    drawGlyphsAsDirectMask(run, state, fill, stroke, &rejectedGlyphRun);
-    if (rejectedGlyphRun.glyphs.empty()) {
-      continue;
-    }
-    rejectedGlyphRun.font = run.font;
-    rejectedGlyphRuns.emplace_back(std::move(rejectedGlyphRun));
   }
 
   if (rejectedGlyphRuns.empty()) {
@@ -344,14 +343,35 @@ void RenderContext::replaceRenderTarget(std::shared_ptr<RenderTargetProxy> newRe
   }
 }
 
-void RenderContext::drawGlyphsAsDirectMask(const GlyphRun& sourceGlyphRun, const MCState& state,
-                                           const Fill& fill, const Stroke* stroke,
-                                           GlyphRun* rejectedGlyphRun) {
-  auto compositor = getOpsCompositor();
-  if (compositor == nullptr) {
-    return;
-  }
-  auto maxScale = state.matrix.getMaxScale();
+std::shared_ptr<DirectMaskCache> RenderContext::getDirectMaskCache(
+    const GlyphRunList* glyphRunList, float maxScale, const Stroke* stroke) {
+  auto context = getContext();
+  auto atlasManager = context->atlasManager();
+  auto cache = glyphRunList->getDirectMaskCache();
+  if (cache != nullptr &&
+      cache->isValid(context->uniqueID(), maxScale, stroke, atlasManager->currentGeneration())) {
+    return cache;
+  }
+  std::vector<DirectMaskRun> runs = {};
+  for (auto& run : glyphRunList->glyphRuns()) {
+    if (run.font.getTypeface() == nullptr) {
+      continue;
+    }
+    runs.emplace_back();
+    makeDirectMaskRun(run, maxScale, stroke, &runs.back());
+  }
+  // Adding cells may evict plots or activate new pages, so the generation is only recorded once
+  // all cells of the list are in place. The plots used by the list are protected by their use
+  // tokens, so none of the resolved locators are affected by those changes.
+  cache = std::make_shared<DirectMaskCache>(context->uniqueID(), maxScale, stroke,
+                                            atlasManager->currentGeneration());
+  cache->runs = std::move(runs);
+  glyphRunList->setDirectMaskCache(cache);
+  return cache;
+}
+
+void RenderContext::makeDirectMaskRun(const GlyphRun& sourceGlyphRun, float maxScale,
+                                      const Stroke* stroke, DirectMaskRun* maskRun) {
   auto hasScale = !FloatNearlyEqual(maxScale, 1.0f);
   auto font = sourceGlyphRun.font;
   if (hasScale) {
@@ -363,12 +383,19 @@ void RenderContext::drawGlyphsAsDirectMask(const GlyphRun& sourceGlyphRun, const
     scaledStroke = std::make_unique<Stroke>(*stroke);
     scaledStroke->width *= maxScale;
   }
+  auto& rejectedGlyphRun = maskRun->rejectedGlyphRun;
+  rejectedGlyphRun.font = sourceGlyphRun.font;
   AtlasCell atlasCell;
   size_t index = 0;
   PlotUseUpdater plotUseUpdater;
   auto atlasManager = getContext()->atlasManager();
   auto drawingManager = getContext()->drawingManager();
   auto nextFlushToken = atlasManager->nextFlushToken();
+  auto typeface = font.getTypeface();
+  auto typefaceID = GetTypefaceID(typeface.get(), typeface->isCustom());
+  auto maskFormat = GetMaskFormat(font);
+  maskRun->maskFormat = maskFormat;
+  auto& textureProxies = atlasManager->getTextureProxies(maskFormat);
   for (auto& glyphID : sourceGlyphRun.glyphs) {
     auto glyphPosition = sourceGlyphRun.positions[index++];
     auto bounds = font.getBounds(glyphID);
@@ -380,36 +407,31 @@ void RenderContext::drawGlyphsAsDirectMask(const GlyphRun& sourceGlyphRun, const
     }
     auto maxDimension = static_cast<int>(ceilf(std::max(bounds.width(), bounds.height())));
     if (maxDimension >= Atlas::MaxCellSize) {
-      rejectedGlyphRun->glyphs.push_back(glyphID);
-      rejectedGlyphRun->positions.push_back(glyphPosition);
+      rejectedGlyphRun.glyphs.push_back(glyphID);
+      rejectedGlyphRun.positions.push_back(glyphPosition);
       continue;
     }
 
-    auto typeface = font.getTypeface();
     BytesKey glyphKey;
-    ComputeAtlasKey(font, GetTypefaceID(typeface.get(), typeface->isCustom()), glyphID,
-                    scaledStroke.get(), glyphKey);
+    ComputeAtlasKey(font, typefaceID, glyphID, scaledStroke.get(), glyphKey);
 
-    auto maskFormat = GetMaskFormat(font);
-    auto& textureProxies = atlasManager->getTextureProxies(maskFormat);
-
-    auto glyphState = state;
+    Matrix glyphMatrix = {};
     AtlasCellLocator cellLocator;
     auto& atlasLocator = cellLocator.atlasLocator;
     if (atlasManager->getCellLocator(maskFormat, glyphKey, cellLocator)) {
-      glyphState.matrix = cellLocator.matrix;
+      glyphMatrix = cellLocator.matrix;
     } else {
-      auto glyphCodec = GetGlyphCodec(font, glyphID, scaledStroke.get(), &glyphState.matrix);
+      auto glyphCodec = GetGlyphCodec(font, glyphID, scaledStroke.get(), &glyphMatrix);
       if (glyphCodec == nullptr) {
-        rejectedGlyphRun->glyphs.push_back(glyphID);
-        rejectedGlyphRun->positions.push_back(glyphPosition);
+        rejectedGlyphRun.glyphs.push_back(glyphID);
+        rejectedGlyphRun.positions.push_back(glyphPosition);
         continue;
       }
       atlasCell._key = std::move(glyphKey);
       atlasCell._maskFormat = maskFormat;
       atlasCell._width = static_cast<uint16_t>(glyphCodec->width());
       atlasCell._height = static_cast<uint16_t>(glyphCodec->height());
-      atlasCell._matrix = glyphState.matrix;
+      atlasCell._matrix = glyphMatrix;
 
       if (atlasManager->addCellToAtlas(atlasCell, nextFlushToken, atlasLocator)) {
         auto pageIndex = atlasLocator.pageIndex();
@@ -417,28 +439,63 @@ void RenderContext::drawGlyphsAsDirectMask(const GlyphRun& sourceGlyphRun, const
         drawingManager->addAtlasCellCodecTask(textureProxies[pageIndex], offset,
                                               std::move(glyphCodec));
       } else {
-        rejectedGlyphRun->glyphs.push_back(glyphID);
-        rejectedGlyphRun->positions.push_back(glyphPosition);
+        rejectedGlyphRun.glyphs.push_back(glyphID);
+        rejectedGlyphRun.positions.push_back(glyphPosition);
         continue;
       }
     }
-    atlasManager->setPlotUseToken(plotUseUpdater, atlasLocator.plotLocator(), maskFormat,
-                                  nextFlushToken);
-    auto textureProxy = textureProxies[atlasLocator.pageIndex()];
-    if (textureProxy == nullptr) {
-      rejectedGlyphRun->glyphs.push_back(glyphID);
-      rejectedGlyphRun->positions.push_back(glyphPosition);
+    auto& plotLocator = atlasLocator.plotLocator();
+    atlasManager->setPlotUseToken(plotUseUpdater, plotLocator, maskFormat, nextFlushToken);
+    auto& plots = maskRun->plots;
+    if (std::find(plots.begin(), plots.end(), plotLocator) == plots.end()) {
+      plots.push_back(plotLocator);
+    }
+    if (textureProxies[atlasLocator.pageIndex()] == nullptr) {
+      rejectedGlyphRun.glyphs.push_back(glyphID);
+      rejectedGlyphRun.positions.push_back(glyphPosition);
       continue;
     }
-    auto rect = atlasLocator.getLocation();
-    glyphState.matrix.postScale(1.f / maxScale, 1.f / maxScale);
-    glyphState.matrix.postTranslate(glyphPosition.x, glyphPosition.y);
-    glyphState.matrix.postConcat(state.matrix);
-    glyphState.matrix.preTranslate(-rect.x(), -rect.y());
-    compositor->fillTextAtlas(std::move(textureProxy), rect, glyphState,
-                              fill.makeWithMatrix(state.matrix));
+    glyphMatrix.postScale(1.f / maxScale, 1.f / maxScale);
+    glyphMatrix.postTranslate(glyphPosition.x, glyphPosition.y);
+    maskRun->quads.push_back({atlasLocator.getLocation(), glyphMatrix, atlasLocator.pageIndex()});
   }
 }
+
+void RenderContext::drawGlyphsAsDirectMask(const DirectMaskRun& maskRun, const MCState& state,
+                                           const Fill& fill) {
+  if (maskRun.quads.empty()) {
+    return;
+  }
+  auto compositor = getOpsCompositor();
+  if (compositor == nullptr) {
+    return;
+  }
+  auto atlasManager = getContext()->atlasManager();
+  auto nextFlushToken = atlasManager->nextFlushToken();
+  PlotUseUpdater plotUseUpdater;
+  for (auto& plotLocator : maskRun.plots) {
+    atlasManager->setPlotUseToken(plotUseUpdater, plotLocator, maskRun.maskFormat, nextFlushToken);
+  }
+  auto& textureProxies = atlasManager->getTextureProxies(maskRun.maskFormat);
+  auto glyphFill = fill.makeWithMatrix(state.matrix);
+  auto quads = maskRun.quads.data();
+  auto quadCount = maskRun.quads.size();
+  size_t start = 0;
+  // Quads are submitted in spans sharing the same atlas page to keep the drawing order intact.
+  while (start < quadCount) {
+    auto pageIndex = quads[start].pageIndex;
+    auto end = start + 1;
+    while (end < quadCount && quads[end].pageIndex == pageIndex) {
+      end++;
+    }
+    if (pageIndex < textureProxies.size() && textureProxies[pageIndex] != nullptr) {
+      compositor->fillTextAtlasQuads(textureProxies[pageIndex], quads + start, end - start, state,
+                                     glyphFill);
+    }
+    start = end;
+  }
+}
+
 void RenderContext::drawGlyphsAsPath(std::shared_ptr<GlyphRunList> glyphRunList,
                                      const MCState& state, const Fill& fill, const Stroke* stroke,
                                      const Rect& clipBounds) {
@@ -66,8 +66,13 @@ class RenderContext : public DrawContext {
   bool flush();
 
  private:
-  void drawGlyphsAsDirectMask(const GlyphRun& sourceGlyphRun, const MCState& state,
-                              const Fill& fill, const Stroke* stroke, GlyphRun* rejectedGlyphRun);
+  std::shared_ptr<DirectMaskCache> getDirectMaskCache(const GlyphRunList* glyphRunList,
+                                                      float maxScale, const Stroke* stroke);
+
+  void makeDirectMaskRun(const GlyphRun& sourceGlyphRun, float maxScale, const Stroke* stroke,
+                         DirectMaskRun* maskRun);
+
+  void drawGlyphsAsDirectMask(const DirectMaskRun& maskRun, const MCState& state, const Fill& fill);
 
   void drawGlyphsAsPath(std::shared_ptr<GlyphRunList> glyphRunList, const MCState& state,
                         const Fill& fill, const Stroke* stroke, const Rect& clipBounds);
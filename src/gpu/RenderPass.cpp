@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "RenderPass.h"
+#include "core/utils/Profiling.h"
 #include "gpu/GPU.h"
 
 namespace tgfx {
@@ -59,6 +60,7 @@ void RenderPass::draw(PrimitiveType primitiveType, size_t baseVertex, size_t ver
     return;
   }
   onDraw(primitiveType, baseVertex, vertexCount, false);
+  CounterMark(DrawCalls, 1);
   drawPipelineStatus = DrawPipelineStatus::NotConfigured;
 }
 
@@ -67,6 +69,7 @@ void RenderPass::drawIndexed(PrimitiveType primitiveType, size_t baseIndex, size
     return;
   }
   onDraw(primitiveType, baseIndex, indexCount, true);
+  CounterMark(DrawCalls, 1);
   drawPipelineStatus = DrawPipelineStatus::NotConfigured;
 }
 
@@ -61,6 +61,16 @@ class RenderTarget {
                                             int sampleCount = 1, bool mipmapped = false,
                                             ImageOrigin origin = ImageOrigin::TopLeft);
 
+  /**
+   * Creates a RenderTarget that is at least width x height in size. An idle scratch render target
+   * is reused if its size matches any of the size classes returned by GetApproxSizes(), otherwise
+   * a new one is created at the approximate size of the request.
+   */
+  static std::shared_ptr<RenderTarget> MakeApprox(Context* context, int width, int height,
+                                                  PixelFormat format = PixelFormat::RGBA_8888,
+                                                  int sampleCount = 1, bool mipmapped = false,
+                                                  ImageOrigin origin = ImageOrigin::TopLeft);
+
   /**
    * Returns the context associated with the RenderTarget.
    */
@@ -0,0 +1,142 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "RenderTaskGraph.h"
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+#include "core/utils/Log.h"
+
+namespace tgfx {
+// All externally owned render targets share this key, since different proxies may wrap the same
+// backend render target and their tasks must keep the recording order.
+static const char ExternalTargetKey = 0;
+
+void RenderTaskProxies::addRead(const TextureProxy* proxy) {
+  if (proxy != nullptr) {
+    reads.push_back(proxy);
+  }
+}
+
+void RenderTaskProxies::addRead(const RenderTargetProxy* proxy) {
+  if (proxy == nullptr) {
+    return;
+  }
+  if (auto textureProxy = proxy->asTextureProxy()) {
+    reads.push_back(textureProxy.get());
+  } else {
+    reads.push_back(proxy);
+  }
+}
+
+void RenderTaskProxies::addWrite(const TextureProxy* proxy) {
+  if (proxy != nullptr) {
+    writes.push_back(proxy);
+  }
+}
+
+void RenderTaskProxies::addWrite(const RenderTargetProxy* proxy) {
+  if (proxy == nullptr) {
+    return;
+  }
+  if (auto textureProxy = proxy->asTextureProxy()) {
+    writes.push_back(textureProxy.get());
+  } else {
+    writes.push_back(proxy);
+  }
+  if (proxy->externallyOwned()) {
+    writes.push_back(&ExternalTargetKey);
+  }
+}
+
+void RenderTaskGraph::addTask(RenderTaskProxies proxies) {
+  tasks.push_back(std::move(proxies));
+}
+
+std::vector<size_t> RenderTaskGraph::sort() const {
+  auto count = tasks.size();
+  std::vector<std::vector<size_t>> successors(count);
+  std::vector<size_t> inDegrees(count, 0);
+  std::unordered_map<const void*, size_t> lastWriters = {};
+  std::unordered_map<const void*, std::vector<size_t>> pendingReaders = {};
+  std::vector<size_t> dependencies = {};
+  for (size_t index = 0; index < count; index++) {
+    dependencies.clear();
+    auto& task = tasks[index];
+    for (auto& key : task.reads) {
+      auto writer = lastWriters.find(key);
+      if (writer != lastWriters.end()) {
+        dependencies.push_back(writer->second);
+      }
+      pendingReaders[key].push_back(index);
+    }
+    for (auto& key : task.writes) {
+      auto writer = lastWriters.find(key);
+      if (writer != lastWriters.end()) {
+        dependencies.push_back(writer->second);
+      }
+      auto& readers = pendingReaders[key];
+      dependencies.insert(dependencies.end(), readers.begin(), readers.end());
+      readers.clear();
+      lastWriters[key] = index;
+    }
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+    for (auto dependency : dependencies) {
+      if (dependency != index) {
+        successors[dependency].push_back(index);
+        inDegrees[index]++;
+      }
+    }
+  }
+
+  std::vector<size_t> order = {};
+  order.reserve(count);
+  std::set<size_t> readyTasks = {};
+  for (size_t index = 0; index < count; index++) {
+    if (inDegrees[index] == 0) {
+      readyTasks.insert(index);
+    }
+  }
+  const void* currentTarget = nullptr;
+  while (!readyTasks.empty()) {
+    auto next = readyTasks.begin();
+    if (currentTarget != nullptr) {
+      for (auto item = readyTasks.begin(); item != readyTasks.end(); ++item) {
+        auto& writes = tasks[*item].writes;
+        if (!writes.empty() && writes.front() == currentTarget) {
+          next = item;
+          break;
+        }
+      }
+    }
+    auto index = *next;
+    readyTasks.erase(next);
+    order.push_back(index);
+    auto& writes = tasks[index].writes;
+    currentTarget = writes.empty() ? nullptr : writes.front();
+    for (auto successor : successors[index]) {
+      if (--inDegrees[successor] == 0) {
+        readyTasks.insert(successor);
+      }
+    }
+  }
+  DEBUG_ASSERT(order.size() == count);
+  return order;
+}
+}  // namespace tgfx
@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+#include "gpu/proxies/RenderTargetProxy.h"
+
+namespace tgfx {
+/**
+ * The proxies a render task reads from and writes to. Each proxy is identified by the address of
+ * its TextureProxy, or of its RenderTargetProxy if it is not backed by a texture, so both views of
+ * the same surface share one key.
+ */
+struct RenderTaskProxies {
+  std::vector<const void*> reads = {};
+  std::vector<const void*> writes = {};
+
+  void addRead(const TextureProxy* proxy);
+
+  void addRead(const RenderTargetProxy* proxy);
+
+  void addWrite(const TextureProxy* proxy);
+
+  void addWrite(const RenderTargetProxy* proxy);
+};
+
+/**
+ * RenderTaskGraph builds the dependency graph of the render tasks recorded in one flush and
+ * computes an execution order for them. A task depends on the last task writing any proxy it reads
+ * (read-after-write), on the last task writing any proxy it writes (write-after-write), and on the
+ * tasks reading a proxy before it is written again (write-after-read). Among the tasks that are
+ * ready to run, the ones drawing into the same render target as the previous task are preferred,
+ * which minimizes framebuffer switches. Otherwise, the recording order is kept.
+ */
+class RenderTaskGraph {
+ public:
+  /**
+   * Adds a task with the proxies it reads from and writes to. The first written proxy is treated as
+   * the render target of the task. Tasks are indexed in the order they are added.
+   */
+  void addTask(RenderTaskProxies proxies);
+
+  /**
+   * Returns the number of tasks in the graph.
+   */
+  size_t size() const {
+    return tasks.size();
+  }
+
+  /**
+   * Returns the indices of all tasks in the order they should be executed.
+   */
+  std::vector<size_t> sort() const;
+
+ private:
+  std::vector<RenderTaskProxies> tasks = {};
+};
+}  // namespace tgfx
@@ -35,6 +35,12 @@ void Resource::removeUniqueKey() {
   }
 }
 
+void Resource::setCategory(ResourceCategory newCategory) {
+  if (context != nullptr && newCategory != category) {
+    context->resourceCache()->changeCategory(this, newCategory);
+  }
+}
+
 void Resource::release(bool releaseGPU) {
   if (releaseGPU) {
     onReleaseGPU();
@@ -55,6 +55,15 @@ class Resource {
     return std::static_pointer_cast<T>(context->resourceCache()->findScratchResource(scratchKey));
   }
 
+  /**
+   * A convenient method to retrieve a scratch resource in the cache by the first matching key in
+   * the specified list.
+   */
+  template <class T>
+  static std::shared_ptr<T> Find(Context* context, const std::vector<ScratchKey>& scratchKeys) {
+    return std::static_pointer_cast<T>(context->resourceCache()->findScratchResource(scratchKeys));
+  }
+
   virtual ~Resource() = default;
 
   /**
@@ -82,6 +91,12 @@ class Resource {
    */
   void removeUniqueKey();
 
+  /**
+   * Changes the category the memory of this resource is accounted under. This method is not thread
+   * safe, call it only when the associated context is locked.
+   */
+  void setCategory(ResourceCategory category);
+
  protected:
   Context* context = nullptr;
   std::shared_ptr<Resource> reference = nullptr;
@@ -91,9 +106,18 @@ class Resource {
    */
   virtual void onReleaseGPU() = 0;
 
+  /**
+   * Returns the category the memory of this resource is accounted under when it is added to the
+   * cache.
+   */
+  virtual ResourceCategory defaultCategory() const {
+    return ResourceCategory::Other;
+  }
+
  private:
   ScratchKey scratchKey = {};
   UniqueKey uniqueKey = {};
+  ResourceCategory category = ResourceCategory::Other;
   std::list<Resource*>* cachedList = nullptr;
   std::list<Resource*>::iterator cachedPosition;
   std::chrono::steady_clock::time_point lastUsedTime = {};
@@ -17,8 +17,10 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "gpu/ResourceCache.h"
+#include <limits>
 #include <unordered_map>
 #include "core/utils/Log.h"
+#include "core/utils/Profiling.h"
 #include "gpu/Resource.h"
 
 namespace tgfx {
@@ -26,6 +28,7 @@ static constexpr size_t MAX_EXPIRATION_FRAMES = 1000000;  // About 4.5 hours at
 static constexpr size_t SCRATCH_EXPIRATION_FRAMES = 2;
 
 ResourceCache::ResourceCache(Context* context) : context(context) {
+  categoryLimits.fill(std::numeric_limits<size_t>::max());
 }
 
 bool ResourceCache::empty() const {
@@ -54,6 +57,15 @@ void ResourceCache::setExpirationFrames(size_t frames) {
   purgeAsNeeded();
 }
 
+void ResourceCache::setCacheLimit(ResourceCategory category, size_t bytesLimit) {
+  auto& limit = categoryLimits[static_cast<size_t>(category)];
+  if (limit == bytesLimit) {
+    return;
+  }
+  limit = bytesLimit;
+  purgeAsNeeded();
+}
+
 void ResourceCache::purgeNotUsedSince(std::chrono::steady_clock::time_point purgeTime) {
   processUnreferencedResources();
   purgeResourcesByLRU(false,
@@ -66,6 +78,21 @@ bool ResourceCache::purgeUntilMemoryTo(size_t bytesLimit) {
   return totalBytes <= bytesLimit;
 }
 
+void ResourceCache::purgeCategory(ResourceCategory category) {
+  processUnreferencedResources();
+  auto item = purgeableResources.begin();
+  while (item != purgeableResources.end()) {
+    auto* resource = *item;
+    if (resource->category != category) {
+      item++;
+      continue;
+    }
+    item = purgeableResources.erase(item);
+    purgeableBytes -= resource->memoryUsage();
+    removeResource(resource);
+  }
+}
+
 void ResourceCache::advanceFrameAndPurge() {
   currentFrameTime = std::chrono::steady_clock::now();
   frameTimes.push_back(currentFrameTime);
@@ -90,6 +117,22 @@ void ResourceCache::purgeAsNeeded() {
     purgeResourcesByLRU(true,
                         [&](Resource* resource) { return resource->lastUsedTime > purgeTime; });
   }
+  purgeOverBudgetResources();
+}
+
+void ResourceCache::purgeOverBudgetResources() {
+  auto item = purgeableResources.begin();
+  while (item != purgeableResources.end()) {
+    auto* resource = *item;
+    auto index = static_cast<size_t>(resource->category);
+    if (categoryBytes[index] <= categoryLimits[index]) {
+      item++;
+      continue;
+    }
+    item = purgeableResources.erase(item);
+    purgeableBytes -= resource->memoryUsage();
+    removeResource(resource);
+  }
 }
 
 void ResourceCache::purgeResourcesByLRU(bool scratchResourceOnly,
@@ -143,37 +186,107 @@ void ResourceCache::releaseAll(bool releaseGPU) {
   purgeableResources.clear();
   scratchKeyMap.clear();
   uniqueKeyMap.clear();
+  categoryBytes.fill(0);
   purgeableBytes = 0;
   totalBytes = 0;
 }
 
 std::shared_ptr<Resource> ResourceCache::findScratchResource(const ScratchKey& scratchKey) {
+  _scratchStats.requests++;
+  auto resource = getScratchResource(scratchKey);
+  if (resource == nullptr) {
+    CounterMark(CacheMisses, 1);
+    return nullptr;
+  }
+  CounterMark(CacheHits, 1);
+  _scratchStats.reuses++;
+  changeCategory(resource, resource->defaultCategory());
+  return refResource(resource);
+}
+
+std::shared_ptr<Resource> ResourceCache::findScratchResource(
+    const std::vector<ScratchKey>& scratchKeys) {
+  _scratchStats.requests++;
+  for (size_t i = 0; i < scratchKeys.size(); i++) {
+    auto resource = getScratchResource(scratchKeys[i]);
+    if (resource == nullptr) {
+      continue;
+    }
+    CounterMark(CacheHits, 1);
+    _scratchStats.reuses++;
+    if (i > 0) {
+      _scratchStats.approxReuses++;
+    }
+    changeCategory(resource, resource->defaultCategory());
+    return refResource(resource);
+  }
+  CounterMark(CacheMisses, 1);
+  return nullptr;
+}
+
+Resource* ResourceCache::getScratchResource(const ScratchKey& scratchKey) {
   auto result = scratchKeyMap.find(scratchKey);
   if (result == scratchKeyMap.end()) {
     return nullptr;
   }
-  auto& list = result->second;
-  size_t index = 0;
-  bool found = false;
-  for (auto& resource : list) {
+  for (auto& resource : result->second) {
     if (resource->isPurgeable() && !resource->hasExternalReferences()) {
-      found = true;
-      break;
+      return resource;
     }
-    index++;
   }
-  if (!found) {
-    return nullptr;
+  return nullptr;
+}
+
+ScratchStats ResourceCache::scratchStats() const {
+  auto stats = _scratchStats;
+  for (auto& item : scratchKeyMap) {
+    for (auto& resource : item.second) {
+      auto bytes = resource->memoryUsage();
+      stats.totalBytes += bytes;
+      if (resource->isPurgeable() && !resource->hasExternalReferences()) {
+        stats.idleBytes += bytes;
+      }
+    }
   }
-  auto resource = list[index];
-  return refResource(resource);
+  return stats;
+}
+
+MemoryStats ResourceCache::memoryStats() const {
+  MemoryStats stats = {};
+  stats.totalBytes = totalBytes;
+  stats.purgeableBytes = purgeableBytes;
+  stats.cacheLimit = maxBytes;
+  stats.categoryBytes = categoryBytes;
+  auto scratch = scratchStats();
+  stats.scratchBytes = scratch.totalBytes;
+  stats.idleScratchBytes = scratch.idleBytes;
+  stats.scratchRequests = scratch.requests;
+  stats.scratchReuses = scratch.reuses;
+  return stats;
+}
+
+void ResourceCache::purgeScratchResourcesTo(size_t bytesLimit) {
+  processUnreferencedResources();
+  auto idleBytes = scratchStats().idleBytes;
+  purgeResourcesByLRU(true, [&](Resource* resource) {
+    if (idleBytes <= bytesLimit) {
+      return true;
+    }
+    // Resources without external references are purged right after this check.
+    if (!resource->scratchKey.empty() && !resource->hasExternalReferences()) {
+      idleBytes -= resource->memoryUsage();
+    }
+    return false;
+  });
 }
 
 std::shared_ptr<Resource> ResourceCache::findUniqueResource(const UniqueKey& uniqueKey) {
   auto resource = getUniqueResource(uniqueKey);
   if (resource == nullptr) {
+    CounterMark(CacheMisses, 1);
     return nullptr;
   }
+  CounterMark(CacheHits, 1);
   return refResource(resource);
 }
 
@@ -230,6 +343,13 @@ void ResourceCache::removeUniqueKey(Resource* resource) {
   resource->uniqueKey = {};
 }
 
+void ResourceCache::changeCategory(Resource* resource, ResourceCategory category) {
+  auto bytes = resource->memoryUsage();
+  categoryBytes[static_cast<size_t>(resource->category)] -= bytes;
+  categoryBytes[static_cast<size_t>(category)] += bytes;
+  resource->category = category;
+}
+
 std::shared_ptr<Resource> ResourceCache::addResource(Resource* resource,
                                                      const ScratchKey& scratchKey) {
   resource->context = context;
@@ -237,7 +357,9 @@ std::shared_ptr<Resource> ResourceCache::addResource(Resource* resource,
   if (!resource->scratchKey.empty()) {
     scratchKeyMap[resource->scratchKey].push_back(resource);
   }
+  resource->category = resource->defaultCategory();
   totalBytes += resource->memoryUsage();
+  categoryBytes[static_cast<size_t>(resource->category)] += resource->memoryUsage();
   auto result = std::shared_ptr<Resource>(resource);
   // Add a strong reference to the resource itself, preventing it from being deleted by external
   // references.
@@ -270,6 +392,7 @@ void ResourceCache::removeResource(Resource* resource) {
     }
   }
   totalBytes -= resource->memoryUsage();
+  categoryBytes[static_cast<size_t>(resource->category)] -= resource->memoryUsage();
   resource->release(true);
 }
 }  // namespace tgfx
@@ -18,16 +18,49 @@
 
 #pragma once
 
+#include <array>
 #include <deque>
 #include <functional>
 #include <list>
 #include <unordered_map>
+#include <vector>
 #include "gpu/ResourceKey.h"
 #include "tgfx/gpu/Context.h"
 
 namespace tgfx {
 class Resource;
 
+/**
+ * Usage statistics of the scratch resources in a ResourceCache.
+ */
+struct ScratchStats {
+  /**
+   * The number of scratch lookups since the cache was created.
+   */
+  size_t requests = 0;
+
+  /**
+   * The number of scratch lookups satisfied by reusing an idle resource in the cache.
+   */
+  size_t reuses = 0;
+
+  /**
+   * The number of approximate-size lookups satisfied by an idle resource of a larger size class
+   * than the requested one.
+   */
+  size_t approxReuses = 0;
+
+  /**
+   * The number of bytes held by all resources with a scratch key.
+   */
+  size_t totalBytes = 0;
+
+  /**
+   * The number of bytes held by scratch resources that are currently idle and can be reused.
+   */
+  size_t idleBytes = 0;
+};
+
 /**
  * Manages the lifetime of all Resource instances.
  */
@@ -82,6 +115,19 @@ class ResourceCache {
    */
   void setExpirationFrames(size_t frames);
 
+  /**
+   * Returns the memory budget of the specified category in bytes. The default value is unlimited.
+   */
+  size_t cacheLimit(ResourceCategory category) const {
+    return categoryLimits[static_cast<size_t>(category)];
+  }
+
+  /**
+   * Sets the memory budget of the specified category in bytes. If the category exceeds the new
+   * budget, its purgeable resources are freed in LRU order.
+   */
+  void setCacheLimit(ResourceCategory category, size_t bytesLimit);
+
   /**
    * Purges GPU resources that haven't been used since the passed point in time.
    * @param purgeTime A time point returned by std::chrono::steady_clock::now() or
@@ -97,6 +143,12 @@ class ResourceCache {
    */
   bool purgeUntilMemoryTo(size_t bytesLimit);
 
+  /**
+   * Purges all purgeable resources of the specified category, including those with external
+   * references to their unique keys.
+   */
+  void purgeCategory(ResourceCategory category);
+
   /**
    * Advances the frame counter and purges resources that have expired or exceed the cache limit.
    */
@@ -107,6 +159,30 @@ class ResourceCache {
    */
   std::shared_ptr<Resource> findScratchResource(const ScratchKey& scratchKey);
 
+  /**
+   * Returns an idle scratch resource found by the first matching key in the specified list, which
+   * is sorted by preference. This is used to look up approximate-size resources, where each key
+   * describes a size class that can hold the request.
+   */
+  std::shared_ptr<Resource> findScratchResource(const std::vector<ScratchKey>& scratchKeys);
+
+  /**
+   * Returns the usage statistics of scratch resources.
+   */
+  ScratchStats scratchStats() const;
+
+  /**
+   * Returns a snapshot of the memory usage of all resources, broken down by category.
+   */
+  MemoryStats memoryStats() const;
+
+  /**
+   * Purges idle scratch resources in LRU order until the bytes they hold do not exceed bytesLimit.
+   * Resources with external references to their unique keys are kept. Unlike purgeUntilMemoryTo(),
+   * this trims the scratch pool only, leaving cached content untouched.
+   */
+  void purgeScratchResourcesTo(size_t bytesLimit);
+
   /**
    * Retrieves a unique resource in the cache by the specified UniqueKey.
    */
@@ -131,6 +207,9 @@ class ResourceCache {
   std::list<Resource*> purgeableResources = {};
   ResourceKeyMap<std::vector<Resource*>> scratchKeyMap = {};
   ResourceKeyMap<Resource*> uniqueKeyMap = {};
+  ScratchStats _scratchStats = {};
+  std::array<size_t, ResourceCategoryCount> categoryBytes = {};
+  std::array<size_t, ResourceCategoryCount> categoryLimits = {};
 
   static void AddToList(std::list<Resource*>& list, Resource* resource);
   static void RemoveFromList(std::list<Resource*>& list, Resource* resource);
@@ -138,6 +217,8 @@ class ResourceCache {
 
   void releaseAll(bool releaseGPU);
   void purgeAsNeeded();
+  Resource* getScratchResource(const ScratchKey& scratchKey);
+  void purgeOverBudgetResources();
   void processUnreferencedResources();
   std::shared_ptr<Resource> addResource(Resource* resource, const ScratchKey& scratchKey);
   std::shared_ptr<Resource> refResource(Resource* resource);
@@ -147,6 +228,7 @@ class ResourceCache {
 
   void changeUniqueKey(Resource* resource, const UniqueKey& uniqueKey);
   void removeUniqueKey(Resource* resource);
+  void changeCategory(Resource* resource, ResourceCategory category);
   Resource* getUniqueResource(const UniqueKey& uniqueKey);
 
   friend class Resource;
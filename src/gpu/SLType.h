@@ -36,6 +36,7 @@ enum class SLType {
   Int3,
   Int4,
   UByte4Color,
+  UShort4,
   Texture2DSampler,
   TextureExternalSampler,
   Texture2DRectSampler,
@@ -19,6 +19,7 @@
 #include "gpu/Texture.h"
 #include "core/utils/PixelFormatUtil.h"
 #include "core/utils/UniqueID.h"
+#include "gpu/BackingFit.h"
 #include "gpu/DefaultTexture.h"
 #include "gpu/GPU.h"
 #include "gpu/YUVTexture.h"
@@ -81,6 +82,34 @@ std::shared_ptr<Texture> Texture::MakeFormat(Context* context, int width, int he
   return texture;
 }
 
+std::shared_ptr<Texture> Texture::MakeApprox(Context* context, int width, int height,
+                                             PixelFormat pixelFormat, bool mipmapped,
+                                             ImageOrigin origin) {
+  if (!CheckSizeAndFormat(context, width, height, pixelFormat)) {
+    return nullptr;
+  }
+  auto hasMipmaps = context->caps()->mipmapSupport ? mipmapped : false;
+  auto sizes = GetApproxSizes(width, height, context->caps()->maxTextureSize);
+  std::vector<ScratchKey> scratchKeys = {};
+  scratchKeys.reserve(sizes.size());
+  for (auto& size : sizes) {
+    scratchKeys.push_back(
+        ComputeTextureScratchKey(size.width, size.height, pixelFormat, hasMipmaps));
+  }
+  if (auto texture = Resource::Find<Texture>(context, scratchKeys)) {
+    texture->_origin = origin;
+    return texture;
+  }
+  auto& size = sizes.front();
+  auto sampler = TextureSampler::Make(context, size.width, size.height, pixelFormat, hasMipmaps);
+  if (sampler == nullptr) {
+    return nullptr;
+  }
+  return Resource::AddToCache(
+      context, new DefaultTexture(std::move(sampler), size.width, size.height, origin),
+      scratchKeys.front());
+}
+
 std::shared_ptr<Texture> Texture::MakeFrom(Context* context, const BackendTexture& backendTexture,
                                            ImageOrigin origin, bool adopted) {
   if (context == nullptr || !backendTexture.isValid()) {
@@ -107,6 +107,16 @@ class Texture : public Resource {
                                              PixelFormat pixelFormat, bool mipmapped = false,
                                              ImageOrigin origin = ImageOrigin::TopLeft);
 
+  /**
+   * Creates an empty texture that is at least width x height in size. An idle scratch texture is
+   * reused if its size matches any of the size classes returned by GetApproxSizes(), otherwise a
+   * new texture is created at the approximate size of the request. Returns nullptr if any of the
+   * parameters is invalid.
+   */
+  static std::shared_ptr<Texture> MakeApprox(Context* context, int width, int height,
+                                             PixelFormat pixelFormat, bool mipmapped = false,
+                                             ImageOrigin origin = ImageOrigin::TopLeft);
+
   /**
    * Creates a new Texture which wraps the specified backend texture. The caller must ensure the
    * backend texture is valid for the lifetime of returned Texture.
@@ -219,6 +229,10 @@ class Texture : public Resource {
   int _height = 0;
   ImageOrigin _origin = ImageOrigin::TopLeft;
 
+  ResourceCategory defaultCategory() const override {
+    return ResourceCategory::Image;
+  }
+
   Texture(int width, int height, ImageOrigin origin)
       : _width(width), _height(height), _origin(origin) {
   }
@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include "gpu/GPUBuffer.h"
+
+namespace tgfx {
+/**
+ * VertexRingBuffer is a persistent vertex buffer that streams the shared vertices of each flush
+ * directly into mapped GPU memory. The buffer is split into FrameCount regions used in turn, and
+ * each region is guarded by a fence, so the CPU never overwrites vertices the GPU is still reading.
+ */
+class VertexRingBuffer {
+ public:
+  /**
+   * The number of regions in the ring, which is the number of flushes that may be in flight.
+   */
+  static constexpr int FrameCount = 3;
+
+  /**
+   * Creates a VertexRingBuffer with FrameCount regions of the given size. Returns nullptr if the
+   * backend of the context does not support mapping buffers or fences.
+   */
+  static std::unique_ptr<VertexRingBuffer> Make(Context* context, size_t regionSize);
+
+  virtual ~VertexRingBuffer() = default;
+
+  /**
+   * Returns the GPUBuffer holding all regions of the ring.
+   */
+  virtual std::shared_ptr<GPUBuffer> buffer() const = 0;
+
+  /**
+   * Returns the size in bytes of a single region.
+   */
+  virtual size_t regionSize() const = 0;
+
+  /**
+   * Reserves the given number of bytes in the current region and returns a pointer to the mapped
+   * memory where they should be written, which is safe to use from any thread until unmap() is
+   * called. The offset of the bytes in buffer() is stored in the offset parameter. Returns nullptr
+   * if the current region has no room left or the buffer could not be mapped.
+   */
+  virtual void* allocate(size_t size, size_t* offset) = 0;
+
+  /**
+   * Unmaps the current region so the GPU can read it, and moves on to the next region. All writes
+   * to the pointers returned by allocate() must be finished before calling this method.
+   */
+  virtual void unmap() = 0;
+
+  /**
+   * Releases the fences and unmaps the buffer if releaseGPU is true. Otherwise, the GPU objects
+   * are abandoned because the context is lost.
+   */
+  virtual void release(bool releaseGPU) = 0;
+};
+}  // namespace tgfx
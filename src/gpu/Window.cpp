@@ -65,9 +65,36 @@ void Window::present(Context* context, int64_t presentationTime) {
   onPresent(context, presentationTime);
 }
 
+void Window::present(Context* context, const std::vector<Rect>& damageRects,
+                     int64_t presentationTime) {
+  std::lock_guard<std::mutex> autoLock(locker);
+  if (!checkContext(context)) {
+    return;
+  }
+  context->flush();
+  onPresentWithDamage(context, damageRects, presentationTime);
+}
+
+int Window::getBufferAge(Context* context) {
+  std::lock_guard<std::mutex> autoLock(locker);
+  if (!checkContext(context) || surface == nullptr || sizeInvalid) {
+    return 0;
+  }
+  return onGetBufferAge(context);
+}
+
 void Window::onInvalidSize() {
 }
 
+void Window::onPresentWithDamage(Context* context, const std::vector<Rect>&,
+                                 int64_t presentationTime) {
+  onPresent(context, presentationTime);
+}
+
+int Window::onGetBufferAge(Context*) {
+  return 0;
+}
+
 void Window::onFreeSurface() {
   surface = nullptr;
 }
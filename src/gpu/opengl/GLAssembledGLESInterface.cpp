@@ -95,6 +95,38 @@ static void InitVertexArray(const GLProcGetter* getter, GLFunctions* functions,
   }
 }
 
+static void InitMapBufferRange(const GLProcGetter* getter, GLFunctions* functions,
+                               const GLInfo& info) {
+  if (info.version >= GL_VER(3, 0)) {
+    functions->mapBufferRange =
+        reinterpret_cast<GLMapBufferRange*>(getter->getProcAddress("glMapBufferRange"));
+    functions->unmapBuffer =
+        reinterpret_cast<GLUnmapBuffer*>(getter->getProcAddress("glUnmapBuffer"));
+  } else if (info.hasExtension("GL_EXT_map_buffer_range")) {
+    functions->mapBufferRange =
+        reinterpret_cast<GLMapBufferRange*>(getter->getProcAddress("glMapBufferRangeEXT"));
+    functions->unmapBuffer =
+        reinterpret_cast<GLUnmapBuffer*>(getter->getProcAddress("glUnmapBufferOES"));
+  }
+}
+
+static void InitSync(const GLProcGetter* getter, GLFunctions* functions, const GLInfo& info) {
+  if (info.version >= GL_VER(3, 0)) {
+    functions->fenceSync = reinterpret_cast<GLFenceSync*>(getter->getProcAddress("glFenceSync"));
+    functions->clientWaitSync =
+        reinterpret_cast<GLClientWaitSync*>(getter->getProcAddress("glClientWaitSync"));
+    functions->deleteSync =
+        reinterpret_cast<GLDeleteSync*>(getter->getProcAddress("glDeleteSync"));
+  } else if (info.hasExtension("GL_APPLE_sync")) {
+    functions->fenceSync =
+        reinterpret_cast<GLFenceSync*>(getter->getProcAddress("glFenceSyncAPPLE"));
+    functions->clientWaitSync =
+        reinterpret_cast<GLClientWaitSync*>(getter->getProcAddress("glClientWaitSyncAPPLE"));
+    functions->deleteSync =
+        reinterpret_cast<GLDeleteSync*>(getter->getProcAddress("glDeleteSyncAPPLE"));
+  }
+}
+
 void GLAssembleGLESInterface(const GLProcGetter* getter, GLFunctions* functions,
                              const GLInfo& info) {
   if (info.hasExtension("GL_NV_texture_barrier")) {
@@ -105,5 +137,7 @@ void GLAssembleGLESInterface(const GLProcGetter* getter, GLFunctions* functions,
   InitRenderbufferStorageMultisample(getter, functions, info);
   InitFramebufferTexture2DMultisample(getter, functions, info);
   InitVertexArray(getter, functions, info);
+  InitMapBufferRange(getter, functions, info);
+  InitSync(getter, functions, info);
 }
 }  // namespace tgfx
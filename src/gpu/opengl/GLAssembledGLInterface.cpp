@@ -72,10 +72,21 @@ static void InitRenderbufferStorageMultisample(const GLProcGetter* getter, GLFun
   }
 }
 
+static void InitMapBufferRange(const GLProcGetter* getter, GLFunctions* functions,
+                               const GLInfo& info) {
+  if (info.version >= GL_VER(3, 0) || info.hasExtension("GL_ARB_map_buffer_range")) {
+    functions->mapBufferRange =
+        reinterpret_cast<GLMapBufferRange*>(getter->getProcAddress("glMapBufferRange"));
+    functions->unmapBuffer =
+        reinterpret_cast<GLUnmapBuffer*>(getter->getProcAddress("glUnmapBuffer"));
+  }
+}
+
 void GLAssembleGLInterface(const GLProcGetter* getter, GLFunctions* functions, const GLInfo& info) {
   InitTextureBarrier(getter, functions, info);
   InitBlitFrameBuffer(getter, functions, info);
   InitRenderbufferStorageMultisample(getter, functions, info);
   InitVertexArray(getter, functions, info);
+  InitMapBufferRange(getter, functions, info);
 }
 }  // namespace tgfx
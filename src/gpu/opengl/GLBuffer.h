@@ -38,5 +38,6 @@ class GLBuffer : public GPUBuffer {
   }
 
   friend class GPUBuffer;
+  friend class VertexRingBuffer;
 };
 }  // namespace tgfx
@@ -251,6 +251,7 @@ void GLCaps::initGLSupport(const GLInfo& info) {
                             info.hasExtension("GL_NV_texture_barrier");
   }
   semaphoreSupport = version >= GL_VER(3, 2) || info.hasExtension("GL_ARB_sync");
+  mapBufferRangeSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_ARB_map_buffer_range");
   if (version < GL_VER(1, 3) && !info.hasExtension("GL_ARB_texture_border_clamp")) {
     clampToBorderSupport = false;
   }
@@ -284,6 +285,7 @@ void GLCaps::initGLESSupport(const GLInfo& info) {
     frameBufferFetchRequiresEnablePerSample = true;
   }
   semaphoreSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_APPLE_sync");
+  mapBufferRangeSupport = version >= GL_VER(3, 0) || info.hasExtension("GL_EXT_map_buffer_range");
   if (version < GL_VER(3, 2) && !info.hasExtension("GL_EXT_texture_border_clamp") &&
       !info.hasExtension("GL_NV_texture_border_clamp") &&
       !info.hasExtension("GL_OES_texture_border_clamp")) {
@@ -305,6 +307,8 @@ void GLCaps::initWebGLSupport(const GLInfo& info) {
   textureBarrierSupport = false;
   frameBufferFetchSupport = false;
   semaphoreSupport = version >= GL_VER(2, 0);
+  // WebGL has no way to map buffers into client memory.
+  mapBufferRangeSupport = false;
   clampToBorderSupport = false;
   npotTextureTileSupport = version >= GL_VER(2, 0);
   mipmapSupport = npotTextureTileSupport;
@@ -116,6 +116,7 @@ class GLCaps : public Caps {
   bool packRowLengthSupport = false;
   bool unpackRowLengthSupport = false;
   bool textureRedSupport = false;
+  bool mapBufferRangeSupport = false;
   MSFBOType msFBOType = MSFBOType::None;
   bool blitRectsMustMatchForMSAASrc = false;
   bool frameBufferFetchRequiresEnablePerSample = false;
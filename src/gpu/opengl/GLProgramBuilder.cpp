@@ -53,6 +53,7 @@ static constexpr std::pair<SLType, const char*> SLTypes[] = {
     {SLType::Int3, "ivec3"},
     {SLType::Int4, "ivec4"},
     {SLType::UByte4Color, "vec4"},
+    {SLType::UShort4, "vec4"},
     {SLType::Texture2DRectSampler, "sampler2DRect"},
     {SLType::TextureExternalSampler, "samplerExternalOES"},
     {SLType::Texture2DSampler, "sampler2D"},
@@ -72,6 +73,7 @@ static std::string SLTypePrecision(SLType t) {
     case SLType::Int3:
     case SLType::Int4:
     case SLType::UByte4Color:
+    case SLType::UShort4:
       return "highp";
     // case SLType::Half:
     // case SLType::Half2:
@@ -39,7 +39,8 @@ static constexpr std::pair<SLType, AttribLayout> attribLayoutPair[] = {
     {SLType::Int2, {false, 2, GL_INT}},
     {SLType::Int3, {false, 3, GL_INT}},
     {SLType::Int4, {false, 4, GL_INT}},
-    {SLType::UByte4Color, {true, 4, GL_UNSIGNED_BYTE}}};
+    {SLType::UByte4Color, {true, 4, GL_UNSIGNED_BYTE}},
+    {SLType::UShort4, {false, 4, GL_UNSIGNED_SHORT}}};
 
 static AttribLayout GetAttribLayout(SLType type) {
   for (const auto& pair : attribLayoutPair) {
@@ -19,6 +19,7 @@
 #include "GLTextureRenderTarget.h"
 #include "core/utils/PixelFormatUtil.h"
 #include "core/utils/UniqueID.h"
+#include "gpu/BackingFit.h"
 #include "gpu/GPU.h"
 #include "gpu/TextureSampler.h"
 #include "gpu/opengl/GLTextureSampler.h"
@@ -104,6 +105,38 @@ std::shared_ptr<RenderTarget> RenderTarget::Make(Context* context, int width, in
                                          origin, false, scratchKey);
 }
 
+std::shared_ptr<RenderTarget> RenderTarget::MakeApprox(Context* context, int width, int height,
+                                                       PixelFormat format, int sampleCount,
+                                                       bool mipmapped, ImageOrigin origin) {
+  if (!Texture::CheckSizeAndFormat(context, width, height, format)) {
+    return nullptr;
+  }
+  auto caps = context->caps();
+  if (!caps->isFormatRenderable(format)) {
+    return nullptr;
+  }
+  auto hasMipmaps = caps->mipmapSupport ? mipmapped : false;
+  sampleCount = caps->getSampleCount(sampleCount, format);
+  auto sizes = GetApproxSizes(width, height, caps->maxTextureSize);
+  std::vector<ScratchKey> scratchKeys = {};
+  scratchKeys.reserve(sizes.size());
+  for (auto& size : sizes) {
+    scratchKeys.push_back(ComputeRenderTargetScratchKey(size.width, size.height, format,
+                                                        sampleCount, hasMipmaps));
+  }
+  if (auto renderTarget = Resource::Find<GLTextureRenderTarget>(context, scratchKeys)) {
+    renderTarget->_origin = origin;
+    return renderTarget;
+  }
+  auto& size = sizes.front();
+  auto sampler = TextureSampler::Make(context, size.width, size.height, format, hasMipmaps);
+  if (sampler == nullptr) {
+    return nullptr;
+  }
+  return GLTextureRenderTarget::MakeFrom(context, std::move(sampler), size.width, size.height,
+                                         sampleCount, origin, false, scratchKeys.front());
+}
+
 static bool RenderbufferStorageMSAA(Context* context, int sampleCount, PixelFormat pixelFormat,
                                     int width, int height) {
   ClearGLError(context);
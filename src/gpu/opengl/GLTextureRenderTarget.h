@@ -71,6 +71,10 @@ class GLTextureRenderTarget : public DefaultTexture, public GLRenderTarget {
  protected:
   void onReleaseGPU() override;
 
+  ResourceCategory defaultCategory() const override {
+    return ResourceCategory::RenderTarget;
+  }
+
  private:
   int _sampleCount = 1;
   bool _externallyOwned = false;
@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "GLVertexRingBuffer.h"
+#include "GLCaps.h"
+#include "GLUtil.h"
+#include "core/utils/Log.h"
+
+namespace tgfx {
+// The maximum time to wait for the GPU to release a region before falling back to a new buffer.
+static constexpr uint64_t FenceTimeoutNanoseconds = 1000000000;
+
+std::unique_ptr<VertexRingBuffer> VertexRingBuffer::Make(Context* context, size_t regionSize) {
+  if (context == nullptr || regionSize == 0) {
+    return nullptr;
+  }
+  auto caps = GLCaps::Get(context);
+  auto gl = GLFunctions::Get(context);
+  if (!caps->mapBufferRangeSupport || !caps->semaphoreSupport || gl->mapBufferRange == nullptr ||
+      gl->unmapBuffer == nullptr || gl->clientWaitSync == nullptr) {
+    return nullptr;
+  }
+  ClearGLError(context);
+  unsigned bufferID = 0;
+  gl->genBuffers(1, &bufferID);
+  if (bufferID == 0) {
+    return nullptr;
+  }
+  auto size = regionSize * FrameCount;
+  auto buffer = Resource::AddToCache(context, new GLBuffer(BufferType::Vertex, size, bufferID));
+  gl->bindBuffer(GL_ARRAY_BUFFER, bufferID);
+  // The storage is specified only once and then rewritten in place through mapped ranges.
+  gl->bufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW);
+  gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+  if (!CheckGLError(context)) {
+    return nullptr;
+  }
+  return std::make_unique<GLVertexRingBuffer>(context, std::move(buffer), regionSize);
+}
+
+GLVertexRingBuffer::GLVertexRingBuffer(Context* context, std::shared_ptr<GLBuffer> buffer,
+                                       size_t regionSize)
+    : context(context), glBuffer(std::move(buffer)), _regionSize(regionSize) {
+}
+
+void* GLVertexRingBuffer::allocate(size_t size, size_t* offset) {
+  if (size == 0 || size > _regionSize - usedSize) {
+    return nullptr;
+  }
+  if (mappedAddress == nullptr && !map()) {
+    return nullptr;
+  }
+  if (offset != nullptr) {
+    *offset = static_cast<size_t>(regionIndex) * _regionSize + usedSize;
+  }
+  auto address = mappedAddress + usedSize;
+  usedSize += size;
+  return address;
+}
+
+bool GLVertexRingBuffer::map() {
+  auto gl = GLFunctions::Get(context);
+  if (unfencedRegion >= 0) {
+    // All draws reading the last unmapped region have been issued by now, so the fence inserted
+    // here is signaled once the GPU is done with them.
+    fences[unfencedRegion] = gl->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    unfencedRegion = -1;
+  }
+  auto& fence = fences[regionIndex];
+  if (fence != nullptr) {
+    auto status = gl->clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FenceTimeoutNanoseconds);
+    if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) {
+      LOGE("GLVertexRingBuffer::map() Failed to wait for the GPU to release the region!");
+      return false;
+    }
+    gl->deleteSync(fence);
+    fence = nullptr;
+  }
+  auto offset = static_cast<size_t>(regionIndex) * _regionSize;
+  gl->bindBuffer(GL_ARRAY_BUFFER, glBuffer->bufferID());
+  // The fence above guarantees the GPU no longer reads this range, so the driver does not need to
+  // synchronize the mapping.
+  auto address = gl->mapBufferRange(
+      GL_ARRAY_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(_regionSize),
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+  gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+  if (address == nullptr) {
+    LOGE("GLVertexRingBuffer::map() Failed to map the vertex buffer!");
+    return false;
+  }
+  mappedAddress = static_cast<uint8_t*>(address);
+  return true;
+}
+
+void GLVertexRingBuffer::unmap() {
+  if (mappedAddress == nullptr) {
+    return;
+  }
+  auto gl = GLFunctions::Get(context);
+  gl->bindBuffer(GL_ARRAY_BUFFER, glBuffer->bufferID());
+  if (!gl->unmapBuffer(GL_ARRAY_BUFFER)) {
+    LOGE("GLVertexRingBuffer::unmap() The contents of the vertex buffer were corrupted!");
+  }
+  gl->bindBuffer(GL_ARRAY_BUFFER, 0);
+  mappedAddress = nullptr;
+  usedSize = 0;
+  unfencedRegion = regionIndex;
+  regionIndex = (regionIndex + 1) % FrameCount;
+}
+
+void GLVertexRingBuffer::release(bool releaseGPU) {
+  if (releaseGPU) {
+    unmap();
+    auto gl = GLFunctions::Get(context);
+    for (auto& fence : fences) {
+      if (fence != nullptr) {
+        gl->deleteSync(fence);
+      }
+    }
+  }
+  for (auto& fence : fences) {
+    fence = nullptr;
+  }
+  mappedAddress = nullptr;
+  unfencedRegion = -1;
+  glBuffer = nullptr;
+}
+}  // namespace tgfx
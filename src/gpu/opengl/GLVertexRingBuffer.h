@@ -0,0 +1,55 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "gpu/VertexRingBuffer.h"
+#include "gpu/opengl/GLBuffer.h"
+
+namespace tgfx {
+class GLVertexRingBuffer : public VertexRingBuffer {
+ public:
+  GLVertexRingBuffer(Context* context, std::shared_ptr<GLBuffer> buffer, size_t regionSize);
+
+  std::shared_ptr<GPUBuffer> buffer() const override {
+    return glBuffer;
+  }
+
+  size_t regionSize() const override {
+    return _regionSize;
+  }
+
+  void* allocate(size_t size, size_t* offset) override;
+
+  void unmap() override;
+
+  void release(bool releaseGPU) override;
+
+ private:
+  Context* context = nullptr;
+  std::shared_ptr<GLBuffer> glBuffer = nullptr;
+  size_t _regionSize = 0;
+  int regionIndex = 0;
+  int unfencedRegion = -1;
+  uint8_t* mappedAddress = nullptr;
+  size_t usedSize = 0;
+  void* fences[FrameCount] = {};
+
+  bool map();
+};
+}  // namespace tgfx
@@ -27,9 +27,39 @@
 #endif
 #include <EGL/eglext.h>
 #include <GLES3/gl3.h>
+#include <cstring>
 #include "core/utils/USE.h"
 
 namespace tgfx {
+static bool HasEGLExtension(EGLDisplay eglDisplay, const char* name) {
+  auto extensions = eglQueryString(eglDisplay, EGL_EXTENSIONS);
+  if (extensions == nullptr) {
+    return false;
+  }
+  auto length = strlen(name);
+  auto start = extensions;
+  while ((start = strstr(start, name)) != nullptr) {
+    auto end = start[length];
+    if ((start == extensions || start[-1] == ' ') && (end == ' ' || end == '\0')) {
+      return true;
+    }
+    start += length;
+  }
+  return false;
+}
+
+static PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC GetSwapBuffersWithDamage(EGLDisplay eglDisplay) {
+  if (HasEGLExtension(eglDisplay, "EGL_KHR_swap_buffers_with_damage")) {
+    return reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+        eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+  }
+  if (HasEGLExtension(eglDisplay, "EGL_EXT_swap_buffers_with_damage")) {
+    return reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(
+        eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+  }
+  return nullptr;
+}
+
 std::shared_ptr<EGLWindow> EGLWindow::Current() {
   auto device = std::static_pointer_cast<EGLDevice>(GLDevice::Current());
   if (device == nullptr || device->eglSurface == nullptr) {
@@ -114,17 +144,71 @@ std::shared_ptr<Surface> EGLWindow::onCreateSurface(Context* context) {
 
 void EGLWindow::onPresent(Context*, int64_t presentationTime) {
   auto device = std::static_pointer_cast<EGLDevice>(this->device);
-  auto eglDisplay = device->eglDisplay;
+  setPresentationTime(presentationTime);
   // eglSurface cannot be nullptr in EGLWindow.
+  eglSwapBuffers(device->eglDisplay, device->eglSurface);
+}
+
+void EGLWindow::onPresentWithDamage(Context* context, const std::vector<Rect>& damageRects,
+                                    int64_t presentationTime) {
+  auto device = std::static_pointer_cast<EGLDevice>(this->device);
+  auto eglDisplay = device->eglDisplay;
   auto eglSurface = device->eglSurface;
-  if (presentationTime != INT64_MIN) {
-    static auto eglPresentationTimeANDROID = reinterpret_cast<PFNEGLPRESENTATIONTIMEANDROIDPROC>(
-        eglGetProcAddress("eglPresentationTimeANDROID"));
-    if (eglPresentationTimeANDROID) {
-      // egl uses nano seconds
-      eglPresentationTimeANDROID(eglDisplay, eglSurface, presentationTime * 1000);
-    }
+  queryExtensions(eglDisplay);
+  EGLint surfaceHeight = 0;
+  if (damageRects.empty() || eglSwapBuffersWithDamage == nullptr ||
+      !eglQuerySurface(eglDisplay, eglSurface, EGL_HEIGHT, &surfaceHeight)) {
+    onPresent(context, presentationTime);
+    return;
+  }
+  setPresentationTime(presentationTime);
+  // The damage rects of EGL are specified with the origin at the bottom-left corner.
+  std::vector<EGLint> rects = {};
+  rects.reserve(damageRects.size() * 4);
+  for (auto& damageRect : damageRects) {
+    auto rect = damageRect;
+    rect.roundOut();
+    rects.push_back(static_cast<EGLint>(rect.left));
+    rects.push_back(surfaceHeight - static_cast<EGLint>(rect.bottom));
+    rects.push_back(static_cast<EGLint>(rect.width()));
+    rects.push_back(static_cast<EGLint>(rect.height()));
+  }
+  eglSwapBuffersWithDamage(eglDisplay, eglSurface, rects.data(),
+                           static_cast<EGLint>(damageRects.size()));
+}
+
+int EGLWindow::onGetBufferAge(Context*) {
+  auto device = std::static_pointer_cast<EGLDevice>(this->device);
+  auto eglDisplay = device->eglDisplay;
+  queryExtensions(eglDisplay);
+  EGLint bufferAge = 0;
+  if (!hasBufferAge ||
+      !eglQuerySurface(eglDisplay, device->eglSurface, EGL_BUFFER_AGE_EXT, &bufferAge)) {
+    return 0;
+  }
+  return bufferAge;
+}
+
+void EGLWindow::queryExtensions(EGLDisplay eglDisplay) {
+  if (extensionsQueried) {
+    return;
+  }
+  extensionsQueried = true;
+  hasBufferAge = HasEGLExtension(eglDisplay, "EGL_EXT_buffer_age") ||
+                 HasEGLExtension(eglDisplay, "EGL_KHR_partial_update");
+  eglSwapBuffersWithDamage = GetSwapBuffersWithDamage(eglDisplay);
+}
+
+void EGLWindow::setPresentationTime(int64_t presentationTime) {
+  if (presentationTime == INT64_MIN) {
+    return;
+  }
+  auto device = std::static_pointer_cast<EGLDevice>(this->device);
+  static auto eglPresentationTimeANDROID = reinterpret_cast<PFNEGLPRESENTATIONTIMEANDROIDPROC>(
+      eglGetProcAddress("eglPresentationTimeANDROID"));
+  if (eglPresentationTimeANDROID) {
+    // egl uses nano seconds
+    eglPresentationTimeANDROID(device->eglDisplay, device->eglSurface, presentationTime * 1000);
   }
-  eglSwapBuffers(eglDisplay, eglSurface);
 }
-}  // namespace tgfx
\ No newline at end of file
+}  // namespace tgfx
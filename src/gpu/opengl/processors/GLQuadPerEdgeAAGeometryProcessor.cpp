@@ -21,16 +21,18 @@
 namespace tgfx {
 PlacementPtr<QuadPerEdgeAAGeometryProcessor> QuadPerEdgeAAGeometryProcessor::Make(
     BlockBuffer* buffer, int width, int height, AAType aa, std::optional<Color> commonColor,
-    std::optional<Matrix> uvMatrix, bool hasSubset) {
+    std::optional<Matrix> uvMatrix, bool hasSubset, bool packedSubset) {
   return buffer->make<GLQuadPerEdgeAAGeometryProcessor>(width, height, aa, commonColor, uvMatrix,
-                                                        hasSubset);
+                                                        hasSubset, packedSubset);
 }
 
 GLQuadPerEdgeAAGeometryProcessor::GLQuadPerEdgeAAGeometryProcessor(int width, int height, AAType aa,
                                                                    std::optional<Color> commonColor,
                                                                    std::optional<Matrix> uvMatrix,
-                                                                   bool hasSubset)
-    : QuadPerEdgeAAGeometryProcessor(width, height, aa, commonColor, uvMatrix, hasSubset) {
+                                                                   bool hasSubset,
+                                                                   bool packedSubset)
+    : QuadPerEdgeAAGeometryProcessor(width, height, aa, commonColor, uvMatrix, hasSubset,
+                                     packedSubset) {
 }
 
 void GLQuadPerEdgeAAGeometryProcessor::emitCode(EmitArgs& args) const {
@@ -95,10 +97,15 @@ void GLQuadPerEdgeAAGeometryProcessor::onEmitTransform(
           uniformHandler->addUniform(ShaderFlags::Vertex, SLType::Float3x3, "texSubsetMatrix");
     }
     vertexBuilder->codeAppend("highp vec4 subset;");
+    std::string subsetValue = subset.name();
+    if (subset.gpuType() == SLType::UShort4) {
+      // Packed subsets hold twice their values.
+      subsetValue = "(" + subsetValue + " * 0.5)";
+    }
     vertexBuilder->codeAppendf("subset.xy = (%s * vec3(%s.xy, 1)).xy;", subsetMatrixName.c_str(),
-                               subset.name().c_str());
+                               subsetValue.c_str());
     vertexBuilder->codeAppendf("subset.zw = (%s * vec3(%s.zw, 1)).xy;", subsetMatrixName.c_str(),
-                               subset.name().c_str());
+                               subsetValue.c_str());
     vertexBuilder->codeAppendf("if (subset.x > subset.z) {");
     vertexBuilder->codeAppendf("  highp float tmp = subset.x;");
     vertexBuilder->codeAppendf("  subset.x = subset.z;");
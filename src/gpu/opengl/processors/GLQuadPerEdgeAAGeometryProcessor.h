@@ -26,7 +26,7 @@ class GLQuadPerEdgeAAGeometryProcessor : public QuadPerEdgeAAGeometryProcessor {
  public:
   GLQuadPerEdgeAAGeometryProcessor(int width, int height, AAType aa,
                                    std::optional<Color> commonColor, std::optional<Matrix> uvMatrix,
-                                   bool hasSubset);
+                                   bool hasSubset, bool packedSubset);
 
   void emitCode(EmitArgs& args) const override;
 
@@ -92,4 +92,11 @@ void AtlasTextOp::execute(RenderPass* renderPass) {
 bool AtlasTextOp::hasCoverage() const {
   return true;
 }
+
+void AtlasTextOp::collectTextureProxies(std::vector<const TextureProxy*>* proxies) const {
+  DrawOp::collectTextureProxies(proxies);
+  if (textureProxy != nullptr) {
+    proxies->push_back(textureProxy.get());
+  }
+}
 }  // namespace tgfx
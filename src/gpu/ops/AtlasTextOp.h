@@ -38,6 +38,8 @@ class AtlasTextOp final : public DrawOp {
 
   bool hasCoverage() const override;
 
+  void collectTextureProxies(std::vector<const TextureProxy*>* proxies) const override;
+
  private:
   size_t rectCount = 0;
   std::optional<Color> commonColor = std::nullopt;
@@ -34,4 +34,16 @@ PlacementPtr<Pipeline> DrawOp::createPipeline(RenderPass* renderPass,
                                                   numColorProcessors, std::move(xferProcessor),
                                                   blendMode, &swizzle);
 }
+
+void DrawOp::collectTextureProxies(std::vector<const TextureProxy*>* proxies) const {
+  for (auto& color : colors) {
+    color->collectTextureProxies(proxies);
+  }
+  for (auto& coverage : coverages) {
+    coverage->collectTextureProxies(proxies);
+  }
+  if (xferProcessor != nullptr) {
+    xferProcessor->collectTextureProxies(proxies);
+  }
+}
 }  // namespace tgfx
@@ -56,6 +56,8 @@ class DrawOp : public Op {
     return !coverages.empty();
   }
 
+  void collectTextureProxies(std::vector<const TextureProxy*>* proxies) const override;
+
  protected:
   AAType aaType = AAType::None;
 
@@ -20,6 +20,7 @@
 
 #include "core/utils/BlockBuffer.h"
 #include "gpu/RenderTarget.h"
+#include "gpu/proxies/TextureProxy.h"
 
 namespace tgfx {
 class RenderPass;
@@ -29,5 +30,11 @@ class Op {
   virtual ~Op() = default;
 
   virtual void execute(RenderPass* renderPass) = 0;
+
+  /**
+   * Collects the texture proxies sampled by this op.
+   */
+  virtual void collectTextureProxies(std::vector<const TextureProxy*>*) const {
+  }
 };
 }  // namespace tgfx
@@ -55,6 +55,7 @@ RectDrawOp::RectDrawOp(RectsVertexProvider* provider)
     commonColor = provider->firstColor();
   }
   hasSubset = provider->hasSubset();
+  packedSubset = provider->hasPackedSubset();
 }
 
 void RectDrawOp::execute(RenderPass* renderPass) {
@@ -74,7 +75,7 @@ void RectDrawOp::execute(RenderPass* renderPass) {
   auto drawingBuffer = renderPass->getContext()->drawingBuffer();
   auto gp = QuadPerEdgeAAGeometryProcessor::Make(drawingBuffer, renderTarget->width(),
                                                  renderTarget->height(), aaType, commonColor,
-                                                 uvMatrix, hasSubset);
+                                                 uvMatrix, hasSubset, packedSubset);
   auto pipeline = createPipeline(renderPass, std::move(gp));
   renderPass->bindProgramAndScissorClip(pipeline.get(), scissorRect());
   renderPass->bindBuffers(indexBuffer, vertexBuffer, vertexBufferProxy->offset());
@@ -54,6 +54,7 @@ class RectDrawOp : public DrawOp {
   std::optional<Color> commonColor = std::nullopt;
   std::optional<Matrix> uvMatrix = std::nullopt;
   bool hasSubset = false;
+  bool packedSubset = false;
   std::shared_ptr<GPUBufferProxy> indexBufferProxy = nullptr;
   std::shared_ptr<VertexBufferProxy> vertexBufferProxy = nullptr;
 
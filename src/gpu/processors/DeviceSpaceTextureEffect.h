@@ -36,6 +36,10 @@ class DeviceSpaceTextureEffect : public FragmentProcessor {
 
   DeviceSpaceTextureEffect(std::shared_ptr<TextureProxy> textureProxy, const Matrix& uvMatrix);
 
+  void onCollectTextureProxies(std::vector<const TextureProxy*>* proxies) const override {
+    proxies->push_back(textureProxy.get());
+  }
+
   size_t onCountTextureSamplers() const override {
     return 1;
   }
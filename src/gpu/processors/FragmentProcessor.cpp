@@ -94,6 +94,13 @@ void FragmentProcessor::computeProcessorKey(Context* context, BytesKey* bytesKey
   }
 }
 
+void FragmentProcessor::collectTextureProxies(std::vector<const TextureProxy*>* proxies) const {
+  onCollectTextureProxies(proxies);
+  for (const auto& childProcessor : childProcessors) {
+    childProcessor->collectTextureProxies(proxies);
+  }
+}
+
 size_t FragmentProcessor::registerChildProcessor(PlacementPtr<FragmentProcessor> child) {
   auto index = childProcessors.size();
   childProcessors.push_back(std::move(child));
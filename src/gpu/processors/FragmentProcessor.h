@@ -124,6 +124,11 @@ class FragmentProcessor : public Processor {
 
   void computeProcessorKey(Context* context, BytesKey* bytesKey) const override;
 
+  /**
+   * Collects the texture proxies sampled by this processor and all of its children.
+   */
+  void collectTextureProxies(std::vector<const TextureProxy*>* proxies) const;
+
   size_t numChildProcessors() const {
     return childProcessors.size();
   }
@@ -320,6 +325,9 @@ class FragmentProcessor : public Processor {
     return 0;
   }
 
+  virtual void onCollectTextureProxies(std::vector<const TextureProxy*>*) const {
+  }
+
   virtual const TextureSampler* onTextureSampler(size_t) const {
     return nullptr;
   }
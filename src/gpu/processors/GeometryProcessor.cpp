@@ -45,6 +45,8 @@ static constexpr size_t VertexAttribTypeSize(SLType type) {
       return 4 * sizeof(int32_t);
     case SLType::UByte4Color:
       return 4 * sizeof(uint8_t);
+    case SLType::UShort4:
+      return 4 * sizeof(uint16_t);
     default:
       return 0;
   }
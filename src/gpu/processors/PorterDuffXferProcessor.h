@@ -38,6 +38,12 @@ class PorterDuffXferProcessor : public XferProcessor {
     return dstTextureInfo.requiresBarrier;
   }
 
+  void collectTextureProxies(std::vector<const TextureProxy*>* proxies) const override {
+    if (dstTextureInfo.textureProxy != nullptr) {
+      proxies->push_back(dstTextureInfo.textureProxy.get());
+    }
+  }
+
   void computeProcessorKey(Context* context, BytesKey* bytesKey) const override;
 
  protected:
@@ -22,7 +22,7 @@ namespace tgfx {
 QuadPerEdgeAAGeometryProcessor::QuadPerEdgeAAGeometryProcessor(int width, int height, AAType aa,
                                                                std::optional<Color> commonColor,
                                                                std::optional<Matrix> uvMatrix,
-                                                               bool hasSubset)
+                                                               bool hasSubset, bool packedSubset)
     : GeometryProcessor(ClassID()), width(width), height(height), aa(aa), commonColor(commonColor),
       uvMatrix(uvMatrix), hasSubset(hasSubset) {
   position = {"aPosition", SLType::Float2};
@@ -36,7 +36,7 @@ QuadPerEdgeAAGeometryProcessor::QuadPerEdgeAAGeometryProcessor(int width, int he
     color = {"inColor", SLType::UByte4Color};
   }
   if (hasSubset) {
-    subset = {"texSubset", SLType::Float4};
+    subset = {"texSubset", packedSubset ? SLType::UShort4 : SLType::Float4};
   }
   setVertexAttributes(&position, 5);
 }
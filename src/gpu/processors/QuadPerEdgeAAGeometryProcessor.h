@@ -30,7 +30,7 @@ class QuadPerEdgeAAGeometryProcessor : public GeometryProcessor {
                                                            int height, AAType aa,
                                                            std::optional<Color> commonColor,
                                                            std::optional<Matrix> uvMatrix,
-                                                           bool hasSubset);
+                                                           bool hasSubset, bool packedSubset);
   std::string name() const override {
     return "QuadPerEdgeAAGeometryProcessor";
   }
@@ -38,7 +38,8 @@ class QuadPerEdgeAAGeometryProcessor : public GeometryProcessor {
  protected:
   DEFINE_PROCESSOR_CLASS_ID
   QuadPerEdgeAAGeometryProcessor(int width, int height, AAType aa, std::optional<Color> commonColor,
-                                 std::optional<Matrix> uvMatrix, bool hasSubset);
+                                 std::optional<Matrix> uvMatrix, bool hasSubset,
+                                 bool packedSubset);
 
   void onComputeProcessorKey(BytesKey* bytesKey) const override;
 
@@ -46,7 +47,7 @@ class QuadPerEdgeAAGeometryProcessor : public GeometryProcessor {
   Attribute coverage;
   Attribute uvCoord;
   Attribute color;
-  Attribute subset;
+  Attribute subset;  // Packed as unsigned shorts holding twice the values if packedSubset is true
 
   int width = 1;
   int height = 1;
@@ -42,6 +42,10 @@ class TextureGradientColorizer : public FragmentProcessor {
     return 1;
   }
 
+  void onCollectTextureProxies(std::vector<const TextureProxy*>* proxies) const override {
+    proxies->push_back(gradient.get());
+  }
+
   const TextureSampler* onTextureSampler(size_t) const override {
     auto texture = gradient->getTexture();
     return texture ? texture->getSampler() : nullptr;
@@ -65,6 +65,10 @@ class TiledTextureEffect : public FragmentProcessor {
 
   void onComputeProcessorKey(BytesKey* bytesKey) const override;
 
+  void onCollectTextureProxies(std::vector<const TextureProxy*>* proxies) const override {
+    proxies->push_back(textureProxy.get());
+  }
+
   size_t onCountTextureSamplers() const override;
 
   const TextureSampler* onTextureSampler(size_t) const override;
@@ -58,6 +58,12 @@ class XferProcessor : public Processor {
     return false;
   }
 
+  /**
+   * Collects the texture proxies sampled by this processor.
+   */
+  virtual void collectTextureProxies(std::vector<const TextureProxy*>*) const {
+  }
+
   virtual void emitCode(const EmitArgs& args) const = 0;
 
   virtual void setData(UniformBuffer* uniformBuffer) const = 0;
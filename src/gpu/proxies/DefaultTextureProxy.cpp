@@ -30,11 +30,15 @@ std::shared_ptr<Texture> DefaultTextureProxy::getTexture() const {
     if (resource != nullptr && !uniqueKey.empty()) {
       resource->assignUniqueKey(uniqueKey);
     }
+    applyResourceCategory();
   }
   return std::static_pointer_cast<Texture>(resource);
 }
 
 std::shared_ptr<Texture> DefaultTextureProxy::onMakeTexture(Context* context) const {
+  if (reusesLargerBackingStore()) {
+    return Texture::MakeApprox(context, _width, _height, _format, _mipmapped, _origin);
+  }
   return Texture::MakeFormat(context, _backingStoreWidth, _backingStoreHeight, _format, _mipmapped,
                              _origin);
 }
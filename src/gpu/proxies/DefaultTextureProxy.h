@@ -31,6 +31,15 @@ class DefaultTextureProxy : public TextureProxy {
 
   virtual std::shared_ptr<Texture> onMakeTexture(Context* context) const;
 
+  /**
+   * Returns true if the backing store can be any idle texture from a larger size class. Only
+   * proxies with the TopLeft origin qualify, as the origin transform of BottomLeft ones depends on
+   * the backing store height, which is used before the texture is created.
+   */
+  bool reusesLargerBackingStore() const {
+    return _backingFit == BackingFit::Approx && _origin == ImageOrigin::TopLeft;
+  }
+
  private:
   UniqueKey uniqueKey = {};
 
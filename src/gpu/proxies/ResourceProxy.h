@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <optional>
 #include "gpu/Resource.h"
 
 namespace tgfx {
@@ -36,15 +37,31 @@ class ResourceProxy {
     return context;
   }
 
+  /**
+   * Sets the category the GPU memory of this proxy is accounted under once it is instantiated.
+   * Otherwise, the category is derived from the type of the resource.
+   */
+  void setResourceCategory(ResourceCategory category) {
+    resourceCategory = category;
+    applyResourceCategory();
+  }
+
  protected:
   Context* context = nullptr;
   mutable std::shared_ptr<Resource> resource = nullptr;
+  std::optional<ResourceCategory> resourceCategory = std::nullopt;
 
   explicit ResourceProxy(std::shared_ptr<Resource> resource) : resource(std::move(resource)) {
   }
 
   ResourceProxy() = default;
 
+  void applyResourceCategory() const {
+    if (resource != nullptr && resourceCategory.has_value()) {
+      resource->setCategory(*resourceCategory);
+    }
+  }
+
   friend class ResourceTask;
   friend class ShapeBufferUploadTask;
   friend class ProxyProvider;
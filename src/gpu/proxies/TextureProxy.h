@@ -19,6 +19,7 @@
 #pragma once
 
 #include "ResourceProxy.h"
+#include "gpu/BackingFit.h"
 #include "gpu/Texture.h"
 #include "gpu/opengl/GLCaps.h"
 
@@ -101,6 +102,7 @@ class TextureProxy : public ResourceProxy {
   int _height = 0;
   int _backingStoreWidth = 0;
   int _backingStoreHeight = 0;
+  BackingFit _backingFit = BackingFit::Exact;
   PixelFormat _format = PixelFormat::RGBA_8888;
   bool _mipmapped = false;
   ImageOrigin _origin = ImageOrigin::TopLeft;
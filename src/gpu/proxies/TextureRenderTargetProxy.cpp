@@ -35,8 +35,14 @@ std::shared_ptr<Texture> TextureRenderTargetProxy::onMakeTexture(Context* contex
   if (_externallyOwned) {
     return nullptr;
   }
-  auto renderTarget = RenderTarget::Make(context, _backingStoreWidth, _backingStoreHeight, _format,
-                                         _sampleCount, _mipmapped, _origin);
+  std::shared_ptr<RenderTarget> renderTarget = nullptr;
+  if (reusesLargerBackingStore()) {
+    renderTarget = RenderTarget::MakeApprox(context, _width, _height, _format, _sampleCount,
+                                            _mipmapped, _origin);
+  } else {
+    renderTarget = RenderTarget::Make(context, _backingStoreWidth, _backingStoreHeight, _format,
+                                      _sampleCount, _mipmapped, _origin);
+  }
   if (renderTarget == nullptr) {
     LOGE("TextureRenderTargetProxy::onMakeTexture() Failed to create the render target!");
     return nullptr;
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "GPUBufferUploadTask.h"
+#include "core/utils/Profiling.h"
 #include "tgfx/core/Task.h"
 
 namespace tgfx {
@@ -30,6 +31,7 @@ std::shared_ptr<Resource> GPUBufferUploadTask::onMakeResource(Context* context)
   if (source == nullptr) {
     return nullptr;
   }
+  OperateMark("GPUBufferUploadTask::onMakeResource");
   auto data = source->getData();
   if (data == nullptr || data->empty()) {
     LOGE("GPUBufferUploadTask::onMakeResource() Failed to get data!");
@@ -39,6 +41,8 @@ std::shared_ptr<Resource> GPUBufferUploadTask::onMakeResource(Context* context)
   if (gpuBuffer == nullptr) {
     LOGE("GPUBufferUploadTask::onMakeResource failed to upload the GPUBuffer!");
   } else {
+    CounterMark(BufferUploads, 1);
+    CounterMark(UploadBytes, data->size());
     // Free the data source immediately to reduce memory pressure.
     source = nullptr;
   }
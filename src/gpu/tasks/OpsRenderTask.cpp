@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "OpsRenderTask.h"
+#include "core/utils/Profiling.h"
 #include "gpu/GPU.h"
 #include "gpu/RenderPass.h"
 
@@ -29,6 +30,8 @@ bool OpsRenderTask::execute(RenderPass* renderPass) {
     LOGE("OpsRenderTask::execute() Failed to initialize the render pass!");
     return false;
   }
+  OperateMark("OpsRenderTask::execute");
+  CounterMark(DrawOps, ops.size());
   auto tempOps = std::move(ops);
   for (auto& op : tempOps) {
     op->execute(renderPass);
@@ -37,4 +40,15 @@ bool OpsRenderTask::execute(RenderPass* renderPass) {
   renderPass->end();
   return true;
 }
+
+void OpsRenderTask::collectProxies(RenderTaskProxies* proxies) const {
+  proxies->addWrite(renderTargetProxy.get());
+  std::vector<const TextureProxy*> textureProxies = {};
+  for (auto& op : ops) {
+    op->collectTextureProxies(&textureProxies);
+  }
+  for (auto& textureProxy : textureProxies) {
+    proxies->addRead(textureProxy);
+  }
+}
 }  // namespace tgfx
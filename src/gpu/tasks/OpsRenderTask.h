@@ -31,6 +31,8 @@ class OpsRenderTask : public RenderTask {
 
   bool execute(RenderPass* renderPass) override;
 
+  void collectProxies(RenderTaskProxies* proxies) const override;
+
  private:
   PlacementArray<Op> ops = {};
 };
@@ -43,4 +43,9 @@ bool RenderTargetCopyTask::execute(RenderPass* renderPass) {
   return true;
 }
 
+void RenderTargetCopyTask::collectProxies(RenderTaskProxies* proxies) const {
+  proxies->addWrite(dest.get());
+  proxies->addRead(renderTargetProxy.get());
+}
+
 }  // namespace tgfx
@@ -29,6 +29,8 @@ class RenderTargetCopyTask : public RenderTask {
  protected:
   bool execute(RenderPass* renderPass) override;
 
+  void collectProxies(RenderTaskProxies* proxies) const override;
+
  private:
   std::shared_ptr<TextureProxy> dest = nullptr;
 };
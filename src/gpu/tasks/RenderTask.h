@@ -21,6 +21,7 @@
 #include "core/utils/Log.h"
 #include "gpu/GPU.h"
 #include "gpu/RenderPass.h"
+#include "gpu/RenderTaskGraph.h"
 #include "gpu/proxies/RenderTargetProxy.h"
 
 namespace tgfx {
@@ -30,6 +31,14 @@ class RenderTask {
 
   virtual bool execute(RenderPass* renderPass) = 0;
 
+  /**
+   * Collects the proxies this task reads from and writes to, which determine the execution order of
+   * tasks in a RenderTaskGraph. By default, the task only writes to its render target.
+   */
+  virtual void collectProxies(RenderTaskProxies* proxies) const {
+    proxies->addWrite(renderTargetProxy.get());
+  }
+
  protected:
   explicit RenderTask(std::shared_ptr<RenderTargetProxy> proxy)
       : renderTargetProxy(std::move(proxy)) {
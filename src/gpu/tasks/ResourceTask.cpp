@@ -35,6 +35,7 @@ bool ResourceTask::execute(Context* context) {
     resource->assignUniqueKey(uniqueKey);
   }
   proxy->resource = std::move(resource);
+  proxy->applyResourceCategory();
   return true;
 }
 }  // namespace tgfx
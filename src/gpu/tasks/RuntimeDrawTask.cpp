@@ -86,6 +86,13 @@ bool RuntimeDrawTask::execute(RenderPass* renderPass) {
                         renderTarget->getBackendRenderTarget(), offset);
 }
 
+void RuntimeDrawTask::collectProxies(RenderTaskProxies* proxies) const {
+  proxies->addWrite(renderTargetProxy.get());
+  for (auto& input : inputTextures) {
+    proxies->addRead(input.get());
+  }
+}
+
 std::shared_ptr<Texture> RuntimeDrawTask::GetFlatTexture(
     RenderPass* renderPass, std::shared_ptr<TextureProxy> textureProxy,
     std::shared_ptr<VertexBufferProxy> vertexBufferProxy) {
@@ -31,6 +31,8 @@ class RuntimeDrawTask : public RenderTask {
 
   bool execute(RenderPass* renderPass) override;
 
+  void collectProxies(RenderTaskProxies* proxies) const override;
+
  private:
   std::vector<std::shared_ptr<TextureProxy>> inputTextures = {};
   std::vector<std::shared_ptr<VertexBufferProxy>> inputVertexBuffers = {};
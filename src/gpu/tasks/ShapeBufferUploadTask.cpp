@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "ShapeBufferUploadTask.h"
+#include "core/utils/Profiling.h"
 #include "gpu/GPUBuffer.h"
 #include "gpu/Texture.h"
 
@@ -32,6 +33,7 @@ std::shared_ptr<Resource> ShapeBufferUploadTask::onMakeResource(Context* context
   if (source == nullptr) {
     return nullptr;
   }
+  OperateMark("ShapeBufferUploadTask::onMakeResource");
   auto shapeBuffer = source->getData();
   if (shapeBuffer == nullptr) {
     // No need to log an error here; the shape might not be a filled path or could be invisible.
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "TextureUploadTask.h"
+#include "core/utils/Profiling.h"
 #include "gpu/Texture.h"
 
 namespace tgfx {
@@ -30,6 +31,7 @@ std::shared_ptr<Resource> TextureUploadTask::onMakeResource(Context* context) {
   if (source == nullptr) {
     return nullptr;
   }
+  OperateMark("TextureUploadTask::onMakeResource");
   auto imageBuffer = source->getData();
   if (imageBuffer == nullptr) {
     LOGE("TextureUploadTask::onMakeResource() Failed to decode the image!");
@@ -39,6 +41,8 @@ std::shared_ptr<Resource> TextureUploadTask::onMakeResource(Context* context) {
   if (texture == nullptr) {
     LOGE("TextureUploadTask::onMakeResource() Failed to upload the texture!");
   } else {
+    CounterMark(TextureUploads, 1);
+    CounterMark(UploadBytes, texture->memoryUsage());
     // Free the image source immediately to reduce memory pressure.
     source = nullptr;
   }
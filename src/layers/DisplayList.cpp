@@ -20,9 +20,15 @@
 #include "core/utils/DecomposeRects.h"
 #include "core/utils/Log.h"
 #include "core/utils/MathExtra.h"
+#include "core/utils/Profiling.h"
+#include "core/utils/UniqueID.h"
+#include "gpu/ProxyProvider.h"
 #include "layers/DrawArgs.h"
 #include "layers/RootLayer.h"
 #include "layers/TileCache.h"
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Recorder.h"
+#include "tgfx/core/Shader.h"
 
 #ifdef TGFX_USE_INSPECTOR
 #include "layers/LayerViewerManager.h"
@@ -30,10 +36,15 @@
 
 namespace tgfx {
 static constexpr size_t MAX_DIRTY_REGION_FRAMES = 5;
+static constexpr size_t MAX_BUFFER_AGE = 4;
 static constexpr float DIRTY_REGION_ANTIALIAS_MARGIN = 0.5f;
 static constexpr int MIN_TILE_SIZE = 16;
 static constexpr int MAX_TILE_SIZE = 2048;
 static constexpr int MAX_ATLAS_SIZE = 8192;
+// The number of frames ahead of the viewport that tiles are prefetched for while panning.
+static constexpr int MAX_PREFETCH_FRAMES = 4;
+// The rendering time per frame, in microseconds, that prefetching is allowed to fill up to.
+static constexpr int64_t PREFETCH_FRAME_TIME = 8000;
 
 class DrawTask {
  public:
@@ -55,6 +66,13 @@ class DrawTask {
     return tiles.front()->sourceIndex;
   }
 
+  /**
+   * Returns true if the tiles are stored at half resolution in the demoted atlas.
+   */
+  bool demoted() const {
+    return tiles.front()->demoted;
+  }
+
   /**
    * Returns the source rectangle of the tile in the atlas.
    */
@@ -83,9 +101,18 @@ class DrawTask {
     auto& tile = tiles.front();
     _tileRect = drawRect.isEmpty() ? tile->getTileRect(tileSize) : drawRect;
     _sourceRect = _tileRect;
-    auto offsetX = (tile->sourceX - tile->tileX) * tileSize;
-    auto offsetY = (tile->sourceY - tile->tileY) * tileSize;
-    _sourceRect.offset(static_cast<float>(offsetX), static_cast<float>(offsetY));
+    if (tile->demoted) {
+      // Demoted tiles are stored at half resolution.
+      _sourceRect.offset(static_cast<float>(-tile->tileX * tileSize),
+                         static_cast<float>(-tile->tileY * tileSize));
+      _sourceRect.scale(0.5f, 0.5f);
+      auto sourceOffset = tile->getSourceRect(tileSize);
+      _sourceRect.offset(sourceOffset.left, sourceOffset.top);
+    } else {
+      auto offsetX = (tile->sourceX - tile->tileX) * tileSize;
+      auto offsetY = (tile->sourceY - tile->tileY) * tileSize;
+      _sourceRect.offset(static_cast<float>(offsetX), static_cast<float>(offsetY));
+    }
     _tileRect.scale(scale, scale);
     _tileRect.round();
   }
@@ -141,6 +168,7 @@ void DisplayList::setZoomScale(float zoomScale) {
   }
   _hasContentChanged = true;
   _zoomScaleInt = zoomScaleInt;
+  zoomScaleChanged = true;
 }
 
 void DisplayList::setZoomScalePrecision(int precision) {
@@ -214,6 +242,16 @@ void DisplayList::setMaxTileCount(int count) {
   resetCaches();
 }
 
+void DisplayList::setDemoteInactiveTiles(bool value) {
+  if (_demoteInactiveTiles == value) {
+    return;
+  }
+  _demoteInactiveTiles = value;
+  if (_renderMode == RenderMode::Tiled) {
+    resetCaches();
+  }
+}
+
 void DisplayList::showDirtyRegions(bool show) {
   if (_showDirtyRegions == show) {
     return;
@@ -225,7 +263,8 @@ void DisplayList::showDirtyRegions(bool show) {
 }
 
 bool DisplayList::hasContentChanged() const {
-  if (_hasContentChanged || hasZoomBlurTiles || _root->bitFields.dirtyDescendents) {
+  if (_hasContentChanged || hasZoomBlurTiles || hasZoomBlurShapes ||
+      _root->bitFields.dirtyDescendents) {
     return true;
   }
   if (!_showDirtyRegions) {
@@ -239,36 +278,173 @@ bool DisplayList::hasContentChanged() const {
   return false;
 }
 
-void DisplayList::render(Surface* surface, bool autoClear) {
+std::vector<Rect> DisplayList::render(Surface* surface, bool autoClear, int bufferAge) {
+  DEBUG_ASSERT(lastCommittedFrame == nullptr);
   if (!surface) {
-    return;
+    return {};
   }
+  OperateMark("DisplayList::render");
 #ifdef TGFX_USE_INSPECTOR
   LayerViewerManager::Get().RenderImageAndSend(surface->getContext());
 #endif
   _hasContentChanged = false;
   auto dirtyRegions = _root->updateDirtyRegions();
+  auto surfaceRect = Rect::MakeWH(surface->width(), surface->height());
+  std::vector<Rect> damageRects = {surfaceRect};
   if (_zoomScaleInt == 0) {
     if (autoClear) {
       auto canvas = surface->getCanvas();
       canvas->clear();
+    } else {
+      damageRects = {};
     }
-    return;
-  }
+    recordDamageRects(surface, damageRects);
+    return damageRects;
+  }
+  // While zooming in the direct and partial modes, shapes may be drawn from their caches at the
+  // closest scale.
+  auto proxyProvider = surface->getContext()->proxyProvider();
+  auto useZoomBlur = _allowZoomBlur && _renderMode != RenderMode::Tiled && zoomScaleChanged;
+  zoomScaleChanged = false;
+  proxyProvider->setShapeScaleFallback(useZoomBlur);
   switch (_renderMode) {
     case RenderMode::Direct:
       dirtyRegions = renderDirect(surface, autoClear);
       break;
     case RenderMode::Partial:
-      dirtyRegions = renderPartial(surface, autoClear, dirtyRegions);
+      // Pans are still served by shifting the partial cache, which is cheaper than redrawing the
+      // whole back buffer.
+      if (bufferAge > 0 && autoClear && !_showDirtyRegions && lastContentOffset == _contentOffset) {
+        dirtyRegions = renderBackBuffer(surface, dirtyRegions, bufferAge);
+        damageRects = dirtyRegions;
+      } else {
+        dirtyRegions = renderPartial(surface, autoClear, dirtyRegions);
+      }
       break;
     case RenderMode::Tiled:
       dirtyRegions = renderTiled(surface, autoClear, dirtyRegions);
       break;
   }
+  // Shapes rasterized while zooming use quantized scales, so redraw them once the zooming stops.
+  hasZoomBlurShapes = useZoomBlur;
+  proxyProvider->setShapeScaleFallback(false);
   if (_showDirtyRegions) {
     renderDirtyRegions(surface->getCanvas(), std::move(dirtyRegions));
   }
+  recordDamageRects(surface, damageRects);
+  return damageRects;
+}
+
+std::shared_ptr<DisplayFrame> DisplayList::commit() {
+  DEBUG_ASSERT(frame == nullptr);
+  auto dirtyRegions = _root->updateDirtyRegions();
+  _hasContentChanged = false;
+  auto zoomScale = ToZoomScaleFloat(_zoomScaleInt, _zoomScalePrecision);
+  std::vector<DisplayFrame::LayerPicture> layerPictures = {};
+  if (lastCommittedFrame && dirtyRegions.empty() && lastCommittedFrame->_zoomScale == zoomScale) {
+    // The layer tree is unchanged, so the recordings of the last frame are reused.
+    layerPictures = lastCommittedFrame->layerPictures;
+  } else {
+    layerPictures = recordLayers(zoomScale, dirtyRegions);
+  }
+  auto previousID = lastCommittedFrame ? lastCommittedFrame->uniqueID : 0;
+  lastCommittedFrame = std::shared_ptr<DisplayFrame>(
+      new DisplayFrame(UniqueID::Next(), previousID, std::move(layerPictures),
+                       _root->opaqueBounds, std::move(dirtyRegions), zoomScale, _contentOffset));
+  return lastCommittedFrame;
+}
+
+static bool IntersectsAny(const Rect& bounds, const std::vector<Rect>& rects) {
+  for (auto& rect : rects) {
+    if (Rect::Intersects(bounds, rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::shared_ptr<Picture> RecordLayer(const DrawArgs& args, Layer* layer, float zoomScale,
+                                            const Matrix& matrix, const Rect* clipRect,
+                                            float alpha, BlendMode blendMode) {
+  // The layers are recorded at the current zoomScale, so the filters and layer styles are
+  // rasterized at the resolution they are displayed at.
+  Recorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  canvas->scale(zoomScale, zoomScale);
+  canvas->concat(matrix);
+  if (clipRect != nullptr) {
+    canvas->clipRect(*clipRect);
+  }
+  layer->drawLayer(args, canvas, alpha, blendMode);
+  return recorder.finishRecordingAsPicture();
+}
+
+std::vector<DisplayFrame::LayerPicture> DisplayList::recordLayers(
+    float zoomScale, const std::vector<Rect>& dirtyRegions) const {
+  DrawArgs args(nullptr);
+  std::vector<DisplayFrame::LayerPicture> layerPictures = {};
+  if (!_root->_filters.empty() || !_root->_layerStyles.empty()) {
+    // The effects of the root layer apply to all the layers together.
+    auto picture = RecordLayer(args, _root.get(), zoomScale, Matrix::I(), nullptr, 1.0f,
+                               BlendMode::SrcOver);
+    if (picture != nullptr) {
+      layerPictures.push_back({_root.get(), _root->renderBounds, std::move(picture)});
+    }
+    return layerPictures;
+  }
+  std::unordered_map<const Layer*, const DisplayFrame::LayerPicture*> lastPictures = {};
+  if (lastCommittedFrame != nullptr && lastCommittedFrame->_zoomScale == zoomScale) {
+    for (auto& layerPicture : lastCommittedFrame->layerPictures) {
+      lastPictures[layerPicture.layer] = &layerPicture;
+    }
+  }
+  layerPictures.reserve(_root->_children.size());
+  for (auto& child : _root->_children) {
+    if (child->maskOwner || !child->visible() || child->_alpha <= 0 ||
+        child->renderBounds.isEmpty()) {
+      continue;
+    }
+    auto result = lastPictures.find(child.get());
+    if (result != lastPictures.end() && !IntersectsAny(result->second->bounds, dirtyRegions) &&
+        !IntersectsAny(child->renderBounds, dirtyRegions)) {
+      // Any change to the layer or its descendants invalidates their old and new bounds, so the
+      // recording is still valid if neither of them is dirty. This also rules out a new layer
+      // allocated at the address of a removed one, whose bounds are dirty.
+      layerPictures.push_back(*result->second);
+      continue;
+    }
+    auto picture = RecordLayer(args, child.get(), zoomScale, child->getMatrixWithScrollRect(),
+                               child->_scrollRect.get(), child->_alpha,
+                               static_cast<BlendMode>(child->bitFields.blendMode));
+    if (picture != nullptr) {
+      layerPictures.push_back({child.get(), child->renderBounds, std::move(picture)});
+    }
+  }
+  return layerPictures;
+}
+
+void DisplayList::setFrame(std::shared_ptr<DisplayFrame> newFrame) {
+  if (frame == newFrame) {
+    return;
+  }
+  if (frame == nullptr || newFrame == nullptr || newFrame->previousID != frame->uniqueID) {
+    // Switching between the frames and the layer tree changes the whole content. So does skipping
+    // frames, since the dirty regions of the skipped ones are unknown here.
+    resetCaches();
+    damageHistory.clear();
+    lastSurfaceID = 0;
+    _hasContentChanged = true;
+  } else if (!newFrame->_dirtyRegions.empty()) {
+    for (auto& dirtyRegion : newFrame->_dirtyRegions) {
+      _root->invalidateRect(dirtyRegion);
+    }
+    _hasContentChanged = true;
+  }
+  frame = std::move(newFrame);
+  if (frame != nullptr) {
+    setZoomScale(frame->_zoomScale);
+    setContentOffset(frame->_contentOffset.x, frame->_contentOffset.y);
+  }
 }
 
 std::vector<Rect> DisplayList::renderDirect(Surface* surface, bool autoClear) const {
@@ -300,6 +476,50 @@ static std::vector<Rect> MapDirtyRegions(const std::vector<Rect>& dirtyRegions,
   }
   return dirtyRects;
 }
+
+static bool CanScrollSurface(const Surface* surface, float scrollX, float scrollY) {
+  return scrollX == roundf(scrollX) && scrollY == roundf(scrollY) &&
+         fabsf(scrollX) < static_cast<float>(surface->width()) &&
+         fabsf(scrollY) < static_cast<float>(surface->height());
+}
+
+/**
+ * Shifts the contents of the surface by the given integer offset with a single textured fill, and
+ * returns the strips exposed by the shift, which are left with stale pixels.
+ */
+static std::vector<Rect> ScrollSurface(Surface* surface, float scrollX, float scrollY) {
+  auto width = static_cast<float>(surface->width());
+  auto height = static_cast<float>(surface->height());
+  // The shader keeps the old content alive, so the surface draws into a new render target instead
+  // of sampling from itself. The fill covers the whole surface, so the old pixels aren't copied.
+  auto shader = Shader::MakeImageShader(surface->makeImageSnapshot(), TileMode::Clamp,
+                                        TileMode::Clamp, SamplingOptions(FilterMode::Nearest));
+  Paint paint = {};
+  paint.setShader(shader->makeWithMatrix(Matrix::MakeTrans(scrollX, scrollY)));
+  paint.setBlendMode(BlendMode::Src);
+  paint.setAntiAlias(false);
+  auto canvas = surface->getCanvas();
+  AutoCanvasRestore autoRestore(canvas);
+  canvas->resetMatrix();
+  canvas->drawPaint(paint);
+  std::vector<Rect> exposedRects = {};
+  auto top = 0.0f;
+  auto bottom = height;
+  if (scrollY > 0) {
+    exposedRects.push_back(Rect::MakeLTRB(0, 0, width, scrollY));
+    top = scrollY;
+  } else if (scrollY < 0) {
+    exposedRects.push_back(Rect::MakeLTRB(0, height + scrollY, width, height));
+    bottom = height + scrollY;
+  }
+  if (scrollX > 0) {
+    exposedRects.push_back(Rect::MakeLTRB(0, top, scrollX, bottom));
+  } else if (scrollX < 0) {
+    exposedRects.push_back(Rect::MakeLTRB(width + scrollX, top, width, bottom));
+  }
+  return exposedRects;
+}
+
 std::vector<Rect> DisplayList::renderPartial(Surface* surface, bool autoClear,
                                              const std::vector<Rect>& dirtyRegions) {
   auto context = surface->getContext();
@@ -319,13 +539,22 @@ std::vector<Rect> DisplayList::renderPartial(Surface* surface, bool autoClear,
   auto viewMatrix = getViewMatrix();
   auto surfaceRect = Rect::MakeWH(surface->width(), surface->height());
   std::vector<Rect> drawRects = {};
-  if (cacheChanged || lastZoomScaleInt != _zoomScaleInt || lastContentOffset != _contentOffset) {
+  auto scrollX = _contentOffset.x - lastContentOffset.x;
+  auto scrollY = _contentOffset.y - lastContentOffset.y;
+  if (cacheChanged || hasZoomBlurShapes || lastZoomScaleInt != _zoomScaleInt ||
+      !CanScrollSurface(partialCache.get(), scrollX, scrollY)) {
     drawRects = {surfaceRect};
-    lastZoomScaleInt = _zoomScaleInt;
-    lastContentOffset = _contentOffset;
   } else {
     drawRects = MapDirtyRegions(dirtyRegions, viewMatrix, true, &surfaceRect);
+    if (scrollX != 0 || scrollY != 0) {
+      // A pure integer pan moves the cached pixels as a whole, so only the exposed strips need to
+      // be drawn in addition to the dirty regions.
+      auto exposedRects = ScrollSurface(partialCache.get(), scrollX, scrollY);
+      drawRects.insert(drawRects.end(), exposedRects.begin(), exposedRects.end());
+    }
   }
+  lastZoomScaleInt = _zoomScaleInt;
+  lastContentOffset = _contentOffset;
   auto canvas = surface->getCanvas();
   for (auto& drawRect : drawRects) {
     drawRootLayer(partialCache.get(), drawRect, viewMatrix, true);
@@ -342,11 +571,55 @@ std::vector<Rect> DisplayList::renderPartial(Surface* surface, bool autoClear,
   return drawRects;
 }
 
+std::vector<Rect> DisplayList::renderBackBuffer(Surface* surface,
+                                                const std::vector<Rect>& dirtyRegions,
+                                                int bufferAge) {
+  // The partial cache is stale once the surface is drawn directly, and it is no longer needed.
+  surfaceCaches.clear();
+  auto surfaceRect = Rect::MakeWH(surface->width(), surface->height());
+  auto historyCount = static_cast<size_t>(bufferAge - 1);
+  if (surface->uniqueID() != lastSurfaceID || historyCount > damageHistory.size() ||
+      hasZoomBlurShapes || lastZoomScaleInt != _zoomScaleInt) {
+    lastZoomScaleInt = _zoomScaleInt;
+    return renderDirect(surface, true);
+  }
+  auto viewMatrix = getViewMatrix();
+  auto drawRects = MapDirtyRegions(dirtyRegions, viewMatrix, false, &surfaceRect);
+  // The surface still holds the frame rendered bufferAge frames ago, so the regions changed by the
+  // frames presented since then have to be redrawn as well.
+  for (auto i = damageHistory.size() - historyCount; i < damageHistory.size(); i++) {
+    auto& rects = damageHistory[i];
+    drawRects.insert(drawRects.end(), rects.begin(), rects.end());
+  }
+  DecomposeRects(drawRects.data(), drawRects.size());
+  std::vector<Rect> damageRects = {};
+  damageRects.reserve(drawRects.size());
+  for (auto& drawRect : drawRects) {
+    if (!drawRect.isEmpty()) {
+      drawRootLayer(surface, drawRect, viewMatrix, true);
+      damageRects.push_back(drawRect);
+    }
+  }
+  return damageRects;
+}
+
+void DisplayList::recordDamageRects(const Surface* surface, std::vector<Rect> damageRects) {
+  if (surface->uniqueID() != lastSurfaceID) {
+    lastSurfaceID = surface->uniqueID();
+    damageHistory.clear();
+  }
+  damageHistory.push_back(std::move(damageRects));
+  if (damageHistory.size() > MAX_BUFFER_AGE) {
+    damageHistory.pop_front();
+  }
+}
+
 std::vector<Rect> DisplayList::renderTiled(Surface* surface, bool autoClear,
                                            const std::vector<Rect>& dirtyRegions) {
   if (!surfaceCaches.empty() && surfaceCaches.front()->getContext() != surface->getContext()) {
     resetCaches();
   }
+  auto startTime = Clock::Now();
   checkTileCount(surface);
   auto tileTasks = invalidateTileCaches(dirtyRegions);
   auto screenTasks = collectScreenTasks(surface, &tileTasks);
@@ -355,6 +628,8 @@ std::vector<Rect> DisplayList::renderTiled(Surface* surface, bool autoClear,
   }
   std::vector<Rect> dirtyRects = {};
   auto surfaceRect = Rect::MakeWH(surface->width(), surface->height());
+  CounterMark(TileDraws, tileTasks.size());
+  auto tileStartTime = Clock::Now();
   for (auto& task : tileTasks) {
     drawTileTask(task);
     auto dirtyRect = task.tileRect();
@@ -363,7 +638,17 @@ std::vector<Rect> DisplayList::renderTiled(Surface* surface, bool autoClear,
       dirtyRects.emplace_back(dirtyRect);
     }
   }
+  if (!tileTasks.empty()) {
+    auto tileTime = (Clock::Now() - tileStartTime) / static_cast<int64_t>(tileTasks.size());
+    averageTileTime = (averageTileTime + tileTime) / 2;
+  }
+  // Prefetch before the atlases are drawn to the screen, which would otherwise make them copy on
+  // write.
+  auto prefetchStartTime = Clock::Now();
+  prefetchTiles(surface);
+  auto prefetchTime = Clock::Now() - prefetchStartTime;
   drawScreenTasks(std::move(screenTasks), surface, autoClear);
+  averageFrameTime = (averageFrameTime + Clock::Now() - startTime - prefetchTime) / 2;
   return dirtyRects;
 }
 
@@ -385,6 +670,12 @@ void DisplayList::checkTileCount(Surface* renderSurface) {
   if (maxTileCountPerAtlas <= 0) {
     return;
   }
+  demotedTileSlots = 0;
+  if (_demoteInactiveTiles) {
+    // The demoted atlas never takes the tiles required to cover the viewport.
+    demotedTileSlots =
+        std::min({totalTileCount / 4, totalTileCount - minTileCount, maxTileCountPerAtlas});
+  }
   auto remainingTileCount = totalTileCount % maxTileCountPerAtlas;
   totalTileCount -= remainingTileCount;
   int width = static_cast<int>(sqrtf(static_cast<float>(remainingTileCount)));
@@ -400,7 +691,8 @@ std::vector<DrawTask> DisplayList::invalidateTileCaches(const std::vector<Rect>&
   std::vector<DrawTask> tileTasks = {};
   std::vector<int64_t> emptyScales = {};
   for (auto& [scaleInt, tileCache] : tileCaches) {
-    if (scaleInt == _zoomScaleInt) {
+    auto isCurrentCache = scaleInt == _zoomScaleInt;
+    if (isCurrentCache && demotedSurfaceIndex < 0) {
       invalidateCurrentTileCache(tileCache, dirtyRegions, &tileTasks);
       continue;
     }
@@ -409,9 +701,21 @@ std::vector<DrawTask> DisplayList::invalidateTileCaches(const std::vector<Rect>&
     for (auto& dirtyRect : dirtyRects) {
       auto tiles = tileCache->getTilesUnderRect(dirtyRect);
       for (auto& tile : tiles) {
+        // Demoted tiles are never redrawn, so they are dropped even at the current zoom scale.
+        if (isCurrentCache && !tile->demoted) {
+          continue;
+        }
         tileCache->removeTile(tile->tileX, tile->tileY);
+        if (tile->demoted) {
+          emptyDemotedTiles.push_back(tile);
+        } else {
+          emptyTiles.push_back(tile);
+        }
       }
-      emptyTiles.insert(emptyTiles.end(), tiles.begin(), tiles.end());
+    }
+    if (isCurrentCache) {
+      invalidateCurrentTileCache(tileCache, dirtyRegions, &tileTasks);
+      continue;
     }
     if (tileCache->empty()) {
       emptyScales.push_back(scaleInt);
@@ -451,6 +755,8 @@ void DisplayList::invalidateCurrentTileCache(const TileCache* tileCache,
 std::vector<DrawTask> DisplayList::collectScreenTasks(const Surface* surface,
                                                       std::vector<DrawTask>* tileTasks) {
   auto maxRefinedCount = _maxTilesRefinedPerFrame;
+  updateScrollVelocity(lastZoomScaleInt == _zoomScaleInt ? _contentOffset - lastContentOffset
+                                                         : Point::Zero());
   if (lastContentOffset != _contentOffset || lastZoomScaleInt != _zoomScaleInt) {
     lastContentOffset = _contentOffset;
     lastZoomScaleInt = _zoomScaleInt;
@@ -481,7 +787,8 @@ std::vector<DrawTask> DisplayList::collectScreenTasks(const Surface* surface,
   for (int tileY = startY; tileY < endY; ++tileY) {
     for (int tileX = startX; tileX < endX; ++tileX) {
       auto tile = currentTileCache->getTile(tileX, tileY);
-      if (tile != nullptr) {
+      if (tile != nullptr && !tile->demoted) {
+        tile->prefetched = false;
         screenTasks.emplace_back(tile, _tileSize);
       } else {
         dirtyGrids.emplace_back(tileX, tileY);
@@ -507,8 +814,14 @@ std::vector<DrawTask> DisplayList::collectScreenTasks(const Surface* surface,
   std::vector<std::shared_ptr<Tile>> taskTiles = {};
   for (auto& grid : dirtyGrids) {
     auto& tile = freeTiles[tileIndex++];
+    auto demotedTile = currentTileCache->getTile(grid.first, grid.second);
     if (_allowZoomBlur) {
-      auto fallbackTasks = getFallbackDrawTasks(grid.first, grid.second, sortedCaches);
+      std::vector<DrawTask> fallbackTasks = {};
+      if (demotedTile != nullptr) {
+        fallbackTasks.emplace_back(demotedTile, _tileSize);
+      } else {
+        fallbackTasks = getFallbackDrawTasks(grid.first, grid.second, sortedCaches);
+      }
       if (!fallbackTasks.empty()) {
         if (maxRefinedCount <= 0) {
           emptyTiles.emplace_back(tile);
@@ -517,8 +830,13 @@ std::vector<DrawTask> DisplayList::collectScreenTasks(const Surface* surface,
           continue;
         }
         maxRefinedCount--;
+        CounterMark(TileRefinements, 1);
       }
     }
+    if (demotedTile != nullptr) {
+      currentTileCache->removeTile(grid.first, grid.second);
+      emptyDemotedTiles.push_back(std::move(demotedTile));
+    }
     tile->tileX = grid.first;
     tile->tileY = grid.second;
     taskTiles.push_back(tile);
@@ -538,6 +856,97 @@ std::vector<DrawTask> DisplayList::collectScreenTasks(const Surface* surface,
   return screenTasks;
 }
 
+void DisplayList::updateScrollVelocity(const Point& scrollDelta) {
+  // The viewport is only predicted after it has moved in two consecutive frames, so a single jump
+  // of the contentOffset does not trigger any prefetching.
+  if (scrollDelta.isZero() || lastScrollDelta.isZero()) {
+    scrollVelocity = Point::Zero();
+  } else {
+    scrollVelocity = (scrollDelta + lastScrollDelta) * 0.5f;
+  }
+  lastScrollDelta = scrollDelta;
+}
+
+void DisplayList::prefetchTiles(const Surface* surface) {
+  if (scrollVelocity.isZero()) {
+    return;
+  }
+  auto prefetchCount = getPrefetchTileCount();
+  auto result = tileCaches.find(_zoomScaleInt);
+  if (prefetchCount == 0 || result == tileCaches.end()) {
+    return;
+  }
+  auto tileCache = result->second;
+  auto tileSize = static_cast<float>(_tileSize);
+  std::vector<std::pair<int, int>> prefetchGrids = {};
+  // Collect the missing tiles covered by the predicted viewports, the nearest frames first.
+  for (int frame = 1; frame <= MAX_PREFETCH_FRAMES; ++frame) {
+    auto renderRect = Rect::MakeWH(surface->width(), surface->height());
+    auto offset = _contentOffset + scrollVelocity * static_cast<float>(frame);
+    renderRect.offset(-offset.x, -offset.y);
+    int startX = static_cast<int>(floorf(renderRect.left / tileSize));
+    int startY = static_cast<int>(floorf(renderRect.top / tileSize));
+    int endX = static_cast<int>(ceilf(renderRect.right / tileSize));
+    int endY = static_cast<int>(ceilf(renderRect.bottom / tileSize));
+    for (int tileY = startY; tileY < endY; ++tileY) {
+      for (int tileX = startX; tileX < endX; ++tileX) {
+        std::pair<int, int> grid = {tileX, tileY};
+        if (tileCache->getTile(tileX, tileY) != nullptr ||
+            std::find(prefetchGrids.begin(), prefetchGrids.end(), grid) != prefetchGrids.end()) {
+          continue;
+        }
+        prefetchGrids.push_back(grid);
+        if (prefetchGrids.size() >= prefetchCount) {
+          break;
+        }
+      }
+      if (prefetchGrids.size() >= prefetchCount) {
+        break;
+      }
+    }
+    if (prefetchGrids.size() >= prefetchCount) {
+      break;
+    }
+  }
+  // Only the unused tiles are taken, so prefetching never evicts the tiles of other zoom levels.
+  while (emptyTiles.size() < prefetchGrids.size()) {
+    if (!createEmptyTiles(surface)) {
+      break;
+    }
+  }
+  prefetchGrids.resize(std::min(prefetchGrids.size(), emptyTiles.size()));
+  auto startTime = Clock::Now();
+  for (auto& grid : prefetchGrids) {
+    auto tile = emptyTiles.back();
+    emptyTiles.pop_back();
+    tile->tileX = grid.first;
+    tile->tileY = grid.second;
+    tile->prefetched = true;
+    tileCache->addTile(tile);
+    drawTileTask({tile, _tileSize});
+  }
+  if (!prefetchGrids.empty()) {
+    CounterMark(TilePrefetches, prefetchGrids.size());
+    auto tileTime = (Clock::Now() - startTime) / static_cast<int64_t>(prefetchGrids.size());
+    averageTileTime = (averageTileTime + tileTime) / 2;
+  }
+}
+
+size_t DisplayList::getPrefetchTileCount() const {
+  if (_maxTilesPrefetchedPerFrame <= 0) {
+    return 0;
+  }
+  auto idleTime = PREFETCH_FRAME_TIME - averageFrameTime;
+  if (idleTime <= 0) {
+    return 0;
+  }
+  auto maxCount = static_cast<size_t>(_maxTilesPrefetchedPerFrame);
+  if (averageTileTime <= 0) {
+    return maxCount;
+  }
+  return std::min(static_cast<size_t>(idleTime / averageTileTime), maxCount);
+}
+
 static float ScaleRatio(float scaleA, float zoomScale) {
   auto ratio = fabsf(scaleA / zoomScale);
   if (ratio < 1.0f) {
@@ -612,6 +1021,7 @@ std::vector<std::shared_ptr<Tile>> DisplayList::getFreeTiles(
   emptyTiles.clear();
   auto currentZoomScale = ToZoomScaleFloat(_zoomScaleInt, _zoomScalePrecision);
   DEBUG_ASSERT(currentZoomScale != 0.0f);
+  bool hasDemotedTiles = false;
   // Reverse iterate through sorted caches to get the farest tiles first.
   for (auto it = sortedCaches.rbegin(); it != sortedCaches.rend(); ++it) {
     auto& [scale, tileCache] = *it;
@@ -620,8 +1030,21 @@ std::vector<std::shared_ptr<Tile>> DisplayList::getFreeTiles(
     centerX *= scale / currentZoomScale;
     centerY *= scale / currentZoomScale;
     auto reusableTiles = tileCache->getReusableTiles(centerX, centerY);
+    auto demote = demotedTileSlots > 0 && scale != currentZoomScale;
     for (auto& tile : reusableTiles) {
+      if (tile->demoted) {
+        // Demoted tiles free no tile slots, so they are only dropped to make room for the tiles
+        // demoted from closer zoom levels.
+        if (emptyDemotedTiles.empty()) {
+          tileCache->removeTile(tile->tileX, tile->tileY);
+          emptyDemotedTiles.push_back(std::move(tile));
+        }
+        continue;
+      }
       tileCache->removeTile(tile->tileX, tile->tileY);
+      if (demote && !tile->prefetched && demoteTile(tileCache, *tile, renderSurface)) {
+        hasDemotedTiles = true;
+      }
       tiles.push_back(std::move(tile));
       if (tiles.size() >= tileCount) {
         break;
@@ -631,6 +1054,11 @@ std::vector<std::shared_ptr<Tile>> DisplayList::getFreeTiles(
       break;
     }
   }
+  if (hasDemotedTiles) {
+    // Flush the copies into the demoted atlas, so the atlases they read from are not copied on
+    // write when their tiles are redrawn.
+    surfaceCaches[static_cast<size_t>(demotedSurfaceIndex)]->makeImageSnapshot();
+  }
   if (tiles.size() < tileCount) {
     emptyTiles = std::move(tiles);
     return {};
@@ -719,16 +1147,77 @@ bool DisplayList::createEmptyTiles(const Surface* renderSurface) {
 int DisplayList::nextSurfaceTileCount(Context* context) const {
   DEBUG_ASSERT(context != nullptr);
   int surfaceTileCount = 0;
-  for (auto& surface : surfaceCaches) {
+  for (size_t i = 0; i < surfaceCaches.size(); ++i) {
+    if (static_cast<int>(i) == demotedSurfaceIndex) {
+      continue;
+    }
+    auto& surface = surfaceCaches[i];
     auto tileCountX = surface->width() / _tileSize;
     auto tileCountY = surface->height() / _tileSize;
     surfaceTileCount += tileCountX * tileCountY;
   }
-  if (surfaceTileCount >= totalTileCount) {
+  auto maxTileCount = totalTileCount - demotedTileSlots;
+  if (surfaceTileCount >= maxTileCount) {
     return 0;
   }
   auto maxTileCountPerAtlas = getMaxTileCountPerAtlas(context);
-  return std::min(totalTileCount - surfaceTileCount, maxTileCountPerAtlas);
+  return std::min(maxTileCount - surfaceTileCount, maxTileCountPerAtlas);
+}
+
+bool DisplayList::createDemotedTiles(const Surface* renderSurface) {
+  DEBUG_ASSERT(renderSurface != nullptr);
+  if (demotedTileSlots <= 0 || demotedSurfaceIndex >= 0) {
+    return false;
+  }
+  // Each tile slot holds four demoted tiles at half resolution.
+  auto tileCount = demotedTileSlots * 4;
+  auto demotedTileSize = _tileSize / 2;
+  int countX = static_cast<int>(sqrtf(static_cast<float>(tileCount)));
+  int countY = tileCount / countX;
+  auto surface = Surface::Make(renderSurface->getContext(), countX * demotedTileSize,
+                               countY * demotedTileSize, ColorType::RGBA_8888, 1, false,
+                               renderSurface->renderFlags());
+  if (surface == nullptr) {
+    demotedTileSlots = 0;
+    return false;
+  }
+  surfaceCaches.push_back(std::move(surface));
+  auto surfaceIndex = surfaceCaches.size() - 1;
+  demotedSurfaceIndex = static_cast<int>(surfaceIndex);
+  emptyDemotedTiles.reserve(emptyDemotedTiles.size() + static_cast<size_t>(countX * countY));
+  for (int y = 0; y < countY; ++y) {
+    for (int x = 0; x < countX; ++x) {
+      auto tile = std::make_shared<Tile>();
+      tile->sourceIndex = surfaceIndex;
+      tile->sourceX = x;
+      tile->sourceY = y;
+      tile->demoted = true;
+      emptyDemotedTiles.push_back(std::move(tile));
+    }
+  }
+  return true;
+}
+
+bool DisplayList::demoteTile(TileCache* tileCache, const Tile& tile,
+                             const Surface* renderSurface) {
+  if (emptyDemotedTiles.empty() && !createDemotedTiles(renderSurface)) {
+    return false;
+  }
+  auto demotedTile = emptyDemotedTiles.back();
+  emptyDemotedTiles.pop_back();
+  demotedTile->tileX = tile.tileX;
+  demotedTile->tileY = tile.tileY;
+  auto image = surfaceCaches[tile.sourceIndex]->makeImageSnapshot();
+  auto canvas = surfaceCaches[demotedTile->sourceIndex]->getCanvas();
+  Paint paint = {};
+  paint.setAntiAlias(false);
+  paint.setBlendMode(BlendMode::Src);
+  static SamplingOptions sampling(FilterMode::Linear, MipmapMode::None);
+  canvas->drawImageRect(image, tile.getSourceRect(_tileSize),
+                        demotedTile->getSourceRect(_tileSize), sampling, &paint,
+                        SrcRectConstraint::Strict);
+  tileCache->addTile(std::move(demotedTile));
+  return true;
 }
 
 int DisplayList::getMaxTileCountPerAtlas(Context* context) const {
@@ -767,12 +1256,14 @@ void DisplayList::drawScreenTasks(std::vector<DrawTask> screenTasks, Surface* su
     paint.setBlendMode(BlendMode::Src);
   }
   static SamplingOptions sampling(FilterMode::Nearest, MipmapMode::None);
+  static SamplingOptions demotedSampling(FilterMode::Linear, MipmapMode::None);
   canvas->setMatrix(Matrix::MakeTrans(_contentOffset.x, _contentOffset.y));
   for (auto& task : screenTasks) {
     auto surfaceCache = surfaceCaches[task.sourceIndex()];
     DEBUG_ASSERT(surfaceCache != nullptr);
     auto image = surfaceCache->makeImageSnapshot();
-    canvas->drawImageRect(image, task.sourceRect(), task.tileRect(), sampling, &paint,
+    canvas->drawImageRect(image, task.sourceRect(), task.tileRect(),
+                          task.demoted() ? demotedSampling : sampling, &paint,
                           SrcRectConstraint::Strict);
   }
 }
@@ -812,6 +1303,25 @@ void DisplayList::resetCaches() {
   surfaceCaches = {};
   totalTileCount = 0;
   emptyTiles.clear();
+  demotedTileSlots = 0;
+  demotedSurfaceIndex = -1;
+  emptyDemotedTiles.clear();
+}
+
+bool DisplayList::isOpaqueOver(const Rect& drawRect, const Matrix& viewMatrix) const {
+  auto matrix = viewMatrix;
+  Rect opaqueBounds = {};
+  if (frame != nullptr) {
+    opaqueBounds = frame->opaqueBounds;
+  } else {
+    opaqueBounds = _root->opaqueBounds;
+  }
+  if (opaqueBounds.isEmpty() || !matrix.rectStaysRect()) {
+    return false;
+  }
+  matrix.mapRect(&opaqueBounds);
+  opaqueBounds.roundIn();
+  return opaqueBounds.contains(drawRect);
 }
 
 void DisplayList::drawRootLayer(Surface* surface, const Rect& drawRect, const Matrix& viewMatrix,
@@ -825,16 +1335,26 @@ void DisplayList::drawRootLayer(Surface* surface, const Rect& drawRect, const Ma
   if (!fullScreen) {
     canvas->clipRect(drawRect);
   }
-  if (autoClear) {
+  if (autoClear && !isOpaqueOver(drawRect, viewMatrix)) {
     canvas->clear();
   }
   canvas->setMatrix(viewMatrix);
-  DrawArgs args(context);
   DEBUG_ASSERT(viewMatrix.invertible());
   Matrix inverse = Matrix::I();
   viewMatrix.invert(&inverse);
   auto renderRect = inverse.mapRect(drawRect);
   renderRect.roundOut();
+  if (frame != nullptr) {
+    auto frameScale = frame->_zoomScale;
+    canvas->scale(1.0f / frameScale, 1.0f / frameScale);
+    for (auto& layerPicture : frame->layerPictures) {
+      if (Rect::Intersects(layerPicture.bounds, renderRect)) {
+        canvas->drawPicture(layerPicture.picture);
+      }
+    }
+    return;
+  }
+  DrawArgs args(context);
   args.renderRect = &renderRect;
   auto backgroundRect = _root->getBackgroundRect(drawRect, viewMatrix.getMaxScale());
   if (backgroundRect) {
@@ -0,0 +1,47 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "EffectCache.h"
+#include <cmath>
+
+namespace tgfx {
+static constexpr float ScaleBucketsPerOctave = 8.0f;
+
+static float ScaleBucket(float scale) {
+  return std::round(std::log2(scale) * ScaleBucketsPerOctave);
+}
+
+bool EffectCache::matchesScale(float contentScale) const {
+  return ScaleBucket(contentScale) == ScaleBucket(_contentScale);
+}
+
+const LayerStyleOutput* EffectCache::findStyleOutput(const LayerStyle* style) const {
+  auto result = styleOutputs.find(style);
+  if (result == styleOutputs.end()) {
+    return nullptr;
+  }
+  return &result->second;
+}
+
+const LayerStyleOutput* EffectCache::addStyleOutput(const LayerStyle* style,
+                                                    LayerStyleOutput output) {
+  auto& item = styleOutputs[style];
+  item = std::move(output);
+  return &item;
+}
+}  // namespace tgfx
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <unordered_map>
+#include "layers/contents/RasterizedContent.h"
+#include "tgfx/layers/layerstyles/LayerStyle.h"
+
+namespace tgfx {
+/**
+ * LayerStyleSource holds the scaled images of the layer content (and optionally its contour) that
+ * layer styles use as their input.
+ */
+struct LayerStyleSource {
+  float contentScale = 1.0f;
+  std::shared_ptr<Image> content = nullptr;
+  Point contentOffset = {};
+  std::shared_ptr<Image> contour = nullptr;
+  Point contourOffset = {};
+};
+
+/**
+ * The output of a single layer style, rendered in the scaled coordinate space of the layer content.
+ * The image is drawn at the offset with the style's own alpha and blend mode.
+ */
+struct LayerStyleOutput {
+  std::shared_ptr<Image> image = nullptr;
+  Point offset = {};
+};
+
+/**
+ * EffectCache keeps the offscreen results of a layer's filters and layer styles across frames. It
+ * is created for a specific GPU context and a bucket of content scales, and it is dropped by the
+ * layer whenever its content, descendants or effect parameters change. The cached images are
+ * rasterized lazily, so their textures live in the ResourceCache under unique keys and are released
+ * together with this cache.
+ */
+class EffectCache {
+ public:
+  EffectCache(uint32_t contextID, float contentScale)
+      : _contextID(contextID), _contentScale(contentScale) {
+  }
+
+  /**
+   * Returns the unique ID of the associated GPU device.
+   */
+  uint32_t contextID() const {
+    return _contextID;
+  }
+
+  /**
+   * Returns the scale factor the cached images were rendered at.
+   */
+  float contentScale() const {
+    return _contentScale;
+  }
+
+  /**
+   * Returns true if the cached images can be drawn at the given scale factor. Scales are quantized
+   * into eighth-octave buckets, so small zoom changes reuse the cache instead of re-rendering it.
+   */
+  bool matchesScale(float contentScale) const;
+
+  /**
+   * The rasterized layer content with all filters applied, or nullptr if not cached yet.
+   */
+  std::unique_ptr<RasterizedContent> filteredContent = nullptr;
+
+  /**
+   * The source images used to draw the layer styles, or nullptr if not cached yet.
+   */
+  std::unique_ptr<LayerStyleSource> styleSource = nullptr;
+
+  /**
+   * Returns the cached output of the given layer style, or nullptr if not cached yet.
+   */
+  const LayerStyleOutput* findStyleOutput(const LayerStyle* style) const;
+
+  /**
+   * Stores the output of the given layer style.
+   */
+  const LayerStyleOutput* addStyleOutput(const LayerStyle* style, LayerStyleOutput output);
+
+ private:
+  uint32_t _contextID = 0;
+  float _contentScale = 1.0f;
+  std::unordered_map<const LayerStyle*, LayerStyleOutput> styleOutputs = {};
+};
+}  // namespace tgfx
@@ -24,6 +24,8 @@
 #include "core/utils/Log.h"
 #include "core/utils/MathExtra.h"
 #include "layers/DrawArgs.h"
+#include "layers/EffectCache.h"
+#include "layers/LayerContentCache.h"
 #include "layers/OpaqueThreshold.h"
 #include "layers/RegionTransformer.h"
 #include "layers/RootLayer.h"
@@ -35,14 +37,6 @@ namespace tgfx {
 static std::atomic_bool AllowsEdgeAntialiasing = true;
 static std::atomic_bool AllowsGroupOpacity = false;
 
-struct LayerStyleSource {
-  float contentScale = 1.0f;
-  std::shared_ptr<Image> content = nullptr;
-  Point contentOffset = {};
-  std::shared_ptr<Image> contour = nullptr;
-  Point contourOffset = {};
-};
-
 static std::shared_ptr<Picture> RecordPicture(float contentScale,
                                               const std::function<void(Canvas*)>& drawFunction) {
   if (drawFunction == nullptr) {
@@ -197,6 +191,7 @@ void Layer::setFilters(std::vector<std::shared_ptr<LayerFilter>> value) {
     filter->attachToLayer(this);
   }
   rasterizedContent = nullptr;
+  effectCache = nullptr;
   invalidateTransform();
 }
 
@@ -261,6 +256,7 @@ void Layer::setLayerStyles(std::vector<std::shared_ptr<LayerStyle>> value) {
     layerStyle->attachToLayer(this);
   }
   rasterizedContent = nullptr;
+  effectCache = nullptr;
   invalidateTransform();
 }
 
@@ -573,6 +569,7 @@ void Layer::invalidateDescendents() {
   }
   bitFields.dirtyDescendents = true;
   rasterizedContent = nullptr;
+  effectCache = nullptr;
   invalidate();
 }
 
@@ -585,9 +582,18 @@ void Layer::invalidate() {
   }
 }
 
+void Layer::invalidateCache() {
+  rasterizedContent = nullptr;
+  effectCache = nullptr;
+}
+
 void Layer::onUpdateContent(LayerRecorder*) {
 }
 
+bool Layer::onGetContentKey(BytesKey*) const {
+  return false;
+}
+
 void Layer::attachProperty(LayerProperty* property) {
   if (property) {
     property->attachToLayer(this);
@@ -659,9 +665,18 @@ Matrix Layer::getMatrixWithScrollRect() const {
 
 LayerContent* Layer::getContent() {
   if (bitFields.dirtyContent) {
-    LayerRecorder recorder = {};
-    onUpdateContent(&recorder);
-    layerContent = recorder.finishRecording();
+    BytesKey contentKey = {};
+    contentKey.write(static_cast<uint32_t>(type()));
+    auto shareable = bitFields.shareableContent && onGetContentKey(&contentKey);
+    layerContent = shareable ? LayerContentCache::Find(contentKey) : nullptr;
+    if (layerContent == nullptr) {
+      LayerRecorder recorder = {};
+      onUpdateContent(&recorder);
+      layerContent = recorder.finishRecording();
+      if (shareable) {
+        LayerContentCache::Add(contentKey, layerContent);
+      }
+    }
     bitFields.dirtyContent = false;
   }
   return layerContent.get();
@@ -737,6 +752,56 @@ std::shared_ptr<Image> Layer::getRasterizedImage(const DrawArgs& args, float con
   return image;
 }
 
+EffectCache* Layer::getEffectCache(const DrawArgs& args, float contentScale) {
+  // The cache is only valid while the layer and its descendants are clean. Layers that depend on
+  // the background can't be cached, since the content below them may change at any time.
+  if (args.context == nullptr || args.excludeEffects || args.drawMode != DrawMode::Normal ||
+      bitFields.dirtyContent || bitFields.dirtyDescendents || backgroundOutset > 0 ||
+      FloatNearlyZero(contentScale)) {
+    return nullptr;
+  }
+  auto contextID = args.context->uniqueID();
+  if (effectCache == nullptr || effectCache->contextID() != contextID ||
+      !effectCache->matchesScale(contentScale)) {
+    effectCache = std::make_unique<EffectCache>(contextID, contentScale);
+  }
+  return effectCache.get();
+}
+
+bool Layer::canCacheEffects(const DrawArgs& args) const {
+  // Only rasterize the effects when the whole layer is inside the render rect, so that caching
+  // never renders more pixels than the uncached path would.
+  return args.renderRect == nullptr || args.renderRect->contains(renderBounds);
+}
+
+RasterizedContent* Layer::getFilteredContent(const DrawArgs& args, float contentScale) {
+  if (_filters.empty() || hasValidMask()) {
+    return nullptr;
+  }
+  auto cache = getEffectCache(args, contentScale);
+  if (cache == nullptr) {
+    return nullptr;
+  }
+  if (cache->filteredContent != nullptr) {
+    return cache->filteredContent.get();
+  }
+  if (!canCacheEffects(args)) {
+    return nullptr;
+  }
+  Matrix drawingMatrix = {};
+  auto image = getRasterizedImage(args, cache->contentScale(), &drawingMatrix);
+  if (image == nullptr) {
+    return nullptr;
+  }
+  image = image->makeRasterized();
+  if (image == nullptr) {
+    return nullptr;
+  }
+  cache->filteredContent = std::make_unique<RasterizedContent>(
+      cache->contextID(), cache->contentScale(), std::move(image), drawingMatrix);
+  return cache->filteredContent.get();
+}
+
 void Layer::drawLayer(const DrawArgs& args, Canvas* canvas, float alpha, BlendMode blendMode) {
   DEBUG_ASSERT(canvas != nullptr);
   if (args.renderRect && !Rect::Intersects(*args.renderRect, renderBounds)) {
@@ -818,6 +883,14 @@ void Layer::drawOffscreen(const DrawArgs& args, Canvas* canvas, float alpha, Ble
   if (FloatNearlyZero(contentScale)) {
     return;
   }
+  if (auto filteredContent = getFilteredContent(args, contentScale)) {
+    filteredContent->draw(canvas, bitFields.allowsEdgeAntialiasing, alpha, blendMode);
+    if (args.backgroundContext) {
+      filteredContent->draw(args.backgroundContext->getCanvas(), bitFields.allowsEdgeAntialiasing,
+                            alpha, blendMode);
+    }
+    return;
+  }
 
   Paint paint = {};
   paint.setAntiAlias(bitFields.allowsEdgeAntialiasing);
@@ -908,9 +981,61 @@ void Layer::drawContents(const DrawArgs& args, Canvas* canvas, float alpha,
   }
 }
 
+std::vector<bool> Layer::getOccludedChildren(const DrawArgs& args, const Matrix& matrix,
+                                              float alpha, const Layer* stopChild) const {
+  // The bounds are only kept up to date for layers rendered by a DisplayList, which always passes
+  // a render rect.
+  if (args.renderRect == nullptr || args.drawMode != DrawMode::Normal || alpha < 1.0f) {
+    return {};
+  }
+  // The bounds are in global coordinates, while pixel coverage is decided on the canvas, so they
+  // are mapped to the device space of the canvas before being compared.
+  Matrix globalToDevice = {};
+  if (!lastRenderMatrix.invert(&globalToDevice)) {
+    return {};
+  }
+  globalToDevice.postConcat(matrix);
+  if (!globalToDevice.rectStaysRect()) {
+    return {};
+  }
+  auto count = _children.size();
+  for (size_t i = 0; i < _children.size(); i++) {
+    if (_children[i].get() == stopChild) {
+      count = i;
+      break;
+    }
+  }
+  std::vector<bool> occluded = {};
+  auto occluder = Rect::MakeEmpty();
+  for (auto i = count; i > 0; i--) {
+    auto& child = _children[i - 1];
+    if (child->maskOwner || !child->bitFields.visible || child->_alpha <= 0) {
+      continue;
+    }
+    if (!occluder.isEmpty() && occluder.contains(globalToDevice.mapRect(child->renderBounds))) {
+      if (occluded.empty()) {
+        occluded.resize(count, false);
+      }
+      occluded[i - 1] = true;
+      continue;
+    }
+    if (!child->opaqueBounds.isEmpty()) {
+      auto opaqueRect = globalToDevice.mapRect(child->opaqueBounds);
+      // Only whole pixels are hidden, partially covered edge pixels still show what is beneath.
+      opaqueRect.roundIn();
+      if (!opaqueRect.isEmpty() && opaqueRect.area() > occluder.area()) {
+        occluder = opaqueRect;
+      }
+    }
+  }
+  return occluded;
+}
+
 bool Layer::drawChildren(const DrawArgs& args, Canvas* canvas, float alpha,
                          const Layer* stopChild) {
-  for (const auto& child : _children) {
+  auto occluded = getOccludedChildren(args, canvas->getMatrix(), alpha, stopChild);
+  for (size_t i = 0; i < _children.size(); i++) {
+    auto& child = _children[i];
     if (child.get() == stopChild) {
       return false;
     }
@@ -920,6 +1045,10 @@ bool Layer::drawChildren(const DrawArgs& args, Canvas* canvas, float alpha,
     if (!child->visible() || child->_alpha <= 0) {
       continue;
     }
+    if (i < occluded.size() && occluded[i]) {
+      // Hidden behind an opaque sibling drawn above it.
+      continue;
+    }
 
     AutoCanvasRestore autoRestore(canvas);
     auto backgroundCanvas = args.backgroundContext ? args.backgroundContext->getCanvas() : nullptr;
@@ -967,10 +1096,22 @@ std::unique_ptr<LayerStyleSource> Layer::getLayerStyleSource(const DrawArgs& arg
   if (FloatNearlyZero(contentScale)) {
     return nullptr;
   }
+  auto cache = getEffectCache(args, contentScale);
+  if (cache && cache->styleSource) {
+    return std::make_unique<LayerStyleSource>(*cache->styleSource);
+  }
+  if (cache && !canCacheEffects(args)) {
+    cache = nullptr;
+  }
 
   DrawArgs drawArgs = args;
   drawArgs.backgroundContext = nullptr;
   drawArgs.excludeEffects = bitFields.excludeChildEffectsInLayerStyle;
+  if (cache) {
+    // The cached source must contain the entire content, not just the part inside the render rect.
+    drawArgs.renderRect = nullptr;
+    contentScale = cache->contentScale();
+  }
   auto contentPicture =
       RecordPicture(contentScale, [&](Canvas* canvas) { drawContents(drawArgs, canvas, 1.0f); });
   Point contentOffset = {};
@@ -995,6 +1136,9 @@ std::unique_ptr<LayerStyleSource> Layer::getLayerStyleSource(const DrawArgs& arg
         RecordPicture(contentScale, [&](Canvas* canvas) { drawContents(drawArgs, canvas, 1.0f); });
     source->contour = ToImageWithOffset(std::move(contourPicture), &source->contourOffset);
   }
+  if (cache) {
+    cache->styleSource = std::make_unique<LayerStyleSource>(*source);
+  }
   return source;
 }
 
@@ -1058,6 +1202,13 @@ void Layer::drawLayerStyles(const DrawArgs& args, Canvas* canvas, float alpha,
       backgroundCanvas->save();
       backgroundCanvas->concat(matrix);
     }
+    if (drawCachedLayerStyle(args, canvas, alpha, source, layerStyle.get())) {
+      if (backgroundCanvas) {
+        drawCachedLayerStyle(args, backgroundCanvas, alpha, source, layerStyle.get());
+        backgroundCanvas->restore();
+      }
+      continue;
+    }
     switch (layerStyle->extraSourceType()) {
       case LayerStyleExtraSourceType::None:
         layerStyle->draw(canvas, source->content, source->contentScale, alpha);
@@ -1092,6 +1243,53 @@ void Layer::drawLayerStyles(const DrawArgs& args, Canvas* canvas, float alpha,
   }
 }
 
+bool Layer::drawCachedLayerStyle(const DrawArgs& args, Canvas* canvas, float alpha,
+                                 const LayerStyleSource* source, LayerStyle* layerStyle) {
+  // Only the built-in shadow styles are known to draw their output with a single draw call, which
+  // makes it safe to render them once and composite the result with the style's alpha and blend
+  // mode afterward.
+  auto styleType = layerStyle->Type();
+  if (styleType != LayerStyleType::DropShadow && styleType != LayerStyleType::InnerShadow) {
+    return false;
+  }
+  auto cache = getEffectCache(args, source->contentScale);
+  // The outputs are rendered from the cached source, so they only line up with that source.
+  if (cache == nullptr || cache->styleSource == nullptr ||
+      cache->styleSource->content != source->content) {
+    return false;
+  }
+  auto output = cache->findStyleOutput(layerStyle);
+  if (output == nullptr) {
+    auto picture = RecordPicture(1.0f, [&](Canvas* recordingCanvas) {
+      if (layerStyle->extraSourceType() == LayerStyleExtraSourceType::Contour) {
+        if (source->contour == nullptr) {
+          return;
+        }
+        auto contourOffset = source->contourOffset - source->contentOffset;
+        layerStyle->onDrawWithExtraSource(recordingCanvas, source->content, source->contentScale,
+                                          source->contour, contourOffset, 1.0f,
+                                          BlendMode::SrcOver);
+      } else {
+        layerStyle->onDraw(recordingCanvas, source->content, source->contentScale, 1.0f,
+                           BlendMode::SrcOver);
+      }
+    });
+    LayerStyleOutput styleOutput = {};
+    styleOutput.image = ToImageWithOffset(std::move(picture), &styleOutput.offset);
+    if (styleOutput.image != nullptr) {
+      styleOutput.image = styleOutput.image->makeRasterized();
+    }
+    output = cache->addStyleOutput(layerStyle, std::move(styleOutput));
+  }
+  if (output->image != nullptr) {
+    Paint paint = {};
+    paint.setAlpha(alpha);
+    paint.setBlendMode(layerStyle->blendMode());
+    canvas->drawImage(output->image, output->offset.x, output->offset.y, &paint);
+  }
+  return true;
+}
+
 bool Layer::getLayersUnderPointInternal(float x, float y,
                                         std::vector<std::shared_ptr<Layer>>* results) {
   bool hasLayerUnderPoint = false;
@@ -1152,6 +1350,8 @@ void Layer::updateRenderBounds(const Matrix& renderMatrix,
     return;
   }
   backgroundOutset = 0;
+  bitFields.untransformedBounds = transformer == nullptr;
+  lastRenderMatrix = renderMatrix;
   if (!_layerStyles.empty() || !_filters.empty()) {
     auto contentScale = renderMatrix.getMaxScale();
     transformer =
@@ -1199,12 +1399,21 @@ void Layer::updateRenderBounds(const Matrix& renderMatrix,
       childTransformer = RegionTransformer::MakeFromClip(childScrollRect, childTransformer);
     }
     auto childForceDirty = forceDirty || child->bitFields.dirtyTransform;
-    child->updateRenderBounds(childMatrix, childTransformer, childForceDirty);
+    if (childForceDirty && !childTransformer && child->canOffsetRenderBounds(childMatrix)) {
+      // Only an ancestor was translated, so the cached bounds of the whole subtree are moved by the
+      // same offset instead of being recomputed from the contents.
+      auto& lastMatrix = child->lastRenderMatrix;
+      child->offsetRenderBounds(childMatrix.getTranslateX() - lastMatrix.getTranslateX(),
+                                childMatrix.getTranslateY() - lastMatrix.getTranslateY());
+    } else {
+      child->updateRenderBounds(childMatrix, childTransformer, childForceDirty);
+    }
     child->bitFields.dirtyTransform = false;
     if (!child->maskOwner) {
       renderBounds.join(child->renderBounds);
     }
   }
+  updateOpaqueBounds(renderMatrix, content);
   auto backOutset = 0.f;
   for (auto& style : _layerStyles) {
     if (style->extraSourceType() != LayerStyleExtraSourceType::Background) {
@@ -1222,6 +1431,66 @@ void Layer::updateRenderBounds(const Matrix& renderMatrix,
   bitFields.dirtyDescendents = false;
 }
 
+bool Layer::canOffsetRenderBounds(const Matrix& renderMatrix) const {
+  // A dirty transform may also come from changed filters, styles, masks or scrollRect of the layer
+  // itself, and background styles depend on the dirty regions around them, so both need a full
+  // update.
+  if (!bitFields.untransformedBounds || bitFields.dirtyTransform || bitFields.dirtyDescendents ||
+      bitFields.dirtyContentBounds || backgroundOutset > 0) {
+    return false;
+  }
+  return renderMatrix.getScaleX() == lastRenderMatrix.getScaleX() &&
+         renderMatrix.getSkewX() == lastRenderMatrix.getSkewX() &&
+         renderMatrix.getSkewY() == lastRenderMatrix.getSkewY() &&
+         renderMatrix.getScaleY() == lastRenderMatrix.getScaleY();
+}
+
+void Layer::offsetRenderBounds(float dx, float dy) {
+  if (contentBounds && !contentBounds->isEmpty()) {
+    _root->invalidateRect(*contentBounds);
+    contentBounds->offset(dx, dy);
+    _root->invalidateRect(*contentBounds);
+  }
+  renderBounds.offset(dx, dy);
+  if (!opaqueBounds.isEmpty()) {
+    opaqueBounds.offset(dx, dy);
+  }
+  lastRenderMatrix.postTranslate(dx, dy);
+  for (auto& child : _children) {
+    if (child->bitFields.visible && child->_alpha > 0) {
+      child->offsetRenderBounds(dx, dy);
+    }
+  }
+}
+
+void Layer::updateOpaqueBounds(const Matrix& renderMatrix, const LayerContent* content) {
+  opaqueBounds.setEmpty();
+  // Anything that draws the layer offscreen or blends it with its background may expose the
+  // layers beneath, so only plain opaque layers can hide them.
+  if (_alpha < 1.0f || bitFields.blendMode != static_cast<uint8_t>(BlendMode::SrcOver) ||
+      bitFields.shouldRasterize || !_filters.empty() || !_layerStyles.empty() || hasValidMask() ||
+      !renderMatrix.rectStaysRect()) {
+    return;
+  }
+  if (content) {
+    auto bounds = content->getOpaqueBounds();
+    if (!bounds.isEmpty()) {
+      opaqueBounds = renderMatrix.mapRect(bounds);
+    }
+  }
+  for (auto& child : _children) {
+    if (child->maskOwner || !child->bitFields.visible || child->_alpha <= 0) {
+      continue;
+    }
+    if (child->opaqueBounds.area() > opaqueBounds.area()) {
+      opaqueBounds = child->opaqueBounds;
+    }
+  }
+  if (_scrollRect && !opaqueBounds.intersect(renderMatrix.mapRect(*_scrollRect))) {
+    opaqueBounds.setEmpty();
+  }
+}
+
 void Layer::checkBackgroundStyles(const Matrix& renderMatrix) {
   for (auto& child : _children) {
     if (child->backgroundOutset <= 0 || !child->bitFields.visible || child->_alpha <= 0) {
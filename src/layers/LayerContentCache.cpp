@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "LayerContentCache.h"
+#include <algorithm>
+#include <mutex>
+
+namespace tgfx {
+// The expired entries are swept once the cache grows beyond twice its size after the last sweep.
+static constexpr size_t MIN_SWEEP_COUNT = 64;
+
+static std::mutex& CacheLocker = *new std::mutex;
+static BytesKeyMap<std::weak_ptr<LayerContent>>& ContentMap =
+    *new BytesKeyMap<std::weak_ptr<LayerContent>>;
+static size_t SweepThreshold = MIN_SWEEP_COUNT;
+
+std::shared_ptr<LayerContent> LayerContentCache::Find(const BytesKey& contentKey) {
+  std::lock_guard<std::mutex> autoLock(CacheLocker);
+  auto result = ContentMap.find(contentKey);
+  if (result == ContentMap.end()) {
+    return nullptr;
+  }
+  auto content = result->second.lock();
+  if (content == nullptr) {
+    ContentMap.erase(result);
+  }
+  return content;
+}
+
+void LayerContentCache::Add(const BytesKey& contentKey,
+                            const std::shared_ptr<LayerContent>& content) {
+  if (content == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> autoLock(CacheLocker);
+  ContentMap[contentKey] = content;
+  if (ContentMap.size() < SweepThreshold) {
+    return;
+  }
+  for (auto item = ContentMap.begin(); item != ContentMap.end();) {
+    if (item->second.expired()) {
+      item = ContentMap.erase(item);
+    } else {
+      ++item;
+    }
+  }
+  SweepThreshold = std::max(ContentMap.size() * 2, MIN_SWEEP_COUNT);
+}
+}  // namespace tgfx
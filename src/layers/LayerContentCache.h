@@ -0,0 +1,43 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "layers/contents/LayerContent.h"
+#include "tgfx/core/BytesKey.h"
+
+namespace tgfx {
+/**
+ * LayerContentCache shares the recorded contents between layers that draw identical things, such
+ * as repeated markers or icon instances. Contents are looked up by a key describing everything
+ * that affects the recording, and the cache only holds weak references, so a content is released
+ * once the last layer using it drops it. All methods are thread-safe.
+ */
+class LayerContentCache {
+ public:
+  /**
+   * Returns the content recorded for the given key, or nullptr if there is none alive.
+   */
+  static std::shared_ptr<LayerContent> Find(const BytesKey& contentKey);
+
+  /**
+   * Stores the content recorded for the given key, replacing any existing one.
+   */
+  static void Add(const BytesKey& contentKey, const std::shared_ptr<LayerContent>& content);
+};
+}  // namespace tgfx
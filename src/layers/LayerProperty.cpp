@@ -32,6 +32,7 @@ void LayerProperty::invalidateContent() {
 void LayerProperty::invalidateTransform() {
   for (auto& owner : owners) {
     if (auto layer = owner.lock()) {
+      layer->invalidateCache();
       layer->invalidateTransform();
     }
   }
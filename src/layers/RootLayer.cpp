@@ -44,6 +44,11 @@ void RootLayer::invalidateRect(const Rect& rect) {
   if (rect.isEmpty()) {
     return;
   }
+  for (auto& dirtyRect : dirtyRects) {
+    if (dirtyRect.contains(rect)) {
+      return;
+    }
+  }
   DEBUG_ASSERT(dirtyRects.size() <= MAX_DIRTY_REGIONS);
   dirtyRects.push_back(rect);
   dirtyAreas.push_back(rect.area());
@@ -51,17 +56,23 @@ void RootLayer::invalidateRect(const Rect& rect) {
 }
 
 bool RootLayer::mergeDirtyList(bool forceMerge) {
-  // Merge the pair of rectangles that increases the total area the least.
+  // Merge the pair of rectangles that increases the total area the least. Unless forced, only pairs
+  // that overlap or nearly touch are merged, so small regions far apart from each other are kept
+  // separate and the redraw cost stays proportional to the changed pixels.
   auto dirtySize = dirtyRects.size();
   if (dirtySize <= 1) {
     return false;
   }
-  float bestDelta = forceMerge ? std::numeric_limits<float>::max() : 0;
+  float bestDelta = std::numeric_limits<float>::max();
   size_t mergeA = 0;
   size_t mergeB = 0;
   for (size_t i = 0; i < dirtySize; i++) {
     for (size_t j = i + 1; j < dirtySize; j++) {
-      auto delta = UnionArea(dirtyRects[i], dirtyRects[j]) - dirtyAreas[i] - dirtyAreas[j];
+      auto area = dirtyAreas[i] + dirtyAreas[j];
+      auto delta = UnionArea(dirtyRects[i], dirtyRects[j]) - area;
+      if (!forceMerge && delta >= area * DIRTY_REGION_MERGE_TOLERANCE) {
+        continue;
+      }
       if (bestDelta > delta) {
         mergeA = i;
         mergeB = j;
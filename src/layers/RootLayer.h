@@ -22,8 +22,14 @@
 #include "tgfx/layers/Layer.h"
 
 namespace tgfx {
-// Maximum number of dirty regions that can be tracked in the root layer.
-static constexpr size_t MAX_DIRTY_REGIONS = 3;
+// Maximum number of dirty regions that can be tracked in the root layer. Each region costs one
+// traversal of the layer tree when redrawn, so the list is merged down once it exceeds this size.
+static constexpr size_t MAX_DIRTY_REGIONS = 16;
+
+// Two dirty regions are coalesced if their union grows the total dirty area by less than this
+// fraction of the two areas combined, since redrawing a few extra pixels is cheaper than an
+// additional traversal of the layer tree.
+static constexpr float DIRTY_REGION_MERGE_TOLERANCE = 0.25f;
 
 /**
  * The RootLayer class represents the root layer of a display list. It is the top-level layer that
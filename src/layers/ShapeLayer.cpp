@@ -17,11 +17,20 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "tgfx/layers/ShapeLayer.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include "core/PathRef.h"
+#include "core/utils/UniqueID.h"
+#include "tgfx/core/BytesKey.h"
 #include "tgfx/core/PathEffect.h"
+#include "tgfx/layers/SolidColor.h"
 
 namespace tgfx {
 std::shared_ptr<ShapeLayer> ShapeLayer::Make() {
-  return std::shared_ptr<ShapeLayer>(new ShapeLayer());
+  auto layer = std::shared_ptr<ShapeLayer>(new ShapeLayer());
+  layer->enableContentSharing();
+  return layer;
 }
 
 Path ShapeLayer::path() const {
@@ -37,7 +46,7 @@ void ShapeLayer::setPath(Path path) {
     return;
   }
   _shape = Shape::MakeFrom(std::move(path));
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setShape(std::shared_ptr<Shape> value) {
@@ -45,7 +54,7 @@ void ShapeLayer::setShape(std::shared_ptr<Shape> value) {
     return;
   }
   _shape = std::move(value);
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setFillStyles(std::vector<std::shared_ptr<ShapeStyle>> fills) {
@@ -139,7 +148,7 @@ void ShapeLayer::setLineCap(LineCap cap) {
     return;
   }
   stroke.cap = cap;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setLineJoin(LineJoin join) {
@@ -147,7 +156,7 @@ void ShapeLayer::setLineJoin(LineJoin join) {
     return;
   }
   stroke.join = join;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setMiterLimit(float limit) {
@@ -155,7 +164,7 @@ void ShapeLayer::setMiterLimit(float limit) {
     return;
   }
   stroke.miterLimit = limit;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setLineWidth(float width) {
@@ -163,7 +172,7 @@ void ShapeLayer::setLineWidth(float width) {
     return;
   }
   stroke.width = width;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setLineDashPattern(const std::vector<float>& pattern) {
@@ -172,7 +181,7 @@ void ShapeLayer::setLineDashPattern(const std::vector<float>& pattern) {
     return;
   }
   _lineDashPattern = pattern;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setLineDashPhase(float phase) {
@@ -180,7 +189,7 @@ void ShapeLayer::setLineDashPhase(float phase) {
     return;
   }
   _lineDashPhase = phase;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setLineDashAdaptive(bool adaptive) {
@@ -188,7 +197,7 @@ void ShapeLayer::setLineDashAdaptive(bool adaptive) {
     return;
   }
   shapeBitFields.lineDashAdaptive = adaptive;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setStrokeStart(float start) {
@@ -202,7 +211,7 @@ void ShapeLayer::setStrokeStart(float start) {
     return;
   }
   _strokeStart = start;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setStrokeEnd(float end) {
@@ -216,7 +225,7 @@ void ShapeLayer::setStrokeEnd(float end) {
     return;
   }
   _strokeEnd = end;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setStrokeAlign(StrokeAlign align) {
@@ -225,7 +234,7 @@ void ShapeLayer::setStrokeAlign(StrokeAlign align) {
     return;
   }
   shapeBitFields.strokeAlign = alignment;
-  invalidateContent();
+  invalidateGeometry();
 }
 
 void ShapeLayer::setStrokeOnTop(bool value) {
@@ -236,6 +245,11 @@ void ShapeLayer::setStrokeOnTop(bool value) {
   invalidateContent();
 }
 
+void ShapeLayer::invalidateGeometry() {
+  cachedStrokeShape = nullptr;
+  invalidateContent();
+}
+
 ShapeLayer::ShapeLayer() {
   memset(&shapeBitFields, 0, sizeof(shapeBitFields));
 }
@@ -274,7 +288,12 @@ void ShapeLayer::onUpdateContent(LayerRecorder* recorder) {
   }
   auto fillPaints = createShapePaints(_fillStyles);
   auto strokePaints = stroke.width > 0 ? createShapePaints(_strokeStyles) : std::vector<Paint>();
-  auto strokeShape = strokePaints.empty() ? nullptr : createStrokeShape();
+  if (!strokePaints.empty() && cachedStrokeShape == nullptr) {
+    // The stroke shape only depends on the geometry. Keeping it across paint-only changes avoids
+    // rerunning the path effects and preserves the masks and triangles cached for the shape.
+    cachedStrokeShape = createStrokeShape();
+  }
+  auto strokeShape = strokePaints.empty() ? nullptr : cachedStrokeShape;
   auto canvas = recorder->getCanvas(LayerContentType::Default);
   for (auto& paint : fillPaints) {
     canvas->drawShape(_shape, paint);
@@ -293,6 +312,96 @@ void ShapeLayer::onUpdateContent(LayerRecorder* recorder) {
   DrawContour(canvas, strokeShape, strokePaints);
 }
 
+// The expired shape IDs are swept once the map grows beyond twice its size after the last sweep.
+static constexpr size_t MIN_SHAPE_ID_SWEEP_COUNT = 64;
+
+struct ShapeID {
+  std::weak_ptr<Shape> shape;
+  uint32_t uniqueID = 0;
+};
+
+static std::mutex& ShapeIDLocker = *new std::mutex;
+static std::unordered_map<const Shape*, ShapeID>& ShapeIDMap =
+    *new std::unordered_map<const Shape*, ShapeID>;
+static size_t ShapeIDSweepThreshold = MIN_SHAPE_ID_SWEEP_COUNT;
+
+/**
+ * Returns an ID that identifies the given shape for as long as it lives. Unlike the address of the
+ * shape, the ID is never reused by another shape, so a shared recording cached under it can't be
+ * picked up by a different shape allocated at the same address later.
+ */
+static uint32_t GetShapeID(const std::shared_ptr<Shape>& shape) {
+  std::lock_guard<std::mutex> autoLock(ShapeIDLocker);
+  auto& shapeID = ShapeIDMap[shape.get()];
+  if (shapeID.shape.expired()) {
+    shapeID.shape = shape;
+    shapeID.uniqueID = UniqueID::Next();
+  }
+  auto uniqueID = shapeID.uniqueID;
+  if (ShapeIDMap.size() >= ShapeIDSweepThreshold) {
+    for (auto item = ShapeIDMap.begin(); item != ShapeIDMap.end();) {
+      if (item->second.shape.expired()) {
+        item = ShapeIDMap.erase(item);
+      } else {
+        ++item;
+      }
+    }
+    ShapeIDSweepThreshold = std::max(ShapeIDMap.size() * 2, MIN_SHAPE_ID_SWEEP_COUNT);
+  }
+  return uniqueID;
+}
+
+bool ShapeLayer::onGetContentKey(BytesKey* contentKey) const {
+  if (_shape == nullptr || !WriteStylesKey(_fillStyles, contentKey) ||
+      !WriteStylesKey(_strokeStyles, contentKey)) {
+    return false;
+  }
+  // Shapes are immutable, so they are identified by their paths or by themselves.
+  if (_shape->isSimplePath()) {
+    contentKey->write(1);
+    contentKey->write(PathRef::GetUniqueKey(_shape->getPath()).domainID());
+  } else {
+    contentKey->write(0);
+    contentKey->write(GetShapeID(_shape));
+  }
+  contentKey->write(stroke.width);
+  contentKey->write(static_cast<uint32_t>(stroke.cap));
+  contentKey->write(static_cast<uint32_t>(stroke.join));
+  contentKey->write(stroke.miterLimit);
+  contentKey->write(static_cast<uint32_t>(_lineDashPattern.size()));
+  for (auto& dash : _lineDashPattern) {
+    contentKey->write(dash);
+  }
+  contentKey->write(_lineDashPhase);
+  contentKey->write(_strokeStart);
+  contentKey->write(_strokeEnd);
+  uint32_t flags = shapeBitFields.strokeOnTop ? 1 : 0;
+  flags |= shapeBitFields.lineDashAdaptive ? 2 : 0;
+  flags |= static_cast<uint32_t>(shapeBitFields.strokeAlign) << 2;
+  contentKey->write(flags);
+  return true;
+}
+
+bool ShapeLayer::WriteStylesKey(const std::vector<std::shared_ptr<ShapeStyle>>& styles,
+                                BytesKey* contentKey) {
+  // Only solid colors are fully described by their values. Other styles may be changed in place,
+  // which would leave the shared recordings stale.
+  contentKey->write(static_cast<uint32_t>(styles.size()));
+  for (auto& style : styles) {
+    if (style->getType() != ShapeStyle::Type::SolidColor) {
+      return false;
+    }
+    auto& color = static_cast<const SolidColor*>(style.get())->color();
+    contentKey->write(color.red);
+    contentKey->write(color.green);
+    contentKey->write(color.blue);
+    contentKey->write(color.alpha);
+    contentKey->write(style->alpha());
+    contentKey->write(static_cast<uint32_t>(style->blendMode()));
+  }
+  return true;
+}
+
 std::vector<Paint> ShapeLayer::createShapePaints(
     const std::vector<std::shared_ptr<ShapeStyle>>& styles) const {
   std::vector<Paint> paintList = {};
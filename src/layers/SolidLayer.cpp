@@ -17,10 +17,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "tgfx/layers/SolidLayer.h"
+#include "tgfx/core/BytesKey.h"
 
 namespace tgfx {
 std::shared_ptr<SolidLayer> SolidLayer::Make() {
-  return std::shared_ptr<SolidLayer>(new SolidLayer());
+  auto layer = std::shared_ptr<SolidLayer>(new SolidLayer());
+  layer->enableContentSharing();
+  return layer;
 }
 
 void SolidLayer::setWidth(float width) {
@@ -81,4 +84,15 @@ void SolidLayer::onUpdateContent(LayerRecorder* recorder) {
   canvas->drawRRect(rRect, paint);
 }
 
+bool SolidLayer::onGetContentKey(BytesKey* contentKey) const {
+  contentKey->write(_width);
+  contentKey->write(_height);
+  contentKey->write(_radiusX);
+  contentKey->write(_radiusY);
+  contentKey->write(_color.red);
+  contentKey->write(_color.green);
+  contentKey->write(_color.blue);
+  contentKey->write(_color.alpha);
+  return true;
+}
 }  // namespace tgfx
\ No newline at end of file
@@ -18,6 +18,7 @@
 
 #include "tgfx/layers/TextLayer.h"
 #include "core/utils/Log.h"
+#include "tgfx/core/BytesKey.h"
 #include "tgfx/core/UTF.h"
 
 namespace tgfx {
@@ -91,7 +92,9 @@ std::vector<std::shared_ptr<Typeface>> GetFallbackTypefaces() {
 }
 
 std::shared_ptr<TextLayer> TextLayer::Make() {
-  return std::shared_ptr<TextLayer>(new TextLayer());
+  auto layer = std::shared_ptr<TextLayer>(new TextLayer());
+  layer->enableContentSharing();
+  return layer;
 }
 
 void TextLayer::setText(const std::string& text) {
@@ -99,7 +102,7 @@ void TextLayer::setText(const std::string& text) {
     return;
   }
   _text = text;
-  invalidateContent();
+  invalidateLayout();
 }
 
 void TextLayer::setTextColor(const Color& color) {
@@ -115,7 +118,7 @@ void TextLayer::setFont(const Font& font) {
     return;
   }
   _font = font;
-  invalidateContent();
+  invalidateLayout();
 }
 
 void TextLayer::setWidth(float width) {
@@ -126,7 +129,7 @@ void TextLayer::setWidth(float width) {
     return;
   }
   _width = width;
-  invalidateContent();
+  invalidateLayout();
 }
 
 void TextLayer::setHeight(float height) {
@@ -137,7 +140,7 @@ void TextLayer::setHeight(float height) {
     return;
   }
   _height = height;
-  invalidateContent();
+  invalidateLayout();
 }
 
 void TextLayer::setTextAlign(TextAlign align) {
@@ -145,7 +148,7 @@ void TextLayer::setTextAlign(TextAlign align) {
     return;
   }
   _textAlign = align;
-  invalidateContent();
+  invalidateLayout();
 }
 
 void TextLayer::setAutoWrap(bool value) {
@@ -153,12 +156,63 @@ void TextLayer::setAutoWrap(bool value) {
     return;
   }
   _autoWrap = value;
+  invalidateLayout();
+}
+
+void TextLayer::invalidateLayout() {
+  textBlob = nullptr;
   invalidateContent();
 }
 
 void TextLayer::onUpdateContent(LayerRecorder* recorder) {
+  if (textBlob == nullptr) {
+    // The text layout does not depend on the text color, so color changes only re-record the
+    // cached TextBlob, which also keeps the glyph atlas lookups cached for its runs.
+    textBlob = buildTextBlob();
+    if (textBlob == nullptr) {
+      return;
+    }
+  }
+  Paint paint = {};
+  paint.setColor(_textColor);
+  auto canvas = recorder->getCanvas();
+  canvas->drawTextBlob(textBlob, 0, 0, paint);
+}
+
+bool TextLayer::onGetContentKey(BytesKey* contentKey) const {
+  auto typeface = _font.getTypeface();
+  contentKey->write(typeface ? typeface->uniqueID() : 0u);
+  contentKey->write(_font.getSize());
+  uint32_t flags = _font.isFauxBold() ? 1 : 0;
+  flags |= _font.isFauxItalic() ? 2 : 0;
+  flags |= _autoWrap ? 4 : 0;
+  flags |= static_cast<uint32_t>(_textAlign) << 3;
+  contentKey->write(flags);
+  contentKey->write(_width);
+  contentKey->write(_height);
+  contentKey->write(_textColor.red);
+  contentKey->write(_textColor.green);
+  contentKey->write(_textColor.blue);
+  contentKey->write(_textColor.alpha);
+  // The fallback typefaces take part in the layout, so they are part of the key as well.
+  auto fallbackTypefaces = GetFallbackTypefaces();
+  contentKey->write(static_cast<uint32_t>(fallbackTypefaces.size()));
+  for (auto& fallbackTypeface : fallbackTypefaces) {
+    contentKey->write(fallbackTypeface ? fallbackTypeface->uniqueID() : 0u);
+  }
+  contentKey->write(static_cast<uint32_t>(_text.size()));
+  for (size_t i = 0; i < _text.size(); i += 4) {
+    uint32_t word = 0;
+    auto count = std::min(_text.size() - i, static_cast<size_t>(4));
+    memcpy(&word, _text.data() + i, count);
+    contentKey->write(word);
+  }
+  return true;
+}
+
+std::shared_ptr<TextBlob> TextLayer::buildTextBlob() const {
   if (_text.empty()) {
-    return;
+    return nullptr;
   }
 
   // 1. preprocess newlines, convert \r\n, \r to \n
@@ -167,7 +221,7 @@ void TextLayer::onUpdateContent(LayerRecorder* recorder) {
   // 2. shape text to glyphs, handle font fallback
   const auto& glyphInfos = ShapeText(text, _font.getTypeface());
   if (glyphInfos.empty()) {
-    return;
+    return nullptr;
   }
 
   // 3. Handle text wrapping and auto-wrapping
@@ -207,19 +261,15 @@ void TextLayer::onUpdateContent(LayerRecorder* recorder) {
   std::vector<Point> positions = {};
   resolveTextAlignment(glyphLines, emptyAdvance, finalGlyphs, positions);
   if (finalGlyphs.size() != positions.size()) {
-    LOGE("TextLayer::onUpdateContent finalGlyphs.size() != positions.size(), error.");
-    return;
+    LOGE("TextLayer::buildTextBlob finalGlyphs.size() != positions.size(), error.");
+    return nullptr;
   }
 
   // 6. Calculate the final glyphs and positions for rendering
   std::vector<GlyphRun> glyphRunList;
   buildGlyphRunList(finalGlyphs, positions, glyphRunList);
 
-  auto textBlob = TextBlob::MakeFrom(std::move(glyphRunList));
-  Paint paint = {};
-  paint.setColor(_textColor);
-  auto canvas = recorder->getCanvas();
-  canvas->drawTextBlob(textBlob, 0, 0, paint);
+  return TextBlob::MakeFrom(std::move(glyphRunList));
 }
 
 std::string TextLayer::PreprocessNewLines(const std::string& text) {
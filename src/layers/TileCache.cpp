@@ -77,7 +77,7 @@ std::vector<std::shared_ptr<Tile>> TileCache::getTilesUnderRect(const Rect& rect
       auto firstTile = tiles.front();
       *continuous = true;
       for (auto& tile : tiles) {
-        if (tile->tileX - firstTile->tileX != tile->sourceX - firstTile->sourceX ||
+        if (tile->demoted || tile->tileX - firstTile->tileX != tile->sourceX - firstTile->sourceX ||
             tile->tileY - firstTile->tileY != tile->sourceY - firstTile->sourceY) {
           *continuous = false;
           break;
@@ -47,12 +47,22 @@ class Tile {
    * The tile's y-coordinate in the zoomed display list grid.
    */
   int tileY = 0;
+  /**
+   * True if the tile was rendered ahead of the viewport and has not been displayed yet.
+   */
+  bool prefetched = false;
+  /**
+   * True if the tile is stored at half resolution in the demoted atlas, where the source
+   * coordinates are in units of half the tile size.
+   */
+  bool demoted = false;
 
   /**
    * Returns the source rectangle of the tile in the atlas.
    */
   Rect getSourceRect(int tileSize) const {
-    return Rect::MakeXYWH(sourceX * tileSize, sourceY * tileSize, tileSize, tileSize);
+    auto sourceSize = demoted ? tileSize / 2 : tileSize;
+    return Rect::MakeXYWH(sourceX * sourceSize, sourceY * sourceSize, sourceSize, sourceSize);
   }
 
   /**
@@ -89,7 +99,8 @@ class TileCache {
    * @param rect The rectangle to check for tiles.
    * @param requireFullCoverage If true, only returns tiles when the rectangle is fully covered.
    * @param continuous This output parameter is set to true if all tiles in the region exist and
-   * their source coordinates (sourceX/sourceY) form a contiguous, aligned block on the surface.
+   * their source coordinates (sourceX/sourceY) form a contiguous, aligned block on the surface. It
+   * is always false if any of the tiles is demoted.
    * @return
    */
   std::vector<std::shared_ptr<Tile>> getTilesUnderRect(const Rect& rect,
@@ -108,8 +119,9 @@ class TileCache {
   bool removeTile(int tileX, int tileY);
 
   /**
-   * Returns a list of reusable tiles. These tiles have no external references and are sorted by
-   * their distance to the viewport center, with the closest ones first.
+   * Returns a list of reusable tiles. These tiles have no external references. Prefetched tiles
+   * that have not been displayed yet come first, and the tiles in each group are sorted by their
+   * distance to the viewport center, with the closest ones first.
    */
   std::vector<std::shared_ptr<Tile>> getReusableTiles(float centerX, float centerY);
 
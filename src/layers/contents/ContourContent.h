@@ -35,6 +35,10 @@ class ContourContent : public LayerContent {
     return content->getTightBounds(matrix);
   }
 
+  Rect getOpaqueBounds() const override {
+    return content->getOpaqueBounds();
+  }
+
   bool hitTestPoint(float localX, float localY, bool shapeHitTest) const override {
     return content->hitTestPoint(localX, localY, shapeHitTest);
   }
@@ -35,6 +35,17 @@ Rect ForegroundContent::getTightBounds(const Matrix& matrix) const {
   return bounds;
 }
 
+Rect ForegroundContent::getOpaqueBounds() const {
+  auto bounds = foreground->getOpaqueBounds();
+  if (background) {
+    auto backgroundBounds = background->getOpaqueBounds();
+    if (backgroundBounds.area() > bounds.area()) {
+      bounds = backgroundBounds;
+    }
+  }
+  return bounds;
+}
+
 bool ForegroundContent::hitTestPoint(float localX, float localY, bool shapeHitTest) const {
   if (foreground->hitTestPoint(localX, localY, shapeHitTest)) {
     return true;
@@ -32,6 +32,8 @@ class ForegroundContent : public LayerContent {
 
   Rect getTightBounds(const Matrix& matrix) const override;
 
+  Rect getOpaqueBounds() const override;
+
   bool hitTestPoint(float localX, float localY, bool shapeHitTest) const override;
 
   void drawDefault(Canvas* canvas, const FillModifier* modifier) const override;
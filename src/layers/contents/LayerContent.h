@@ -41,6 +41,12 @@ class LayerContent {
    */
   virtual Rect getTightBounds(const Matrix& matrix) const = 0;
 
+  /**
+   * Returns a rectangle within the content that is fully covered by opaque pixels, or an empty
+   * Rect if there is none. Layers drawn beneath this area are hidden by the content.
+   */
+  virtual Rect getOpaqueBounds() const = 0;
+
   /**
    * Checks if the layer content overlaps or intersects with the specified point (localX, localY).
    * The localX and localY coordinates are in the layer's local coordinate space. If the
@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "tgfx/core/Path.h"
+#include "tgfx/core/Point.h"
+
+namespace tgfx {
+/**
+ * Returns count random points inside [0, size) x [0, size). The sequence is the same on every run.
+ */
+inline std::vector<Point> MakeRandomPoints(int64_t count, float size = 1000.0f) {
+  std::mt19937 random(7);
+  std::uniform_real_distribution<float> distribution(0.0f, size);
+  std::vector<Point> points(static_cast<size_t>(count));
+  for (auto& point : points) {
+    point.set(distribution(random), distribution(random));
+  }
+  return points;
+}
+
+/**
+ * Returns a star polygon with the given number of tips, centered in a square of the given size.
+ * Larger tip counts produce more complex paths.
+ */
+inline Path MakeStarPath(int64_t tips, float size = 512.0f) {
+  Path path = {};
+  auto center = size * 0.5f;
+  auto outerRadius = size * 0.48f;
+  auto innerRadius = size * 0.3f;
+  auto count = tips * 2;
+  auto step = static_cast<float>(M_PI) * 2.0f / static_cast<float>(count);
+  for (int64_t i = 0; i < count; i++) {
+    auto angle = step * static_cast<float>(i);
+    auto radius = i % 2 == 0 ? outerRadius : innerRadius;
+    auto x = center + radius * cosf(angle);
+    auto y = center + radius * sinf(angle);
+    if (i == 0) {
+      path.moveTo(x, y);
+    } else {
+      path.lineTo(x, y);
+    }
+  }
+  path.close();
+  return path;
+}
+
+/**
+ * Returns an open wave made of the given number of cubic segments across a square of the given
+ * size.
+ */
+inline Path MakeWavePath(int64_t segments, float size = 512.0f) {
+  Path path = {};
+  auto step = size / static_cast<float>(segments);
+  auto middle = size * 0.5f;
+  path.moveTo(0, middle);
+  for (int64_t i = 0; i < segments; i++) {
+    auto x = static_cast<float>(i) * step;
+    auto amplitude = i % 2 == 0 ? size * 0.4f : -size * 0.4f;
+    path.cubicTo(x + step * 0.3f, middle + amplitude, x + step * 0.7f, middle + amplitude,
+                 x + step, middle);
+  }
+  return path;
+}
+}  // namespace tgfx
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tgfx {
+/**
+ * BenchmarkState controls the timed loop of a single benchmark run. The benchmark body performs
+ * its setup first, then repeats the measured work while keepRunning() returns true. Only the time
+ * spent inside the loop is measured.
+ */
+class BenchmarkState {
+ public:
+  BenchmarkState(int64_t arg, uint64_t iterations) : _arg(arg), _iterations(iterations) {
+  }
+
+  /**
+   * Returns the input parameter of this run, such as the path complexity or the image size.
+   */
+  int64_t arg() const {
+    return _arg;
+  }
+
+  /**
+   * Returns the number of iterations the loop runs.
+   */
+  uint64_t iterations() const {
+    return _iterations;
+  }
+
+  /**
+   * Returns true while the loop should keep running. The timer starts at the first call and stops
+   * when it returns false.
+   */
+  bool keepRunning() {
+    if (remaining == _iterations) {
+      startTime = std::chrono::steady_clock::now();
+    }
+    if (remaining > 0) {
+      remaining--;
+      return true;
+    }
+    elapsed += std::chrono::steady_clock::now() - startTime;
+    return false;
+  }
+
+  /**
+   * Stops the timer temporarily, e.g. to reset the state between iterations.
+   */
+  void pauseTiming() {
+    elapsed += std::chrono::steady_clock::now() - startTime;
+  }
+
+  /**
+   * Restarts the timer after pauseTiming().
+   */
+  void resumeTiming() {
+    startTime = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * Sets the number of items processed by each iteration, reported as items per second.
+   */
+  void setItemsPerIteration(int64_t items) {
+    itemsPerIteration = items;
+  }
+
+  /**
+   * Sets the number of bytes processed by each iteration, reported as bytes per second.
+   */
+  void setBytesPerIteration(int64_t bytes) {
+    bytesPerIteration = bytes;
+  }
+
+  /**
+   * Sets a custom value that is reported together with the timing results.
+   */
+  void setCounter(const std::string& name, double value) {
+    counters[name] = value;
+  }
+
+  /**
+   * Returns the measured time of the loop in nanoseconds.
+   */
+  double elapsedNanoseconds() const {
+    return std::chrono::duration<double, std::nano>(elapsed).count();
+  }
+
+ private:
+  int64_t _arg = 0;
+  uint64_t _iterations = 0;
+  uint64_t remaining = _iterations;
+  std::chrono::steady_clock::time_point startTime = {};
+  std::chrono::steady_clock::duration elapsed = {};
+  int64_t itemsPerIteration = 0;
+  int64_t bytesPerIteration = 0;
+  std::map<std::string, double> counters = {};
+
+  friend class BenchmarkRunner;
+};
+
+using BenchmarkFunction = void (*)(BenchmarkState& state);
+
+/**
+ * Registers a benchmark that runs once for each of the given arguments. If the argument list is
+ * empty, the benchmark runs once with the argument 0. Returns true so that it can initialize a
+ * static variable.
+ */
+bool RegisterBenchmark(const char* name, BenchmarkFunction function, std::vector<int64_t> args);
+
+/**
+ * Prevents the compiler from optimizing away the computation of the given value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink = nullptr;
+  sink = &value;
+#endif
+}
+}  // namespace tgfx
+
+/**
+ * Defines and registers a benchmark. The optional arguments are the values returned by
+ * BenchmarkState::arg() for each run, for example:
+ *
+ *   TGFX_BENCHMARK(PathToAATriangles, 16, 256, 4096) {
+ *     auto path = MakePath(state.arg());
+ *     while (state.keepRunning()) {
+ *       ...
+ *     }
+ *   }
+ */
+#define TGFX_BENCHMARK(name, ...)                                                                 \
+  static void Benchmark_##name(tgfx::BenchmarkState& state);                                      \
+  [[maybe_unused]] static bool Benchmark_##name##_registered =                                    \
+      tgfx::RegisterBenchmark(#name, Benchmark_##name, std::vector<int64_t>{__VA_ARGS__});        \
+  static void Benchmark_##name(tgfx::BenchmarkState& state)
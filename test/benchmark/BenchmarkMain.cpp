@@ -0,0 +1,240 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <thread>
+#include "Benchmark.h"
+#include "nlohmann/json.hpp"
+
+namespace tgfx {
+struct BenchmarkEntry {
+  std::string name = {};
+  BenchmarkFunction function = nullptr;
+  std::vector<int64_t> args = {};
+};
+
+static std::vector<BenchmarkEntry>& GetBenchmarks() {
+  static auto& benchmarks = *new std::vector<BenchmarkEntry>();
+  return benchmarks;
+}
+
+bool RegisterBenchmark(const char* name, BenchmarkFunction function, std::vector<int64_t> args) {
+  if (args.empty()) {
+    args.push_back(0);
+  }
+  GetBenchmarks().push_back({name, function, std::move(args)});
+  return true;
+}
+
+struct BenchmarkOptions {
+  std::string filter = {};
+  std::string outputPath = {};
+  double minTime = 0.5;
+  int repetitions = 3;
+  bool listOnly = false;
+};
+
+struct BenchmarkResult {
+  std::string name = {};
+  uint64_t iterations = 0;
+  double nsPerIteration = 0;
+  double minNsPerIteration = 0;
+  double itemsPerSecond = 0;
+  double bytesPerSecond = 0;
+  std::map<std::string, double> counters = {};
+};
+
+class BenchmarkRunner {
+ public:
+  explicit BenchmarkRunner(const BenchmarkOptions& options) : options(options) {
+  }
+
+  BenchmarkResult run(const std::string& name, BenchmarkFunction function, int64_t arg) {
+    // Grows the iteration count until a single run lasts at least the minimum time.
+    uint64_t iterations = 1;
+    auto minNanoseconds = options.minTime * 1e9;
+    while (true) {
+      BenchmarkState state(arg, iterations);
+      function(state);
+      auto elapsed = state.elapsedNanoseconds();
+      if (elapsed >= minNanoseconds || iterations >= MaxIterations) {
+        break;
+      }
+      auto multiplier = elapsed > 0 ? minNanoseconds * 1.4 / elapsed : 100.0;
+      multiplier = std::clamp(multiplier, 2.0, 100.0);
+      iterations = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+      iterations = std::min(iterations, MaxIterations);
+    }
+    std::vector<double> samples = {};
+    BenchmarkResult result = {};
+    result.name = name;
+    result.iterations = iterations;
+    int64_t itemsPerIteration = 0;
+    int64_t bytesPerIteration = 0;
+    for (int i = 0; i < std::max(options.repetitions, 1); i++) {
+      BenchmarkState state(arg, iterations);
+      function(state);
+      samples.push_back(state.elapsedNanoseconds() / static_cast<double>(iterations));
+      itemsPerIteration = state.itemsPerIteration;
+      bytesPerIteration = state.bytesPerIteration;
+      result.counters = state.counters;
+    }
+    std::sort(samples.begin(), samples.end());
+    result.nsPerIteration = samples[samples.size() / 2];
+    result.minNsPerIteration = samples.front();
+    if (result.nsPerIteration > 0) {
+      result.itemsPerSecond = static_cast<double>(itemsPerIteration) * 1e9 / result.nsPerIteration;
+      result.bytesPerSecond = static_cast<double>(bytesPerIteration) * 1e9 / result.nsPerIteration;
+    }
+    return result;
+  }
+
+ private:
+  static constexpr uint64_t MaxIterations = 1000000000;
+  BenchmarkOptions options = {};
+};
+
+static bool ParseOptions(int argc, char** argv, BenchmarkOptions* options) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto separator = arg.find('=');
+    auto key = arg.substr(0, separator);
+    auto value = separator == std::string::npos ? "" : arg.substr(separator + 1);
+    if (key == "--filter") {
+      options->filter = value;
+    } else if (key == "--out") {
+      options->outputPath = value;
+    } else if (key == "--min_time") {
+      options->minTime = std::atof(value.c_str());
+    } else if (key == "--repetitions") {
+      options->repetitions = std::atoi(value.c_str());
+    } else if (key == "--list") {
+      options->listOnly = true;
+    } else {
+      printf("Usage: TGFXBenchmark [--filter=<substring>] [--min_time=<seconds>] "
+             "[--repetitions=<count>] [--out=<result.json>] [--list]\n");
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::string FormatRate(double value, const char* unit) {
+  static const char* prefixes[] = {"", "k", "M", "G", "T"};
+  size_t index = 0;
+  while (value >= 1000.0 && index < 4) {
+    value /= 1000.0;
+    index++;
+  }
+  char text[64] = {};
+  snprintf(text, sizeof(text), "%.2f %s%s/s", value, prefixes[index], unit);
+  return text;
+}
+
+static std::string CurrentDate() {
+  auto now = std::time(nullptr);
+  char text[32] = {};
+  std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  return text;
+}
+
+static nlohmann::json ToJSON(const std::vector<BenchmarkResult>& results) {
+  nlohmann::json benchmarks = nlohmann::json::array();
+  for (auto& result : results) {
+    nlohmann::json item = {{"name", result.name},
+                           {"iterations", result.iterations},
+                           {"ns_per_iter", result.nsPerIteration},
+                           {"min_ns_per_iter", result.minNsPerIteration}};
+    if (result.itemsPerSecond > 0) {
+      item["items_per_second"] = result.itemsPerSecond;
+    }
+    if (result.bytesPerSecond > 0) {
+      item["bytes_per_second"] = result.bytesPerSecond;
+    }
+    if (!result.counters.empty()) {
+      item["counters"] = result.counters;
+    }
+    benchmarks.push_back(std::move(item));
+  }
+#ifdef NDEBUG
+  auto buildType = "release";
+#else
+  auto buildType = "debug";
+#endif
+  nlohmann::json context = {{"date", CurrentDate()},
+                            {"num_cpus", std::thread::hardware_concurrency()},
+                            {"build_type", buildType}};
+  return {{"context", context}, {"benchmarks", benchmarks}};
+}
+
+static int RunBenchmarks(int argc, char** argv) {
+  BenchmarkOptions options = {};
+  if (!ParseOptions(argc, argv, &options)) {
+    return 1;
+  }
+  auto benchmarks = GetBenchmarks();
+  std::sort(benchmarks.begin(), benchmarks.end(),
+            [](const BenchmarkEntry& a, const BenchmarkEntry& b) { return a.name < b.name; });
+  BenchmarkRunner runner(options);
+  std::vector<BenchmarkResult> results = {};
+  if (!options.listOnly) {
+    printf("%-48s %14s %12s %16s\n", "Benchmark", "Time(ns)", "Iterations", "Throughput");
+  }
+  for (auto& benchmark : benchmarks) {
+    for (auto arg : benchmark.args) {
+      auto name = benchmark.name + "/" + std::to_string(arg);
+      if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+        continue;
+      }
+      if (options.listOnly) {
+        printf("%s\n", name.c_str());
+        continue;
+      }
+      auto result = runner.run(name, benchmark.function, arg);
+      std::string throughput = {};
+      if (result.bytesPerSecond > 0) {
+        throughput = FormatRate(result.bytesPerSecond, "B");
+      } else if (result.itemsPerSecond > 0) {
+        throughput = FormatRate(result.itemsPerSecond, "items");
+      }
+      printf("%-48s %14.1f %12llu %16s\n", name.c_str(), result.nsPerIteration,
+             static_cast<unsigned long long>(result.iterations), throughput.c_str());
+      fflush(stdout);
+      results.push_back(std::move(result));
+    }
+  }
+  if (!options.outputPath.empty() && !options.listOnly) {
+    std::ofstream file(options.outputPath);
+    if (!file) {
+      printf("Failed to write the results to %s\n", options.outputPath.c_str());
+      return 1;
+    }
+    file << ToJSON(results).dump(2) << std::endl;
+  }
+  return 0;
+}
+}  // namespace tgfx
+
+int main(int argc, char** argv) {
+  return tgfx::RunBenchmarks(argc, argv);
+}
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "tgfx/core/Data.h"
+#include "tgfx/core/Stream.h"
+
+namespace tgfx {
+static std::string MakeTempFile(int64_t kilobytes) {
+  auto filePath = "TGFXBenchmark_" + std::to_string(kilobytes) + "KB.bin";
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  std::vector<char> block(1024);
+  for (size_t i = 0; i < block.size(); i++) {
+    block[i] = static_cast<char>(i * 31 + 7);
+  }
+  for (int64_t i = 0; i < kilobytes; i++) {
+    file.write(block.data(), static_cast<std::streamsize>(block.size()));
+  }
+  return filePath;
+}
+
+// Returns the resident memory of the process in bytes, or 0 if it can't be measured.
+static int64_t GetResidentBytes() {
+#ifdef __linux__
+  auto file = fopen("/proc/self/statm", "r");
+  if (file == nullptr) {
+    return 0;
+  }
+  long totalPages = 0;
+  long residentPages = 0;
+  auto count = fscanf(file, "%ld %ld", &totalPages, &residentPages);
+  fclose(file);
+  return count == 2 ? static_cast<int64_t>(residentPages) * 4096 : 0;
+#else
+  return 0;
+#endif
+}
+
+// Touches one byte per page, the way a decoder that only reads the header and a few chunks would.
+static uint8_t SamplePages(const uint8_t* bytes, size_t size) {
+  uint8_t sum = 0;
+  for (size_t i = 0; i < size; i += 64 * 1024) {
+    sum = static_cast<uint8_t>(sum + bytes[i]);
+  }
+  return sum;
+}
+
+static void RunLoadFile(BenchmarkState& state, bool mapped) {
+  auto filePath = MakeTempFile(state.arg());
+  auto residentBefore = GetResidentBytes();
+  int64_t residentGrowth = 0;
+  while (state.keepRunning()) {
+    std::shared_ptr<Data> data = nullptr;
+    if (mapped) {
+      data = Data::MakeFromFile(filePath);
+    } else {
+      // The copying path that Data::MakeFromFile() used before files were memory mapped.
+      auto stream = Stream::MakeFromFile(filePath);
+      auto buffer = new uint8_t[stream->size()];
+      stream->read(buffer, stream->size());
+      data = Data::MakeAdopted(buffer, stream->size());
+    }
+    DoNotOptimize(SamplePages(data->bytes(), data->size()));
+    residentGrowth = std::max(residentGrowth, GetResidentBytes() - residentBefore);
+  }
+  state.setBytesPerIteration(state.arg() * 1024);
+  state.setCounter("residentKB", static_cast<double>(residentGrowth) / 1024.0);
+  remove(filePath.c_str());
+}
+
+TGFX_BENCHMARK(DataMakeFromFileCopy, 64, 1024, 16384) {
+  RunLoadFile(state, false);
+}
+
+TGFX_BENCHMARK(DataMakeFromFileMapped, 64, 1024, 16384) {
+  RunLoadFile(state, true);
+}
+}  // namespace tgfx
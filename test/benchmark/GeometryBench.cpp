@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.h"
+#include "BenchUtils.h"
+#include "tgfx/core/Matrix.h"
+#include "tgfx/core/Rect.h"
+
+namespace tgfx {
+TGFX_BENCHMARK(MatrixMapPointsTranslate, 64, 1024, 16384) {
+  auto count = static_cast<int>(state.arg());
+  auto src = MakeRandomPoints(count);
+  std::vector<Point> dst(src.size());
+  auto matrix = Matrix::MakeTrans(10.0f, 20.0f);
+  while (state.keepRunning()) {
+    matrix.mapPoints(dst.data(), src.data(), count);
+    DoNotOptimize(dst.data());
+  }
+  state.setItemsPerIteration(count);
+}
+
+TGFX_BENCHMARK(MatrixMapPointsScale, 64, 1024, 16384) {
+  auto count = static_cast<int>(state.arg());
+  auto src = MakeRandomPoints(count);
+  std::vector<Point> dst(src.size());
+  auto matrix = Matrix::MakeScale(1.5f, 0.5f);
+  matrix.postTranslate(10.0f, 20.0f);
+  while (state.keepRunning()) {
+    matrix.mapPoints(dst.data(), src.data(), count);
+    DoNotOptimize(dst.data());
+  }
+  state.setItemsPerIteration(count);
+}
+
+TGFX_BENCHMARK(MatrixMapPointsAffine, 64, 1024, 16384) {
+  auto count = static_cast<int>(state.arg());
+  auto src = MakeRandomPoints(count);
+  std::vector<Point> dst(src.size());
+  auto matrix = Matrix::MakeRotate(30.0f);
+  matrix.postScale(1.5f, 0.5f);
+  matrix.postTranslate(10.0f, 20.0f);
+  while (state.keepRunning()) {
+    matrix.mapPoints(dst.data(), src.data(), count);
+    DoNotOptimize(dst.data());
+  }
+  state.setItemsPerIteration(count);
+}
+
+TGFX_BENCHMARK(RectSetBounds, 4, 64, 1024, 16384) {
+  auto count = static_cast<int>(state.arg());
+  auto points = MakeRandomPoints(count);
+  Rect rect = {};
+  while (state.keepRunning()) {
+    rect.setBounds(points.data(), count);
+    DoNotOptimize(rect);
+  }
+  state.setItemsPerIteration(count);
+}
+}  // namespace tgfx
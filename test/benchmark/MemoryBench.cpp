@@ -0,0 +1,60 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <random>
+#include "Benchmark.h"
+#include "core/RectPackSkyline.h"
+#include "core/utils/BlockBuffer.h"
+
+namespace tgfx {
+TGFX_BENCHMARK(RectPackSkylineAddRect, 100, 1000, 10000) {
+  auto count = static_cast<size_t>(state.arg());
+  std::mt19937 random(7);
+  std::uniform_int_distribution<int> distribution(4, 64);
+  std::vector<std::pair<int, int>> sizes(count);
+  for (auto& size : sizes) {
+    size = {distribution(random), distribution(random)};
+  }
+  RectPackSkyline packer(2048, 2048);
+  while (state.keepRunning()) {
+    packer.reset();
+    Point location = {};
+    for (auto& size : sizes) {
+      if (!packer.addRect(size.first, size.second, location)) {
+        break;
+      }
+    }
+    DoNotOptimize(location);
+  }
+  state.setItemsPerIteration(state.arg());
+}
+
+TGFX_BENCHMARK(BlockBufferAllocate, 100, 1000, 10000) {
+  auto count = static_cast<size_t>(state.arg());
+  BlockBuffer buffer = {};
+  while (state.keepRunning()) {
+    for (size_t i = 0; i < count; i++) {
+      auto memory = buffer.allocate(16 + (i % 8) * 8);
+      DoNotOptimize(memory);
+    }
+    buffer.clear();
+  }
+  state.setItemsPerIteration(state.arg());
+}
+}  // namespace tgfx
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.h"
+#include "BenchUtils.h"
+#include "core/PathRasterizer.h"
+#include "core/PathTriangulator.h"
+#include "tgfx/core/Stroke.h"
+
+namespace tgfx {
+static constexpr int RasterSize = 512;
+
+TGFX_BENCHMARK(PathToAATriangles, 16, 256, 4096) {
+  auto path = MakeStarPath(state.arg());
+  auto clipBounds = Rect::MakeWH(RasterSize, RasterSize);
+  std::vector<float> vertices = {};
+  while (state.keepRunning()) {
+    vertices.clear();
+    auto count = PathTriangulator::ToAATriangles(path, clipBounds, &vertices);
+    DoNotOptimize(count);
+  }
+  state.setItemsPerIteration(state.arg() * 2);
+}
+
+TGFX_BENCHMARK(PathToTriangles, 16, 256, 4096) {
+  auto path = MakeStarPath(state.arg());
+  auto clipBounds = Rect::MakeWH(RasterSize, RasterSize);
+  std::vector<float> vertices = {};
+  while (state.keepRunning()) {
+    vertices.clear();
+    auto count = PathTriangulator::ToTriangles(path, clipBounds, &vertices);
+    DoNotOptimize(count);
+  }
+  state.setItemsPerIteration(state.arg() * 2);
+}
+
+TGFX_BENCHMARK(PathRasterizerReadPixels, 16, 256, 4096) {
+  auto path = MakeStarPath(state.arg());
+  auto rasterizer = PathRasterizer::MakeFrom(RasterSize, RasterSize, path, true);
+  if (rasterizer == nullptr) {
+    return;
+  }
+  auto info = ImageInfo::Make(RasterSize, RasterSize, ColorType::ALPHA_8);
+  std::vector<uint8_t> pixels(info.byteSize());
+  while (state.keepRunning()) {
+    auto success = rasterizer->readPixels(info, pixels.data());
+    DoNotOptimize(success);
+  }
+  state.setBytesPerIteration(static_cast<int64_t>(info.byteSize()));
+}
+
+TGFX_BENCHMARK(StrokeApplyToPath, 16, 256, 4096) {
+  auto path = MakeWavePath(state.arg());
+  Stroke stroke(4.0f, LineCap::Round, LineJoin::Round);
+  while (state.keepRunning()) {
+    auto strokedPath = path;
+    auto success = stroke.applyToPath(&strokedPath);
+    DoNotOptimize(success);
+  }
+  state.setItemsPerIteration(state.arg());
+}
+
+static void RunPathOp(BenchmarkState& state, PathOp op) {
+  auto path = MakeStarPath(state.arg());
+  auto other = MakeStarPath(state.arg());
+  other.transform(Matrix::MakeRotate(7.0f, RasterSize * 0.5f, RasterSize * 0.5f));
+  while (state.keepRunning()) {
+    auto result = path;
+    result.addPath(other, op);
+    DoNotOptimize(result);
+  }
+  state.setItemsPerIteration(state.arg() * 4);
+}
+
+TGFX_BENCHMARK(PathOpIntersect, 16, 256, 4096) {
+  RunPathOp(state, PathOp::Intersect);
+}
+
+TGFX_BENCHMARK(PathOpUnion, 16, 256, 4096) {
+  RunPathOp(state, PathOp::Union);
+}
+}  // namespace tgfx
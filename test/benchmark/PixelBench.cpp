@@ -0,0 +1,89 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.h"
+#include "tgfx/core/Pixmap.h"
+
+namespace tgfx {
+static std::vector<uint8_t> MakePixels(const ImageInfo& info) {
+  std::vector<uint8_t> pixels(info.byteSize());
+  for (size_t i = 0; i < pixels.size(); i++) {
+    pixels[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  return pixels;
+}
+
+static void RunReadPixels(BenchmarkState& state, const ImageInfo& srcInfo,
+                          const ImageInfo& dstInfo) {
+  auto srcPixels = MakePixels(srcInfo);
+  std::vector<uint8_t> dstPixels(dstInfo.byteSize());
+  Pixmap pixmap(srcInfo, srcPixels.data());
+  while (state.keepRunning()) {
+    auto success = pixmap.readPixels(dstInfo, dstPixels.data());
+    DoNotOptimize(success);
+  }
+  state.setBytesPerIteration(static_cast<int64_t>(srcInfo.byteSize()));
+}
+
+static ImageInfo MakeInfo(int64_t size, ColorType colorType, AlphaType alphaType) {
+  auto length = static_cast<int>(size);
+  return ImageInfo::Make(length, length, colorType, alphaType);
+}
+
+TGFX_BENCHMARK(PixmapCopyRGBA, 256, 1024, 2048) {
+  auto info = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  RunReadPixels(state, info, info);
+}
+
+TGFX_BENCHMARK(PixmapSwizzleRGBAToBGRA, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::BGRA_8888, AlphaType::Premultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+
+TGFX_BENCHMARK(PixmapPremultiply, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Unpremultiplied);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+
+TGFX_BENCHMARK(PixmapUnpremultiply, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::BGRA_8888, AlphaType::Unpremultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+
+TGFX_BENCHMARK(PixmapExtractAlpha, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::ALPHA_8, AlphaType::Premultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+
+TGFX_BENCHMARK(PixmapExpand565, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::RGB_565, AlphaType::Opaque);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::RGBA_8888, AlphaType::Premultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+
+TGFX_BENCHMARK(PixmapExpandGray, 256, 1024, 2048) {
+  auto srcInfo = MakeInfo(state.arg(), ColorType::Gray_8, AlphaType::Opaque);
+  auto dstInfo = MakeInfo(state.arg(), ColorType::BGRA_8888, AlphaType::Premultiplied);
+  RunReadPixels(state, srcInfo, dstInfo);
+}
+}  // namespace tgfx
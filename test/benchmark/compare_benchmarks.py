@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Compares two TGFXBenchmark result files and flags regressions.
+
+Usage:
+    compare_benchmarks.py <baseline.json> <current.json> [--threshold=0.10]
+
+A benchmark regresses when its median time per iteration grows by more than
+the threshold (10% by default). The script exits with status 1 if any
+benchmark regressed, which lets CI jobs fail on performance regressions.
+"""
+
+import json
+import sys
+
+
+def load_results(path):
+    with open(path, "r") as file:
+        data = json.load(file)
+    return {item["name"]: item for item in data.get("benchmarks", [])}
+
+
+def main(argv):
+    threshold = 0.10
+    paths = []
+    for arg in argv[1:]:
+        if arg.startswith("--threshold="):
+            threshold = float(arg.split("=", 1)[1])
+        else:
+            paths.append(arg)
+    if len(paths) != 2:
+        print(__doc__)
+        return 2
+    baseline = load_results(paths[0])
+    current = load_results(paths[1])
+    regressions = 0
+    print("%-48s %14s %14s %9s" % ("Benchmark", "Baseline(ns)", "Current(ns)", "Change"))
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline:
+            print("%-48s %14s %14.1f %9s" % (name, "-", current[name]["ns_per_iter"], "new"))
+            continue
+        if name not in current:
+            print("%-48s %14.1f %14s %9s" % (name, baseline[name]["ns_per_iter"], "-", "removed"))
+            continue
+        old_time = baseline[name]["ns_per_iter"]
+        new_time = current[name]["ns_per_iter"]
+        change = (new_time - old_time) / old_time if old_time > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -threshold:
+            flag = "  improved"
+        print("%-48s %14.1f %14.1f %+8.1f%%%s" % (name, old_time, new_time, change * 100, flag))
+    if regressions > 0:
+        print("\n%d benchmark(s) regressed by more than %.0f%%." % (regressions, threshold * 100))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,381 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <thread>
+#include "Scenes.h"
+#include "tgfx/core/Clock.h"
+#include "tgfx/core/Surface.h"
+#include "tgfx/core/Tracer.h"
+#include "tgfx/layers/DisplayList.h"
+#include "utils/DevicePool.h"
+
+namespace tgfx {
+/**
+ * A scripted sequence of viewport or content changes applied before each frame.
+ */
+enum class SceneScript { Pan, Zoom, Animate };
+
+struct SceneOptions {
+  std::vector<std::string> scenes = {};
+  std::vector<RenderMode> modes = {RenderMode::Direct, RenderMode::Partial, RenderMode::Tiled};
+  std::vector<SceneScript> scripts = {SceneScript::Pan, SceneScript::Zoom, SceneScript::Animate};
+  int frames = 120;
+  int width = 1024;
+  int height = 768;
+  std::string outputPath = {};
+  bool listOnly = false;
+};
+
+struct FrameStats {
+  int64_t updateBoundsTime = 0;
+  int64_t recordTime = 0;
+  int64_t flushTime = 0;
+  int64_t submitTime = 0;
+  size_t gpuMemory = 0;
+  FrameCounters counters = {};
+
+  int64_t totalTime() const {
+    return updateBoundsTime + recordTime + flushTime + submitTime;
+  }
+};
+
+static const char* RenderModeName(RenderMode mode) {
+  switch (mode) {
+    case RenderMode::Direct:
+      return "direct";
+    case RenderMode::Partial:
+      return "partial";
+    case RenderMode::Tiled:
+      return "tiled";
+  }
+  return "";
+}
+
+static const char* SceneScriptName(SceneScript script) {
+  switch (script) {
+    case SceneScript::Pan:
+      return "pan";
+    case SceneScript::Zoom:
+      return "zoom";
+    case SceneScript::Animate:
+      return "animate";
+  }
+  return "";
+}
+
+static std::vector<std::string> SplitList(const std::string& text) {
+  std::vector<std::string> result = {};
+  size_t start = 0;
+  while (start <= text.size()) {
+    auto end = text.find(',', start);
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+    if (end > start) {
+      result.push_back(text.substr(start, end - start));
+    }
+    start = end + 1;
+  }
+  return result;
+}
+
+template <typename T>
+static bool ParseEnumList(const std::string& text, const std::vector<T>& all,
+                          const char* (*nameOf)(T), std::vector<T>* result) {
+  result->clear();
+  for (auto& name : SplitList(text)) {
+    auto item =
+        std::find_if(all.begin(), all.end(), [&](T value) { return name == nameOf(value); });
+    if (item == all.end()) {
+      fprintf(stderr, "Unknown value: %s\n", name.c_str());
+      return false;
+    }
+    result->push_back(*item);
+  }
+  return !result->empty();
+}
+
+static bool ParseOptions(int argc, char* argv[], SceneOptions* options) {
+  auto allModes = options->modes;
+  auto allScripts = options->scripts;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    auto separator = arg.find('=');
+    auto key = arg.substr(0, separator);
+    auto value = separator == std::string::npos ? std::string() : arg.substr(separator + 1);
+    if (key == "--scene") {
+      options->scenes = SplitList(value);
+    } else if (key == "--mode") {
+      if (!ParseEnumList(value, allModes, RenderModeName, &options->modes)) {
+        return false;
+      }
+    } else if (key == "--script") {
+      if (!ParseEnumList(value, allScripts, SceneScriptName, &options->scripts)) {
+        return false;
+      }
+    } else if (key == "--frames") {
+      options->frames = std::max(1, atoi(value.c_str()));
+    } else if (key == "--width") {
+      options->width = std::max(1, atoi(value.c_str()));
+    } else if (key == "--height") {
+      options->height = std::max(1, atoi(value.c_str()));
+    } else if (key == "--out") {
+      options->outputPath = value;
+    } else if (key == "--list") {
+      options->listOnly = true;
+    } else {
+      fprintf(stderr,
+              "Usage: %s [--scene=a,b] [--mode=direct,partial,tiled] [--script=pan,zoom,animate]\n"
+              "          [--frames=N] [--width=W] [--height=H] [--out=result.json] [--list]\n",
+              argv[0]);
+      return false;
+    }
+  }
+  return true;
+}
+
+static void ApplyScript(SceneScript script, int frame, const SceneOptions& options,
+                        DisplayList* displayList) {
+  switch (script) {
+    case SceneScript::Pan: {
+      // Scrolls diagonally across the content and wraps around at the far edge.
+      auto viewportSize = static_cast<float>(std::max(options.width, options.height));
+      auto maxOffset = SceneContentSize - viewportSize;
+      auto offset = fmodf(static_cast<float>(frame) * 24.0f, std::max(maxOffset, 1.0f));
+      displayList->setContentOffset(-offset, -offset * 0.5f);
+      break;
+    }
+    case SceneScript::Zoom: {
+      // Pinches in and out around the center of the viewport.
+      auto phase = static_cast<float>(frame) * static_cast<float>(M_PI) * 2.0f / 60.0f;
+      auto zoomScale = 1.0f + 0.75f * sinf(phase);
+      auto centerX = static_cast<float>(options.width) * 0.5f;
+      auto centerY = static_cast<float>(options.height) * 0.5f;
+      displayList->setZoomScale(zoomScale);
+      displayList->setContentOffset(centerX * (1.0f - zoomScale), centerY * (1.0f - zoomScale));
+      break;
+    }
+    case SceneScript::Animate: {
+      // Rotates a small subset of the layers, producing scattered dirty regions every frame.
+      auto& children = displayList->root()->children();
+      for (size_t i = static_cast<size_t>(frame % 50); i < children.size(); i += 50) {
+        auto& layer = children[i];
+        auto bounds = layer->getBounds();
+        auto matrix = layer->matrix();
+        matrix.preRotate(3.0f, bounds.centerX(), bounds.centerY());
+        layer->setMatrix(matrix);
+      }
+      break;
+    }
+  }
+}
+
+static FrameCounters CollectFrameCounters(int64_t* lastFrameIndex) {
+  FrameCounters result = {};
+  for (auto& frame : Tracer::GetFrameCounters()) {
+    if (static_cast<int64_t>(frame.frameIndex) <= *lastFrameIndex) {
+      continue;
+    }
+    for (size_t i = 0; i < result.values.size(); i++) {
+      result.values[i] += frame.values[i];
+    }
+    *lastFrameIndex = static_cast<int64_t>(frame.frameIndex);
+  }
+  return result;
+}
+
+static std::vector<FrameStats> RunScene(Context* context, const SceneInfo& scene, RenderMode mode,
+                                        SceneScript script, const SceneOptions& options) {
+  auto surface = Surface::Make(context, options.width, options.height);
+  if (surface == nullptr) {
+    return {};
+  }
+  DisplayList displayList = {};
+  displayList.setRenderMode(mode);
+  displayList.setAllowZoomBlur(true);
+  displayList.setMaxTileCount(512);
+  scene.build(displayList.root());
+  context->purgeResourcesNotUsedSince(std::chrono::steady_clock::now());
+  Tracer::Start();
+  int64_t lastFrameIndex = -1;
+  std::vector<FrameStats> frames = {};
+  frames.reserve(static_cast<size_t>(options.frames));
+  for (int frame = 0; frame < options.frames; frame++) {
+    ApplyScript(script, frame, options, &displayList);
+    FrameStats stats = {};
+    auto startTime = Clock::Now();
+    // The dirty regions collected here are kept by the root layer and consumed by render().
+    displayList.root()->updateRenderBounds();
+    auto boundsTime = Clock::Now();
+    displayList.render(surface.get());
+    auto recordTime = Clock::Now();
+    context->flush();
+    auto flushTime = Clock::Now();
+    context->submit(true);
+    auto submitTime = Clock::Now();
+    stats.updateBoundsTime = boundsTime - startTime;
+    stats.recordTime = recordTime - boundsTime;
+    stats.flushTime = flushTime - recordTime;
+    stats.submitTime = submitTime - flushTime;
+    stats.gpuMemory = context->memoryUsage();
+    Tracer::MarkFrame();
+    stats.counters = CollectFrameCounters(&lastFrameIndex);
+    frames.push_back(stats);
+  }
+  Tracer::Stop();
+  return frames;
+}
+
+static int64_t Percentile(std::vector<int64_t> values, double percent) {
+  if (values.empty()) {
+    return 0;
+  }
+  std::sort(values.begin(), values.end());
+  auto index = static_cast<size_t>(percent * static_cast<double>(values.size() - 1) + 0.5);
+  return values[index];
+}
+
+static nlohmann::json MakeRunJson(const SceneInfo& scene, RenderMode mode, SceneScript script,
+                                  const std::vector<FrameStats>& frames) {
+  static const char* counterNames[] = {
+      "draw_calls",   "draw_ops",     "texture_uploads",  "buffer_uploads", "upload_bytes",
+      "cache_hits",   "cache_misses", "program_compiles", "tile_draws",     "tile_refinements"};
+  static_assert(sizeof(counterNames) / sizeof(counterNames[0]) ==
+                    static_cast<size_t>(TraceCounter::Count),
+                "counterNames must match TraceCounter");
+  auto frameArray = nlohmann::json::array();
+  std::vector<int64_t> totalTimes = {};
+  for (size_t i = 0; i < frames.size(); i++) {
+    auto& stats = frames[i];
+    nlohmann::json item = {{"index", i},
+                           {"update_bounds_us", stats.updateBoundsTime},
+                           {"record_us", stats.recordTime},
+                           {"flush_us", stats.flushTime},
+                           {"submit_us", stats.submitTime},
+                           {"total_us", stats.totalTime()},
+                           {"gpu_memory_bytes", stats.gpuMemory}};
+    for (size_t j = 0; j < stats.counters.values.size(); j++) {
+      item[counterNames[j]] = stats.counters.values[j];
+    }
+    frameArray.push_back(std::move(item));
+    totalTimes.push_back(stats.totalTime());
+  }
+  nlohmann::json summary = {{"p50_us", Percentile(totalTimes, 0.5)},
+                            {"p95_us", Percentile(totalTimes, 0.95)},
+                            {"max_us", Percentile(totalTimes, 1.0)}};
+  return {{"scene", scene.name},
+          {"mode", RenderModeName(mode)},
+          {"script", SceneScriptName(script)},
+          {"summary", summary},
+          {"frames", frameArray}};
+}
+
+static std::string CurrentDate() {
+  auto now = std::time(nullptr);
+  char buffer[64] = {};
+  std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  return buffer;
+}
+
+static int RunSceneBenchmark(int argc, char* argv[]) {
+  SceneOptions options = {};
+  if (!ParseOptions(argc, argv, &options)) {
+    return 1;
+  }
+  std::vector<const SceneInfo*> scenes = {};
+  for (auto& scene : GetScenes()) {
+    if (options.scenes.empty() ||
+        std::find(options.scenes.begin(), options.scenes.end(), scene.name) !=
+            options.scenes.end()) {
+      scenes.push_back(&scene);
+    }
+  }
+  if (options.listOnly) {
+    for (auto scene : scenes) {
+      printf("%-10s %s\n", scene->name.c_str(), scene->description.c_str());
+    }
+    return 0;
+  }
+  auto device = DevicePool::Make();
+  if (device == nullptr) {
+    fprintf(stderr, "Failed to create a GPU device.\n");
+    return 1;
+  }
+  auto context = device->lockContext();
+  if (context == nullptr) {
+    fprintf(stderr, "Failed to lock the GPU context.\n");
+    return 1;
+  }
+  auto runs = nlohmann::json::array();
+  printf("%-10s %-8s %-8s %10s %10s %10s %12s\n", "Scene", "Mode", "Script", "p50(us)",
+         "p95(us)", "DrawCalls", "GPUMem(MB)");
+  for (auto scene : scenes) {
+    for (auto mode : options.modes) {
+      for (auto script : options.scripts) {
+        auto frames = RunScene(context, *scene, mode, script, options);
+        if (frames.empty()) {
+          fprintf(stderr, "Failed to run scene: %s\n", scene->name.c_str());
+          continue;
+        }
+        auto run = MakeRunJson(*scene, mode, script, frames);
+        uint64_t drawCalls = 0;
+        for (auto& stats : frames) {
+          drawCalls += stats.counters[TraceCounter::DrawCalls];
+        }
+        printf("%-10s %-8s %-8s %10lld %10lld %10.1f %12.1f\n", scene->name.c_str(),
+               RenderModeName(mode), SceneScriptName(script),
+               static_cast<long long>(run["summary"]["p50_us"].get<int64_t>()),
+               static_cast<long long>(run["summary"]["p95_us"].get<int64_t>()),
+               static_cast<double>(drawCalls) / static_cast<double>(frames.size()),
+               static_cast<double>(frames.back().gpuMemory) / (1024.0 * 1024.0));
+        runs.push_back(std::move(run));
+      }
+    }
+  }
+  device->unlock();
+  if (!options.outputPath.empty()) {
+    nlohmann::json result = {{"context",
+                              {{"date", CurrentDate()},
+                               {"num_cpus", std::thread::hardware_concurrency()},
+                               {"width", options.width},
+                               {"height", options.height},
+                               {"frames", options.frames}}},
+                             {"runs", runs}};
+    std::ofstream stream(options.outputPath);
+    if (!stream) {
+      fprintf(stderr, "Failed to write the result file: %s\n", options.outputPath.c_str());
+      return 1;
+    }
+    stream << result.dump(2) << std::endl;
+  }
+  return 0;
+}
+}  // namespace tgfx
+
+int main(int argc, char* argv[]) {
+  return tgfx::RunSceneBenchmark(argc, argv);
+}
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Scenes.h"
+#include <random>
+#include "BenchUtils.h"
+#include "tgfx/layers/ImageLayer.h"
+#include "tgfx/layers/ShapeLayer.h"
+#include "tgfx/layers/SolidColor.h"
+#include "tgfx/layers/SolidLayer.h"
+#include "tgfx/layers/TextLayer.h"
+#include "tgfx/layers/filters/BlurFilter.h"
+#include "tgfx/layers/layerstyles/DropShadowStyle.h"
+#include "utils/ProjectPath.h"
+
+namespace tgfx {
+static Color RandomColor(std::mt19937& random) {
+  std::uniform_real_distribution<float> distribution(0.1f, 0.9f);
+  return {distribution(random), distribution(random), distribution(random), 1.0f};
+}
+
+static void BuildShapeScene(Layer* root) {
+  static constexpr int GridCount = 80;
+  static constexpr float CellSize = SceneContentSize / GridCount;
+  std::mt19937 random(1);
+  for (int y = 0; y < GridCount; y++) {
+    for (int x = 0; x < GridCount; x++) {
+      auto index = y * GridCount + x;
+      auto rect = Rect::MakeWH(CellSize * 0.8f, CellSize * 0.8f);
+      Path path = {};
+      switch (index % 4) {
+        case 0:
+          path.addRect(rect);
+          break;
+        case 1:
+          path.addOval(rect);
+          break;
+        case 2:
+          path.addRoundRect(rect, CellSize * 0.2f, CellSize * 0.2f);
+          break;
+        default:
+          path = MakeStarPath(5 + index % 7, rect.width());
+          break;
+      }
+      auto layer = ShapeLayer::Make();
+      layer->setPath(path);
+      layer->setFillStyle(SolidColor::Make(RandomColor(random)));
+      if (index % 3 == 0) {
+        layer->setStrokeStyle(SolidColor::Make(Color::Black()));
+        layer->setLineWidth(2.0f);
+      }
+      layer->setPosition({static_cast<float>(x) * CellSize, static_cast<float>(y) * CellSize});
+      root->addChild(layer);
+    }
+  }
+}
+
+static void BuildTextScene(Layer* root) {
+  static constexpr int ColumnCount = 8;
+  static constexpr int RowCount = 40;
+  static constexpr float ColumnWidth = SceneContentSize / ColumnCount;
+  static constexpr float RowHeight = SceneContentSize / RowCount;
+  auto typeface =
+      Typeface::MakeFromPath(ProjectPath::Absolute("resources/font/NotoSansSC-Regular.otf"));
+  const std::string paragraphs[] = {
+      "The quick brown fox jumps over the lazy dog.\nPack my box with five dozen liquor jugs.",
+      "Sphinx of black quartz, judge my vow.\nHow vexingly quick daft zebras jump!",
+      "天地玄黄，宇宙洪荒。\n日月盈昃，辰宿列张。",
+      "0123456789 +-*/=()[]{}<>\n!@#$%^&*_~;:'\",.?"};
+  std::mt19937 random(2);
+  for (int y = 0; y < RowCount; y++) {
+    for (int x = 0; x < ColumnCount; x++) {
+      auto index = y * ColumnCount + x;
+      auto layer = TextLayer::Make();
+      layer->setText(paragraphs[index % 4]);
+      layer->setFont(Font(typeface, 12.0f + static_cast<float>(index % 4) * 2.0f));
+      layer->setTextColor(RandomColor(random));
+      layer->setWidth(ColumnWidth - 16.0f);
+      layer->setPosition({static_cast<float>(x) * ColumnWidth, static_cast<float>(y) * RowHeight});
+      root->addChild(layer);
+    }
+  }
+}
+
+static void BuildImageScene(Layer* root) {
+  static constexpr int GridCount = 24;
+  static constexpr float CellSize = SceneContentSize / GridCount;
+  auto image = Image::MakeFromFile(ProjectPath::Absolute("resources/apitest/imageReplacement.png"));
+  if (image == nullptr) {
+    return;
+  }
+  auto scale = CellSize * 0.9f / static_cast<float>(std::max(image->width(), image->height()));
+  for (int y = 0; y < GridCount; y++) {
+    for (int x = 0; x < GridCount; x++) {
+      auto layer = ImageLayer::Make();
+      layer->setImage(image);
+      auto matrix = Matrix::MakeScale(scale);
+      matrix.postTranslate(static_cast<float>(x) * CellSize, static_cast<float>(y) * CellSize);
+      layer->setMatrix(matrix);
+      root->addChild(layer);
+    }
+  }
+}
+
+static void BuildCardScene(Layer* root) {
+  static constexpr int GridCount = 16;
+  static constexpr float CellSize = SceneContentSize / GridCount;
+  std::mt19937 random(3);
+  for (int y = 0; y < GridCount; y++) {
+    for (int x = 0; x < GridCount; x++) {
+      auto index = y * GridCount + x;
+      auto card = SolidLayer::Make();
+      card->setWidth(CellSize * 0.7f);
+      card->setHeight(CellSize * 0.7f);
+      card->setRadiusX(16.0f);
+      card->setRadiusY(16.0f);
+      card->setColor(RandomColor(random));
+      card->setLayerStyles({DropShadowStyle::Make(0, 8, 12, 12, Color::FromRGBA(0, 0, 0, 96))});
+      if (index % 4 == 0) {
+        card->setFilters({BlurFilter::Make(4, 4)});
+      }
+      card->setPosition({static_cast<float>(x) * CellSize + CellSize * 0.15f,
+                         static_cast<float>(y) * CellSize + CellSize * 0.15f});
+      root->addChild(card);
+    }
+  }
+}
+
+const std::vector<SceneInfo>& GetScenes() {
+  static const std::vector<SceneInfo> scenes = {
+      {"shapes", "6400 filled and stroked ShapeLayers", BuildShapeScene},
+      {"text", "320 multi-line TextLayers", BuildTextScene},
+      {"images", "A grid of 576 ImageLayers sharing one image", BuildImageScene},
+      {"cards", "256 rounded cards with drop shadows, a quarter of them blurred", BuildCardScene}};
+  return scenes;
+}
+}  // namespace tgfx
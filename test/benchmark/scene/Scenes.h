@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "tgfx/layers/Layer.h"
+
+namespace tgfx {
+/**
+ * The width and height of the content area covered by every benchmark scene.
+ */
+static constexpr float SceneContentSize = 4096.0f;
+
+/**
+ * Adds the layers of a benchmark scene to the given root layer.
+ */
+using SceneBuilder = void (*)(Layer* root);
+
+/**
+ * Describes a layer-tree workload used by the scene benchmark.
+ */
+struct SceneInfo {
+  std::string name;
+  std::string description;
+  SceneBuilder build = nullptr;
+};
+
+/**
+ * Returns all scenes known to the scene benchmark, in a stable order. The scenes are generated
+ * from fixed seeds, so every run renders exactly the same content.
+ */
+const std::vector<SceneInfo>& GetScenes();
+}  // namespace tgfx
@@ -16,6 +16,7 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include "core/GlyphRunList.h"
 #include "core/PathRef.h"
 #include "core/Records.h"
 #include "core/images/ResourceImage.h"
@@ -23,6 +24,7 @@
 #include "core/images/TransformImage.h"
 #include "core/shapes/AppendShape.h"
 #include "gpu/DrawingManager.h"
+#include "gpu/ProxyProvider.h"
 #include "gpu/RenderContext.h"
 #include "gpu/Texture.h"
 #include "gpu/opengl/GLCaps.h"
@@ -2623,4 +2625,168 @@ TGFX_TEST(CanvasTest, RotateImageRect) {
   context->flush();
   EXPECT_TRUE(Baseline::Compare(surface, "CanvasTest/RotateImageRect"));
 }
+
+TGFX_TEST(CanvasTest, TiledLargeShape) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  // A polygon with many verbs, so that it can't be drawn as an oval or triangulated as a whole.
+  Path path = {};
+  for (int i = 0; i < 360; i++) {
+    auto angle = static_cast<float>(i) * static_cast<float>(M_PI) / 180.0f;
+    auto x = 3000.0f + 3000.0f * cosf(angle);
+    auto y = 3000.0f + 3000.0f * sinf(angle);
+    if (i == 0) {
+      path.moveTo(x, y);
+    } else {
+      path.lineTo(x, y);
+    }
+  }
+  path.close();
+  auto clipBounds = Rect::MakeWH(400, 300);
+  auto proxyProvider = context->proxyProvider();
+  auto shape = Shape::ApplyMatrix(Shape::MakeFrom(path), Matrix::MakeTrans(-900, -900));
+  auto shapeProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  // Only the 2x2 tiles covering (900, 900, 1300, 1200) in the shape's space are created.
+  ASSERT_EQ(shapeProxies.size(), 4u);
+  for (auto& shapeProxy : shapeProxies) {
+    auto textureProxy = shapeProxy->getTextureProxy();
+    ASSERT_TRUE(textureProxy != nullptr);
+    EXPECT_EQ(textureProxy->width(), ShapeTileSize);
+    EXPECT_EQ(textureProxy->height(), ShapeTileSize);
+  }
+  // Panning within the same tiles reuses the existing tiles.
+  shape = Shape::ApplyMatrix(Shape::MakeFrom(path), Matrix::MakeTrans(-950, -920));
+  auto pannedProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  ASSERT_EQ(pannedProxies.size(), 4u);
+  for (size_t i = 0; i < shapeProxies.size(); i++) {
+    EXPECT_EQ(pannedProxies[i]->getTextureProxy(), shapeProxies[i]->getTextureProxy());
+  }
+  auto surface = Surface::Make(context, 400, 300);
+  auto canvas = surface->getCanvas();
+  canvas->translate(-950, -920);
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawPath(path, paint);
+  Bitmap bitmap(400, 300, false, false);
+  Pixmap pixmap(bitmap);
+  ASSERT_TRUE(surface->readPixels(pixmap.info(), pixmap.writablePixels()));
+  EXPECT_EQ(pixmap.getColor(200, 150), Color::Red());
+  EXPECT_EQ(pixmap.getColor(0, 0), Color::Red());
+}
+
+TGFX_TEST(CanvasTest, ShapeScaleFallback) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  Path path = {};
+  for (int i = 0; i < 200; i++) {
+    auto angle = static_cast<float>(i) * static_cast<float>(M_PI) / 100.0f;
+    auto radius = i % 2 == 0 ? 100.0f : 80.0f;
+    if (i == 0) {
+      path.moveTo(100.0f + radius * cosf(angle), 100.0f + radius * sinf(angle));
+    } else {
+      path.lineTo(100.0f + radius * cosf(angle), 100.0f + radius * sinf(angle));
+    }
+  }
+  path.close();
+  auto clipBounds = Rect::MakeWH(400, 400);
+  auto proxyProvider = context->proxyProvider();
+  auto shape = Shape::ApplyMatrix(Shape::MakeFrom(path), Matrix::MakeScale(1.0f));
+  auto baseProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  ASSERT_EQ(baseProxies.size(), 1u);
+  shape = Shape::ApplyMatrix(Shape::MakeFrom(path), Matrix::MakeScale(1.5f));
+  auto exactProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  ASSERT_EQ(exactProxies.size(), 1u);
+  context->flush();
+
+  // While zooming, a new scale is drawn from the closest cached scale.
+  proxyProvider->setShapeScaleFallback(true);
+  shape = Shape::ApplyMatrix(Shape::MakeFrom(path), Matrix::MakeScale(1.3f));
+  auto zoomProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  ASSERT_EQ(zoomProxies.size(), 1u);
+  EXPECT_EQ(zoomProxies[0]->getTextureProxy(), exactProxies[0]->getTextureProxy());
+  auto drawingScale = zoomProxies[0]->getDrawingMatrix().getScaleX();
+  EXPECT_NEAR(drawingScale, 1.3f / 1.5f, 0.001f);
+  proxyProvider->setShapeScaleFallback(false);
+
+  // Once the zooming stops, the shape is rasterized at the exact scale.
+  auto restProxies = proxyProvider->createGPUShapeProxies(shape, AAType::Coverage, clipBounds);
+  ASSERT_EQ(restProxies.size(), 1u);
+  EXPECT_NE(restProxies[0]->getTextureProxy(), exactProxies[0]->getTextureProxy());
+  EXPECT_NEAR(restProxies[0]->getDrawingMatrix().getScaleX(), 1.0f, 0.001f);
+  context->flush();
+}
+
+TGFX_TEST(CanvasTest, PackedRectSubset) {
+  BlockBuffer buffer = {};
+  auto uvRect = Rect::MakeXYWH(10.f, 20.f, 30.f, 40.f);
+  std::vector<PlacementPtr<RectRecord>> rects = {};
+  rects.push_back(
+      buffer.make<RectRecord>(Rect::MakeWH(30, 40), Matrix::I(), Color::White(), &uvRect));
+  auto provider =
+      RectsVertexProvider::MakeFrom(&buffer, std::move(rects), AAType::Coverage, false, false,
+                                    RectsVertexProvider::UVSubsetMode::RoundOutAndSubset);
+  ASSERT_TRUE(provider != nullptr);
+  EXPECT_TRUE(provider->hasPackedSubset());
+  // 8 vertices of position, coverage and a subset packed into two floats.
+  EXPECT_EQ(provider->vertexCount(), 8u * 5u);
+  std::vector<float> vertices(provider->vertexCount());
+  provider->getVertices(vertices.data());
+  uint16_t subset[4] = {};
+  memcpy(subset, vertices.data() + 3, sizeof(subset));
+  EXPECT_EQ(subset[0], 21);
+  EXPECT_EQ(subset[1], 41);
+  EXPECT_EQ(subset[2], 79);
+  EXPECT_EQ(subset[3], 119);
+
+  uvRect = Rect::MakeXYWH(10.3f, 20.f, 30.f, 40.f);
+  rects.clear();
+  rects.push_back(
+      buffer.make<RectRecord>(Rect::MakeWH(30, 40), Matrix::I(), Color::White(), &uvRect));
+  provider = RectsVertexProvider::MakeFrom(&buffer, std::move(rects), AAType::Coverage, false,
+                                           false, RectsVertexProvider::UVSubsetMode::SubsetOnly);
+  ASSERT_TRUE(provider != nullptr);
+  EXPECT_FALSE(provider->hasPackedSubset());
+  EXPECT_EQ(provider->vertexCount(), 8u * 7u);
+  provider = nullptr;
+  buffer.clear();
+}
+
+TGFX_TEST(CanvasTest, DirectMaskCache) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 300, 200);
+  auto canvas = surface->getCanvas();
+  auto typeface =
+      Typeface::MakeFromPath(ProjectPath::Absolute("resources/font/NotoSerifSC-Regular.otf"));
+  ASSERT_TRUE(typeface != nullptr);
+  Font font(typeface, 30.f);
+  auto textBlob = TextBlob::MakeFrom("Hello TGFX", font);
+  ASSERT_TRUE(textBlob != nullptr);
+  auto glyphRunList = GlyphRunList::Unwrap(textBlob.get())->front();
+  EXPECT_TRUE(glyphRunList->getDirectMaskCache() == nullptr);
+  Paint paint = {};
+  canvas->drawTextBlob(textBlob, 10, 50, paint);
+  context->flushAndSubmit();
+  auto cache = glyphRunList->getDirectMaskCache();
+  ASSERT_TRUE(cache != nullptr);
+  ASSERT_EQ(cache->runs.size(), 1u);
+  EXPECT_FALSE(cache->runs[0].quads.empty());
+  EXPECT_FALSE(cache->runs[0].plots.empty());
+  EXPECT_TRUE(cache->runs[0].rejectedGlyphRun.glyphs.empty());
+
+  // Redrawing the same text at a different position reuses the resolved quads.
+  canvas->drawTextBlob(textBlob, 10, 100, paint);
+  context->flushAndSubmit();
+  EXPECT_EQ(glyphRunList->getDirectMaskCache(), cache);
+
+  // A new scale needs different glyph cells.
+  canvas->scale(2.0f, 2.0f);
+  canvas->drawTextBlob(textBlob, 10, 70, paint);
+  context->flushAndSubmit();
+  EXPECT_NE(glyphRunList->getDirectMaskCache(), cache);
+}
+
 }  // namespace tgfx
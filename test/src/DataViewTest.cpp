@@ -135,4 +135,40 @@ TGFX_TEST(DataViewTest, FileWriteStream) {
   std::filesystem::remove(path);
 }
 
+TGFX_TEST(DataViewTest, MappedFile) {
+  auto path = ProjectPath::Absolute("test/out/MappedFile.bin");
+  std::filesystem::path filePath = path;
+  std::filesystem::create_directories(filePath.parent_path());
+
+  Buffer content(100 * 1024);
+  for (size_t i = 0; i < content.size(); i++) {
+    content.bytes()[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  auto writeStream = WriteStream::MakeFromFile(path);
+  ASSERT_TRUE(writeStream != nullptr);
+  writeStream->write(content.data(), content.size());
+  writeStream->flush();
+  writeStream = nullptr;
+
+  auto data = Data::MakeFromFile(path);
+  ASSERT_TRUE(data != nullptr);
+  ASSERT_EQ(data->size(), content.size());
+  EXPECT_EQ(memcmp(data->data(), content.data(), content.size()), 0);
+
+  auto readStream = Stream::MakeFromFile(path);
+  ASSERT_TRUE(readStream != nullptr);
+  EXPECT_EQ(readStream->size(), content.size());
+  auto memoryBase = static_cast<const uint8_t*>(readStream->getMemoryBase());
+  ASSERT_TRUE(memoryBase != nullptr);
+  EXPECT_EQ(memcmp(memoryBase, content.data(), content.size()), 0);
+  EXPECT_TRUE(readStream->seek(content.size() - 4));
+  uint8_t tail[8] = {};
+  EXPECT_EQ(readStream->read(tail, sizeof(tail)), 4U);
+  EXPECT_EQ(memcmp(tail, content.bytes() + content.size() - 4, 4), 0);
+  readStream = nullptr;
+  data = nullptr;
+
+  std::filesystem::remove(path);
+}
+
 }  // namespace tgfx
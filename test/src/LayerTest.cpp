@@ -16,19 +16,29 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <condition_variable>
+#include <deque>
 #include <math.h>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "core/filters/BlurImageFilter.h"
 #include "core/shaders/GradientShader.h"
 #include "gpu/proxies/RenderTargetProxy.h"
+#include "layers/DrawArgs.h"
+#include "layers/EffectCache.h"
 #include "layers/RootLayer.h"
+#include "layers/TileCache.h"
+#include "layers/contents/LayerContent.h"
 #include "layers/contents/RasterizedContent.h"
 #include "tgfx/core/PathEffect.h"
+#include "tgfx/core/Recorder.h"
 #include "tgfx/layers/DisplayList.h"
 #include "tgfx/layers/Gradient.h"
 #include "tgfx/layers/ImageLayer.h"
 #include "tgfx/layers/ImagePattern.h"
 #include "tgfx/layers/Layer.h"
+#include "tgfx/layers/LayerRecorder.h"
 #include "tgfx/layers/ShapeLayer.h"
 #include "tgfx/layers/SolidLayer.h"
 #include "tgfx/layers/TextLayer.h"
@@ -2955,4 +2965,774 @@ TGFX_TEST(LayerTest, PartialInnerShadow) {
   displayList.render(surface.get());
   EXPECT_TRUE(Baseline::Compare(surface, "LayerTest/PartialInnerShadow"));
 }
+
+TGFX_TEST(LayerTest, PartialScroll) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto makeContent = []() {
+    auto layer = ShapeLayer::Make();
+    Path path = {};
+    path.addRect(Rect::MakeWH(400, 400));
+    layer->setPath(path);
+    layer->setFillStyle(
+        Gradient::MakeRadial({200, 200}, 200, {Color::Red(), Color::Green(), Color::Blue()}));
+    auto solidLayer = SolidLayer::Make();
+    solidLayer->setColor(Color::FromRGBA(255, 255, 0, 128));
+    solidLayer->setWidth(100);
+    solidLayer->setHeight(60);
+    solidLayer->setMatrix(Matrix::MakeTrans(120, 150));
+    layer->addChild(solidLayer);
+    return layer;
+  };
+  DisplayList partialList;
+  partialList.setRenderMode(RenderMode::Partial);
+  partialList.root()->addChild(makeContent());
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  directList.root()->addChild(makeContent());
+  auto partialSurface = Surface::Make(context, 200, 200);
+  auto directSurface = Surface::Make(context, 200, 200);
+  partialList.render(partialSurface.get());
+
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> partialPixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+  std::vector<Point> offsets = {{-30, 0}, {-30, -45}, {10, -20}, {10.5f, -20}};
+  for (auto& offset : offsets) {
+    partialList.setContentOffset(offset.x, offset.y);
+    directList.setContentOffset(offset.x, offset.y);
+    partialList.render(partialSurface.get());
+    directList.render(directSurface.get());
+    ASSERT_TRUE(partialSurface->readPixels(info, partialPixels.data()));
+    ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+    EXPECT_TRUE(partialPixels == directPixels);
+  }
+}
+
+TGFX_TEST(LayerTest, DirtyRegions) {
+  auto root = RootLayer::Make();
+  root->invalidateRect(Rect::MakeXYWH(0, 0, 10, 10));
+  root->invalidateRect(Rect::MakeXYWH(990, 990, 10, 10));
+  root->invalidateRect(Rect::MakeXYWH(2, 2, 5, 5));
+  auto dirtyRegions = root->updateDirtyRegions();
+  ASSERT_EQ(dirtyRegions.size(), 2u);
+  EXPECT_EQ(dirtyRegions[0], Rect::MakeXYWH(0, 0, 10, 10));
+  EXPECT_EQ(dirtyRegions[1], Rect::MakeXYWH(990, 990, 10, 10));
+
+  root->invalidateRect(Rect::MakeXYWH(0, 0, 10, 10));
+  root->invalidateRect(Rect::MakeXYWH(10, 0, 10, 10));
+  dirtyRegions = root->updateDirtyRegions();
+  ASSERT_EQ(dirtyRegions.size(), 1u);
+  EXPECT_EQ(dirtyRegions[0], Rect::MakeXYWH(0, 0, 20, 10));
+
+  for (int i = 0; i < 40; i++) {
+    root->invalidateRect(Rect::MakeXYWH(i * 100, i * 100, 10, 10));
+  }
+  dirtyRegions = root->updateDirtyRegions();
+  EXPECT_LE(dirtyRegions.size(), MAX_DIRTY_REGIONS);
+  auto bounds = Rect::MakeEmpty();
+  for (auto& rect : dirtyRegions) {
+    bounds.join(rect);
+  }
+  EXPECT_EQ(bounds, Rect::MakeXYWH(0, 0, 3910, 3910));
+  EXPECT_FALSE(root->hasDirtyRegions());
+
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  DisplayList partialList;
+  partialList.setRenderMode(RenderMode::Partial);
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  std::vector<std::shared_ptr<SolidLayer>> partialLayers = {};
+  std::vector<std::shared_ptr<SolidLayer>> directLayers = {};
+  for (int i = 0; i < 6; i++) {
+    auto matrix = Matrix::MakeTrans(static_cast<float>(i * 35), static_cast<float>(i * 30));
+    auto partialLayer = SolidLayer::Make();
+    partialLayer->setWidth(20);
+    partialLayer->setHeight(20);
+    partialLayer->setColor(Color::Red());
+    partialLayer->setMatrix(matrix);
+    partialList.root()->addChild(partialLayer);
+    partialLayers.push_back(partialLayer);
+    auto directLayer = SolidLayer::Make();
+    directLayer->setWidth(20);
+    directLayer->setHeight(20);
+    directLayer->setColor(Color::Red());
+    directLayer->setMatrix(matrix);
+    directList.root()->addChild(directLayer);
+    directLayers.push_back(directLayer);
+  }
+  auto partialSurface = Surface::Make(context, 200, 200);
+  auto directSurface = Surface::Make(context, 200, 200);
+  partialList.render(partialSurface.get());
+  for (size_t i = 0; i < partialLayers.size(); i += 2) {
+    partialLayers[i]->setColor(Color::Blue());
+    directLayers[i]->setColor(Color::Blue());
+  }
+  partialList.render(partialSurface.get());
+  directList.render(directSurface.get());
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> partialPixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+  ASSERT_TRUE(partialSurface->readPixels(info, partialPixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(partialPixels == directPixels);
+}
+
+TGFX_TEST(LayerTest, BufferAgeRender) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto makeLayer = [](DisplayList* displayList) {
+    auto layer = SolidLayer::Make();
+    layer->setWidth(20);
+    layer->setHeight(20);
+    layer->setColor(Color::Red());
+    layer->setMatrix(Matrix::MakeTrans(30, 40));
+    auto background = SolidLayer::Make();
+    background->setWidth(200);
+    background->setHeight(200);
+    background->setColor(Color::Green());
+    displayList->root()->addChild(background);
+    displayList->root()->addChild(layer);
+    return layer;
+  };
+  DisplayList displayList;
+  displayList.setRenderMode(RenderMode::Partial);
+  auto layer = makeLayer(&displayList);
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  auto directLayer = makeLayer(&directList);
+  auto surface = Surface::Make(context, 200, 200);
+  auto directSurface = Surface::Make(context, 200, 200);
+  auto surfaceRect = Rect::MakeWH(200, 200);
+  auto damageRects = displayList.render(surface.get(), true, 0);
+  ASSERT_EQ(damageRects.size(), 1u);
+  EXPECT_EQ(damageRects[0], surfaceRect);
+
+  layer->setColor(Color::Blue());
+  directLayer->setColor(Color::Blue());
+  damageRects = displayList.render(surface.get(), true, 1);
+  ASSERT_EQ(damageRects.size(), 1u);
+  EXPECT_EQ(damageRects[0], Rect::MakeXYWH(29, 39, 22, 22));
+  directList.render(directSurface.get());
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> pixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+
+  // An older back buffer also misses the changes presented in the previous frames.
+  layer->setMatrix(Matrix::MakeTrans(130, 140));
+  directLayer->setMatrix(Matrix::MakeTrans(130, 140));
+  damageRects = displayList.render(surface.get(), true, 2);
+  auto bounds = Rect::MakeEmpty();
+  for (auto& rect : damageRects) {
+    bounds.join(rect);
+  }
+  EXPECT_EQ(bounds, Rect::MakeLTRB(29, 39, 151, 161));
+
+  // The damage history does not reach back far enough, so the whole surface is redrawn.
+  damageRects = displayList.render(surface.get(), true, 5);
+  ASSERT_EQ(damageRects.size(), 1u);
+  EXPECT_EQ(damageRects[0], surfaceRect);
+  directList.render(directSurface.get());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+}
+
+TGFX_TEST(LayerTest, PaintOnlyChange) {
+  auto shapeLayer = ShapeLayer::Make();
+  Path path = {};
+  path.addRoundRect(Rect::MakeWH(100, 80), 10, 10);
+  shapeLayer->setPath(path);
+  auto fillColor = SolidColor::Make(Color::Red());
+  auto strokeColor = SolidColor::Make(Color::Blue());
+  shapeLayer->setFillStyle(fillColor);
+  shapeLayer->setStrokeStyle(strokeColor);
+  shapeLayer->setLineWidth(4);
+  shapeLayer->setLineDashPattern({5, 5});
+  ASSERT_TRUE(shapeLayer->getContent() != nullptr);
+  auto strokeShape = shapeLayer->cachedStrokeShape;
+  ASSERT_TRUE(strokeShape != nullptr);
+  fillColor->setColor(Color::Green());
+  strokeColor->setColor(Color::White());
+  EXPECT_TRUE(shapeLayer->bitFields.dirtyContent);
+  ASSERT_TRUE(shapeLayer->getContent() != nullptr);
+  EXPECT_EQ(shapeLayer->cachedStrokeShape, strokeShape);
+  shapeLayer->setLineWidth(6);
+  EXPECT_TRUE(shapeLayer->cachedStrokeShape == nullptr);
+  ASSERT_TRUE(shapeLayer->getContent() != nullptr);
+  EXPECT_NE(shapeLayer->cachedStrokeShape, strokeShape);
+
+  auto textLayer = TextLayer::Make();
+  auto typeface = MakeTypeface("resources/font/NotoSansSC-Regular.otf");
+  textLayer->setFont(Font(typeface, 20));
+  textLayer->setText("Hello TGFX");
+  ASSERT_TRUE(textLayer->getContent() != nullptr);
+  auto textBlob = textLayer->textBlob;
+  ASSERT_TRUE(textBlob != nullptr);
+  textLayer->setTextColor(Color::Red());
+  ASSERT_TRUE(textLayer->getContent() != nullptr);
+  EXPECT_EQ(textLayer->textBlob, textBlob);
+  textLayer->setText("Hello");
+  EXPECT_TRUE(textLayer->textBlob == nullptr);
+  ASSERT_TRUE(textLayer->getContent() != nullptr);
+  EXPECT_NE(textLayer->textBlob, textBlob);
+}
+
+TGFX_TEST(LayerTest, CommitFrame) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto makeLayer = [](DisplayList* displayList) {
+    auto shapeLayer = ShapeLayer::Make();
+    Path path = {};
+    path.addOval(Rect::MakeWH(80, 60));
+    shapeLayer->setPath(path);
+    shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+    shapeLayer->setMatrix(Matrix::MakeTrans(20, 30));
+    displayList->root()->addChild(shapeLayer);
+    return shapeLayer;
+  };
+  DisplayList appList;
+  auto layer = makeLayer(&appList);
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  auto directLayer = makeLayer(&directList);
+  DisplayList renderList;
+  auto surface = Surface::Make(context, 200, 200);
+  auto directSurface = Surface::Make(context, 200, 200);
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> pixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+
+  auto frame = appList.commit();
+  ASSERT_TRUE(frame != nullptr);
+  EXPECT_FALSE(frame->dirtyRegions().empty());
+  renderList.setFrame(frame);
+  EXPECT_TRUE(renderList.hasContentChanged());
+  renderList.render(surface.get());
+  directList.render(directSurface.get());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+
+  // Mutating the layers after the commit does not affect the committed frame.
+  layer->setMatrix(Matrix::MakeTrans(100, 110));
+  renderList.render(surface.get());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+
+  frame = appList.commit();
+  EXPECT_EQ(frame->dirtyRegions().size(), 2u);
+  auto unchangedFrame = appList.commit();
+  EXPECT_TRUE(unchangedFrame->dirtyRegions().empty());
+  ASSERT_EQ(unchangedFrame->layerPictures.size(), 1u);
+  EXPECT_EQ(unchangedFrame->layerPictures[0].picture, frame->layerPictures[0].picture);
+  appList.setContentOffset(-10, 5);
+  directList.setContentOffset(-10, 5);
+  auto offsetFrame = appList.commit();
+  EXPECT_EQ(offsetFrame->contentOffset(), Point::Make(-10, 5));
+  renderList.setFrame(frame);
+  renderList.setFrame(unchangedFrame);
+  renderList.setFrame(offsetFrame);
+  EXPECT_EQ(renderList.contentOffset(), Point::Make(-10, 5));
+  renderList.render(surface.get());
+  directLayer->setMatrix(Matrix::MakeTrans(100, 110));
+  directList.render(directSurface.get());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+}
+
+TGFX_TEST(LayerTest, CommitFrameSkipped) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto makeLayer = [](DisplayList* displayList) {
+    auto shapeLayer = ShapeLayer::Make();
+    Path path = {};
+    path.addRect(Rect::MakeWH(60, 40));
+    shapeLayer->setPath(path);
+    shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+    shapeLayer->setMatrix(Matrix::MakeTrans(10, 10));
+    displayList->root()->addChild(shapeLayer);
+    return shapeLayer;
+  };
+  DisplayList appList;
+  auto layer = makeLayer(&appList);
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  auto directLayer = makeLayer(&directList);
+  DisplayList renderList;
+  auto surface = Surface::Make(context, 200, 200);
+  auto directSurface = Surface::Make(context, 200, 200);
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> pixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+
+  renderList.setFrame(appList.commit());
+  renderList.render(surface.get());
+
+  // The render thread only takes the newest of three frames, so the dirty regions of the first two
+  // are never seen, and the whole content has to be redrawn.
+  layer->setMatrix(Matrix::MakeTrans(120, 10));
+  appList.commit();
+  layer->setMatrix(Matrix::MakeTrans(120, 130));
+  appList.commit();
+  layer->setFillStyle(SolidColor::Make(Color::Blue()));
+  auto lastFrame = appList.commit();
+  EXPECT_EQ(lastFrame->dirtyRegions().size(), 1u);
+  renderList.setFrame(lastFrame);
+  EXPECT_TRUE(renderList.hasContentChanged());
+  renderList.render(surface.get());
+
+  directLayer->setMatrix(Matrix::MakeTrans(120, 130));
+  directLayer->setFillStyle(SolidColor::Make(Color::Blue()));
+  directList.render(directSurface.get());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+}
+
+TGFX_TEST(LayerTest, CommitFrameOnAnotherThread) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto makeLayer = [](DisplayList* displayList, const Color& color, float x, float y) {
+    auto shapeLayer = ShapeLayer::Make();
+    Path path = {};
+    path.addRect(Rect::MakeWH(60, 50));
+    shapeLayer->setPath(path);
+    shapeLayer->setFillStyle(SolidColor::Make(color));
+    shapeLayer->setMatrix(Matrix::MakeTrans(x, y));
+    displayList->root()->addChild(shapeLayer);
+    return shapeLayer;
+  };
+  static constexpr int FrameCount = 10;
+  DisplayList appList;
+  makeLayer(&appList, Color::Blue(), 20, 20);
+  auto movingLayer = makeLayer(&appList, Color::Red(), 0, 120);
+  std::mutex locker = {};
+  std::condition_variable condition = {};
+  std::deque<std::shared_ptr<DisplayFrame>> frameQueue = {};
+  std::thread appThread([&]() {
+    for (int i = 0; i < FrameCount; i++) {
+      movingLayer->setMatrix(Matrix::MakeTrans(static_cast<float>(i * 10), 120));
+      auto frame = appList.commit();
+      std::lock_guard<std::mutex> autoLock(locker);
+      frameQueue.push_back(std::move(frame));
+      condition.notify_one();
+    }
+  });
+  DisplayList renderList;
+  auto surface = Surface::Make(context, 200, 200);
+  std::vector<std::shared_ptr<DisplayFrame>> frames = {};
+  for (int i = 0; i < FrameCount; i++) {
+    std::shared_ptr<DisplayFrame> frame = nullptr;
+    {
+      std::unique_lock<std::mutex> autoLock(locker);
+      condition.wait(autoLock, [&]() { return !frameQueue.empty(); });
+      frame = std::move(frameQueue.front());
+      frameQueue.pop_front();
+    }
+    renderList.setFrame(frame);
+    renderList.render(surface.get());
+    frames.push_back(std::move(frame));
+  }
+  appThread.join();
+  // Only the moving layer overlaps the dirty regions, so the other one is recorded once.
+  ASSERT_EQ(frames.front()->layerPictures.size(), 2u);
+  ASSERT_EQ(frames.back()->layerPictures.size(), 2u);
+  EXPECT_EQ(frames.front()->layerPictures[0].picture, frames.back()->layerPictures[0].picture);
+  EXPECT_NE(frames.front()->layerPictures[1].picture, frames.back()->layerPictures[1].picture);
+
+  DisplayList directList;
+  directList.setRenderMode(RenderMode::Direct);
+  makeLayer(&directList, Color::Blue(), 20, 20);
+  makeLayer(&directList, Color::Red(), static_cast<float>((FrameCount - 1) * 10), 120);
+  auto directSurface = Surface::Make(context, 200, 200);
+  directList.render(directSurface.get());
+  auto info = ImageInfo::Make(200, 200, ColorType::RGBA_8888, AlphaType::Premultiplied);
+  std::vector<uint8_t> pixels(info.byteSize());
+  std::vector<uint8_t> directPixels(info.byteSize());
+  ASSERT_TRUE(surface->readPixels(info, pixels.data()));
+  ASSERT_TRUE(directSurface->readPixels(info, directPixels.data()));
+  EXPECT_TRUE(pixels == directPixels);
+}
+
+TGFX_TEST(LayerTest, TranslateRenderBounds) {
+  auto makeTree = [](DisplayList* displayList) {
+    auto group = Layer::Make();
+    auto child = ShapeLayer::Make();
+    Path path = {};
+    path.addRect(Rect::MakeWH(40, 30));
+    child->setPath(path);
+    child->setFillStyle(SolidColor::Make(Color::Red()));
+    child->setMatrix(Matrix::MakeTrans(10, 20));
+    child->setFilters({BlurFilter::Make(5, 5)});
+    auto grandChild = SolidLayer::Make();
+    grandChild->setWidth(10);
+    grandChild->setHeight(10);
+    grandChild->setMatrix(Matrix::MakeTrans(50, 50));
+    child->addChild(grandChild);
+    group->addChild(child);
+    displayList->root()->addChild(group);
+    return group;
+  };
+  DisplayList displayList;
+  auto group = makeTree(&displayList);
+  auto child = group->children()[0];
+  auto grandChild = child->children()[0];
+  auto root = static_cast<RootLayer*>(displayList.root());
+  root->updateDirtyRegions();
+  auto childBounds = child->renderBounds;
+  auto grandChildBounds = grandChild->renderBounds;
+
+  group->setMatrix(Matrix::MakeTrans(100, 50));
+  auto dirtyRegions = root->updateDirtyRegions();
+  childBounds.offset(100, 50);
+  grandChildBounds.offset(100, 50);
+  EXPECT_EQ(child->renderBounds, childBounds);
+  EXPECT_EQ(grandChild->renderBounds, grandChildBounds);
+  EXPECT_EQ(group->renderBounds, childBounds);
+  EXPECT_EQ(grandChild->lastRenderMatrix, Matrix::MakeTrans(160, 120));
+  EXPECT_FALSE(dirtyRegions.empty());
+
+  group->setMatrix(Matrix::MakeScale(2));
+  root->updateDirtyRegions();
+  DisplayList referenceList;
+  auto referenceGroup = makeTree(&referenceList);
+  referenceGroup->setMatrix(Matrix::MakeScale(2));
+  static_cast<RootLayer*>(referenceList.root())->updateDirtyRegions();
+  auto referenceGrandChild = referenceGroup->children()[0]->children()[0];
+  EXPECT_EQ(grandChild->renderBounds, referenceGrandChild->renderBounds);
+  EXPECT_EQ(grandChild->lastRenderMatrix, Matrix::MakeAll(2, 0, 120, 0, 2, 140));
+}
+
+TGFX_TEST(LayerTest, EffectCache) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  EXPECT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 200, 200);
+  DisplayList displayList;
+  auto shapeLayer = ShapeLayer::Make();
+  Path path;
+  path.addRect(Rect::MakeWH(100, 100));
+  shapeLayer->setPath(path);
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  shapeLayer->setMatrix(Matrix::MakeTrans(50, 50));
+  auto shadowStyle = DropShadowStyle::Make(10, 10, 5, 5, Color::Black());
+  shapeLayer->setLayerStyles({shadowStyle});
+  shapeLayer->setFilters({BlurFilter::Make(5, 5)});
+  displayList.root()->addChild(shapeLayer);
+  displayList.render(surface.get());
+  ASSERT_TRUE(shapeLayer->effectCache != nullptr);
+  ASSERT_TRUE(shapeLayer->effectCache->filteredContent != nullptr);
+  EXPECT_TRUE(shapeLayer->effectCache->styleSource != nullptr);
+  EXPECT_TRUE(shapeLayer->effectCache->findStyleOutput(shadowStyle.get()) != nullptr);
+  auto filteredImage = shapeLayer->effectCache->filteredContent->getImage();
+
+  // Moving the layer reuses the cached output.
+  shapeLayer->setMatrix(Matrix::MakeTrans(40, 40));
+  displayList.render(surface.get());
+  ASSERT_TRUE(shapeLayer->effectCache != nullptr);
+  ASSERT_TRUE(shapeLayer->effectCache->filteredContent != nullptr);
+  EXPECT_EQ(shapeLayer->effectCache->filteredContent->getImage(), filteredImage);
+  EXPECT_TRUE(Baseline::Compare(surface, "LayerTest/EffectCache"));
+
+  // A small zoom change stays in the same scale bucket and reuses the cached output.
+  displayList.setZoomScale(1.05f);
+  displayList.render(surface.get());
+  ASSERT_TRUE(shapeLayer->effectCache != nullptr);
+  ASSERT_TRUE(shapeLayer->effectCache->filteredContent != nullptr);
+  EXPECT_EQ(shapeLayer->effectCache->filteredContent->getImage(), filteredImage);
+  displayList.setZoomScale(1.0f);
+
+  // Changing a style parameter drops the cache.
+  shadowStyle->setOffsetX(0);
+  EXPECT_TRUE(shapeLayer->effectCache == nullptr);
+  displayList.render(surface.get());
+  ASSERT_TRUE(shapeLayer->effectCache != nullptr);
+
+  // Changing the content drops the cache.
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Blue()));
+  EXPECT_TRUE(shapeLayer->effectCache == nullptr);
+  displayList.render(surface.get());
+  EXPECT_TRUE(shapeLayer->effectCache != nullptr);
+
+  // A layer that is only partially inside the render rect isn't rasterized into the cache.
+  shapeLayer->setMatrix(Matrix::MakeTrans(150, 150));
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Green()));
+  displayList.render(surface.get());
+  ASSERT_TRUE(shapeLayer->effectCache != nullptr);
+  EXPECT_TRUE(shapeLayer->effectCache->filteredContent == nullptr);
+  EXPECT_TRUE(shapeLayer->effectCache->styleSource == nullptr);
+}
+
+class BadgeShapeLayer : public ShapeLayer {
+ public:
+  static std::shared_ptr<BadgeShapeLayer> Make() {
+    return std::shared_ptr<BadgeShapeLayer>(new BadgeShapeLayer());
+  }
+
+ protected:
+  void onUpdateContent(LayerRecorder* recorder) override {
+    ShapeLayer::onUpdateContent(recorder);
+    Paint paint = {};
+    paint.setColor(Color::Green());
+    recorder->getCanvas()->drawRect(Rect::MakeWH(10, 10), paint);
+  }
+};
+
+TGFX_TEST(LayerTest, SharedContent) {
+  Path path = {};
+  path.addOval(Rect::MakeWH(60, 40));
+  auto shapeLayer = ShapeLayer::Make();
+  shapeLayer->setPath(path);
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  auto sameShapeLayer = ShapeLayer::Make();
+  sameShapeLayer->setPath(path);
+  sameShapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  auto content = shapeLayer->getContent();
+  ASSERT_TRUE(content != nullptr);
+  EXPECT_EQ(sameShapeLayer->getContent(), content);
+  sameShapeLayer->setFillStyle(SolidColor::Make(Color::Blue()));
+  EXPECT_NE(sameShapeLayer->getContent(), content);
+  // Subclasses may record more than their base class, so they don't share its contents.
+  auto badgeLayer = BadgeShapeLayer::Make();
+  badgeLayer->setPath(path);
+  badgeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  EXPECT_NE(badgeLayer->getContent(), content);
+  auto shape = Shape::MakeFrom(path);
+  shape = Shape::ApplyMatrix(shape, Matrix::MakeScale(2.0f));
+  auto matrixShapeLayer = ShapeLayer::Make();
+  matrixShapeLayer->setShape(shape);
+  matrixShapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  auto sameMatrixShapeLayer = ShapeLayer::Make();
+  sameMatrixShapeLayer->setShape(shape);
+  sameMatrixShapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  auto shapeContent = matrixShapeLayer->getContent();
+  ASSERT_TRUE(shapeContent != nullptr);
+  EXPECT_EQ(sameMatrixShapeLayer->getContent(), shapeContent);
+  auto gradientLayer = ShapeLayer::Make();
+  gradientLayer->setPath(path);
+  gradientLayer->setFillStyle(
+      Gradient::MakeLinear({0, 0}, {60, 0}, {Color::Red(), Color::Red()}, {0, 1}));
+  EXPECT_NE(gradientLayer->getContent(), content);
+
+  auto typeface = MakeTypeface("resources/font/NotoSansSC-Regular.otf");
+  auto textLayer = TextLayer::Make();
+  textLayer->setFont(Font(typeface, 20));
+  textLayer->setText("Hello TGFX");
+  auto sameTextLayer = TextLayer::Make();
+  sameTextLayer->setFont(Font(typeface, 20));
+  sameTextLayer->setText("Hello TGFX");
+  auto textContent = textLayer->getContent();
+  ASSERT_TRUE(textContent != nullptr);
+  EXPECT_EQ(sameTextLayer->getContent(), textContent);
+  sameTextLayer->setText("Hello");
+  EXPECT_NE(sameTextLayer->getContent(), textContent);
+}
+
+TGFX_TEST(LayerTest, TilePrefetch) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 200, 200);
+  DisplayList displayList;
+  auto shapeLayer = ShapeLayer::Make();
+  Path path = {};
+  path.addRect(Rect::MakeWH(1000, 200));
+  shapeLayer->setPath(path);
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Blue()));
+  displayList.root()->addChild(shapeLayer);
+  displayList.setRenderMode(RenderMode::Tiled);
+  displayList.setTileSize(64);
+  displayList.setMaxTileCount(64);
+  displayList.render(surface.get());
+  // A single jump of the content offset is not a prediction.
+  displayList.setContentOffset(-10, 0);
+  displayList.render(surface.get());
+  EXPECT_TRUE(displayList.scrollVelocity.isZero());
+  displayList.setContentOffset(-20, 0);
+  displayList.render(surface.get());
+  EXPECT_EQ(displayList.scrollVelocity, Point::Make(-10, 0));
+  // Rendering time varies between machines, so prefetch again with an idle frame budget.
+  displayList.averageFrameTime = 0;
+  displayList.averageTileTime = 0;
+  displayList.prefetchTiles(surface.get());
+  auto tileCache = displayList.tileCaches[displayList._zoomScaleInt];
+  ASSERT_TRUE(tileCache != nullptr);
+  auto tile = tileCache->getTile(4, 0);
+  ASSERT_TRUE(tile != nullptr);
+  EXPECT_TRUE(tile->prefetched);
+  tile = nullptr;
+  // Prefetched tiles that have not been displayed are reused first.
+  auto reusableTiles = tileCache->getReusableTiles(100, 100);
+  ASSERT_FALSE(reusableTiles.empty());
+  EXPECT_TRUE(reusableTiles.front()->prefetched);
+  reusableTiles = {};
+
+  displayList.setContentOffset(-100, 0);
+  displayList.render(surface.get());
+  tile = tileCache->getTile(4, 0);
+  ASSERT_TRUE(tile != nullptr);
+  EXPECT_FALSE(tile->prefetched);
+}
+
+TGFX_TEST(LayerTest, DemoteInactiveTiles) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 128, 128);
+  DisplayList displayList;
+  auto shapeLayer = ShapeLayer::Make();
+  Path path = {};
+  path.addOval(Rect::MakeWH(128, 128));
+  shapeLayer->setPath(path);
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  displayList.root()->addChild(shapeLayer);
+  displayList.setRenderMode(RenderMode::Tiled);
+  displayList.setTileSize(64);
+  displayList.setMaxTileCount(16);
+  displayList.setDemoteInactiveTiles(true);
+  auto scaleInt = displayList._zoomScaleInt;
+  displayList.render(surface.get());
+  EXPECT_EQ(displayList.demotedTileSlots, 4);
+  // Fill up the remaining tiles with other zoom levels.
+  for (auto zoomScale : {2.0f, 4.0f}) {
+    displayList.setZoomScale(zoomScale);
+    displayList.render(surface.get());
+  }
+  EXPECT_LT(displayList.demotedSurfaceIndex, 0);
+  // The tiles of the farthest zoom level are demoted instead of evicted.
+  displayList.setZoomScale(8.0f);
+  displayList.render(surface.get());
+  ASSERT_GE(displayList.demotedSurfaceIndex, 0);
+  auto tileCache = displayList.tileCaches[scaleInt];
+  ASSERT_TRUE(tileCache != nullptr);
+  auto tile = tileCache->getTile(0, 0);
+  ASSERT_TRUE(tile != nullptr);
+  EXPECT_TRUE(tile->demoted);
+  EXPECT_EQ(tile->getSourceRect(64).width(), 32.0f);
+  tile = nullptr;
+
+  displayList.setAllowZoomBlur(true);
+  displayList.setZoomScale(1.0f);
+  displayList.render(surface.get());
+  EXPECT_TRUE(displayList.hasZoomBlurTiles);
+  tile = tileCache->getTile(0, 0);
+  ASSERT_TRUE(tile != nullptr);
+  EXPECT_TRUE(tile->demoted);
+  tile = nullptr;
+  displayList.render(surface.get());
+  EXPECT_FALSE(displayList.hasZoomBlurTiles);
+  tile = tileCache->getTile(0, 0);
+  ASSERT_TRUE(tile != nullptr);
+  EXPECT_FALSE(tile->demoted);
+}
+
+TGFX_TEST(LayerTest, OpaqueOcclusion) {
+  Recorder recorder = {};
+  auto canvas = recorder.beginRecording();
+  Paint paint = {};
+  paint.setColor(Color::FromRGBA(255, 0, 0, 128));
+  canvas->drawRect(Rect::MakeWH(100, 100), paint);
+  paint.setColor(Color::Blue());
+  canvas->drawRect(Rect::MakeXYWH(10, 10, 40, 40), paint);
+  canvas->clipRect(Rect::MakeXYWH(20, 0, 50, 50));
+  canvas->drawRect(Rect::MakeWH(100, 100), paint);
+  auto picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_EQ(picture->getOpaqueBounds(), Rect::MakeXYWH(20, 0, 50, 50));
+
+  canvas = recorder.beginRecording();
+  canvas->clipRect(Rect::MakeWH(100, 100));
+  canvas->clear();
+  paint.setColor(Color::FromRGBA(0, 0, 255, 128));
+  paint.setBlendMode(BlendMode::Src);
+  canvas->drawRect(Rect::MakeWH(80, 80), paint);
+  picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_TRUE(picture->getOpaqueBounds().isEmpty());
+
+  canvas = recorder.beginRecording();
+  paint.setColor(Color::Blue());
+  paint.setBlendMode(BlendMode::SrcOver);
+  canvas->drawRect(Rect::MakeWH(100, 100), paint);
+  paint.setBlendMode(BlendMode::DstOut);
+  canvas->drawRect(Rect::MakeXYWH(0, 70, 100, 10), paint);
+  picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_EQ(picture->getOpaqueBounds(), Rect::MakeWH(100, 70));
+  canvas = recorder.beginRecording();
+  paint.setBlendMode(BlendMode::SrcOver);
+  canvas->drawRect(Rect::MakeWH(100, 100), paint);
+  canvas->clipRect(Rect::MakeWH(40, 100));
+  canvas->clear();
+  picture = recorder.finishRecordingAsPicture();
+  ASSERT_TRUE(picture != nullptr);
+  EXPECT_EQ(picture->getOpaqueBounds(), Rect::MakeLTRB(40, 0, 100, 100));
+
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto surface = Surface::Make(context, 100, 100);
+  DisplayList displayList;
+  auto shapeLayer = ShapeLayer::Make();
+  Path path = {};
+  path.addOval(Rect::MakeXYWH(10, 10, 50, 50));
+  shapeLayer->setPath(path);
+  shapeLayer->setFillStyle(SolidColor::Make(Color::Red()));
+  displayList.root()->addChild(shapeLayer);
+  auto panel = SolidLayer::Make();
+  panel->setWidth(100);
+  panel->setHeight(100);
+  panel->setRadiusX(10);
+  panel->setRadiusY(10);
+  panel->setColor(Color::Blue());
+  displayList.root()->addChild(panel);
+  auto overlay = SolidLayer::Make();
+  overlay->setWidth(50);
+  overlay->setHeight(50);
+  overlay->setColor(Color::Green());
+  overlay->setAlpha(0.5f);
+  displayList.root()->addChild(overlay);
+  auto content = panel->getContent();
+  ASSERT_TRUE(content != nullptr);
+  EXPECT_EQ(content->getOpaqueBounds(), Rect::MakeXYWH(0, 10, 100, 80));
+
+  displayList.render(surface.get());
+  auto root = displayList.root();
+  EXPECT_EQ(panel->opaqueBounds, Rect::MakeXYWH(0, 10, 100, 80));
+  EXPECT_TRUE(overlay->opaqueBounds.isEmpty());
+  EXPECT_EQ(root->opaqueBounds, Rect::MakeXYWH(0, 10, 100, 80));
+  auto renderRect = Rect::MakeWH(100, 100);
+  DrawArgs args(context);
+  args.renderRect = &renderRect;
+  auto occluded = root->getOccludedChildren(args, Matrix::I(), 1.0f, nullptr);
+  ASSERT_EQ(occluded.size(), 3u);
+  EXPECT_TRUE(occluded[0]);
+  EXPECT_FALSE(occluded[1]);
+  EXPECT_FALSE(occluded[2]);
+  EXPECT_TRUE(root->getOccludedChildren(args, Matrix::I(), 0.5f, nullptr).empty());
+  EXPECT_FALSE(displayList.isOpaqueOver(renderRect, Matrix::I()));
+  EXPECT_TRUE(displayList.isOpaqueOver(Rect::MakeXYWH(0, 20, 100, 60), Matrix::I()));
+
+  panel->setRadiusX(0);
+  panel->setRadiusY(0);
+  displayList.render(surface.get());
+  EXPECT_EQ(root->opaqueBounds, Rect::MakeWH(100, 100));
+  EXPECT_TRUE(displayList.isOpaqueOver(renderRect, Matrix::I()));
+  panel->setAlpha(0.5f);
+  displayList.render(surface.get());
+  EXPECT_TRUE(root->opaqueBounds.isEmpty());
+  EXPECT_TRUE(root->getOccludedChildren(args, Matrix::I(), 1.0f, nullptr).empty());
+}
 }  // namespace tgfx
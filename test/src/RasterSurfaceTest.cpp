@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "tgfx/core/Canvas.h"
+#include "tgfx/core/Paint.h"
+#include "tgfx/core/RasterSurface.h"
+#include "utils/TestUtils.h"
+
+namespace tgfx {
+static std::vector<uint8_t> ReadPixels(const RasterSurface* surface) {
+  auto info = ImageInfo::Make(surface->width(), surface->height(), ColorType::RGBA_8888,
+                              AlphaType::Premultiplied);
+  std::vector<uint8_t> pixels(info.byteSize());
+  EXPECT_TRUE(surface->readPixels(info, pixels.data()));
+  return pixels;
+}
+
+static const uint8_t* PixelAt(const std::vector<uint8_t>& pixels, int width, int x, int y) {
+  return pixels.data() + (static_cast<size_t>(y) * static_cast<size_t>(width) + x) * 4;
+}
+
+TGFX_TEST(RasterSurfaceTest, DrawRect) {
+  auto surface = RasterSurface::Make(20, 20);
+  ASSERT_TRUE(surface != nullptr);
+  EXPECT_TRUE(RasterSurface::Make(0, 20) == nullptr);
+  auto canvas = surface->getCanvas();
+  Paint paint = {};
+  paint.setColor(Color::Red());
+  canvas->drawRect(Rect::MakeXYWH(5, 5, 10, 10), paint);
+  paint.setColor(Color::FromRGBA(0, 0, 255, 128));
+  canvas->drawRect(Rect::MakeXYWH(10, 10, 10, 10), paint);
+  auto pixels = ReadPixels(surface.get());
+  auto pixel = PixelAt(pixels, 20, 2, 2);
+  EXPECT_EQ(pixel[3], 0);
+  pixel = PixelAt(pixels, 20, 7, 7);
+  EXPECT_EQ(pixel[0], 255);
+  EXPECT_EQ(pixel[2], 0);
+  EXPECT_EQ(pixel[3], 255);
+  pixel = PixelAt(pixels, 20, 12, 12);
+  EXPECT_NEAR(pixel[0], 127, 1);
+  EXPECT_NEAR(pixel[2], 128, 1);
+  EXPECT_EQ(pixel[3], 255);
+  pixel = PixelAt(pixels, 20, 17, 17);
+  EXPECT_EQ(pixel[0], 0);
+  EXPECT_NEAR(pixel[2], 128, 1);
+  EXPECT_NEAR(pixel[3], 128, 1);
+}
+
+TGFX_TEST(RasterSurfaceTest, ClipAndGradient) {
+  auto surface = RasterSurface::Make(100, 10);
+  ASSERT_TRUE(surface != nullptr);
+  auto canvas = surface->getCanvas();
+  canvas->clipRect(Rect::MakeXYWH(0, 0, 100, 5));
+  Paint paint = {};
+  paint.setShader(Shader::MakeLinearGradient({0, 0}, {100, 0}, {Color::Black(), Color::White()}));
+  canvas->drawRect(Rect::MakeWH(100, 10), paint);
+  auto pixels = ReadPixels(surface.get());
+  EXPECT_LE(PixelAt(pixels, 100, 0, 2)[0], 2);
+  EXPECT_NEAR(PixelAt(pixels, 100, 50, 2)[0], 128, 2);
+  EXPECT_GE(PixelAt(pixels, 100, 99, 2)[0], 253);
+  EXPECT_EQ(PixelAt(pixels, 100, 50, 2)[3], 255);
+  EXPECT_EQ(PixelAt(pixels, 100, 50, 7)[3], 0);
+  auto image = surface->makeImageSnapshot();
+  ASSERT_TRUE(image != nullptr);
+  EXPECT_EQ(image->width(), 100);
+  EXPECT_EQ(image->height(), 10);
+}
+}  // namespace tgfx
@@ -155,6 +155,52 @@ TGFX_TEST(ReadPixelsTest, PixelMap) {
   CHECK_PIXELS(BGRAInfo, pixelsB.data(), "PixelMap_alpha_to_BGRA");
 }
 
+TGFX_TEST(ReadPixelsTest, PixelConvert) {
+  // Use an odd width so that both the SIMD body and the scalar tail of each row are covered.
+  constexpr int Width = 67;
+  auto RGBAInfo = ImageInfo::Make(Width, 1, ColorType::RGBA_8888, AlphaType::Unpremultiplied);
+  auto rgb_AInfo = RGBAInfo.makeAlphaType(AlphaType::Premultiplied);
+  auto BGRAInfo = rgb_AInfo.makeColorType(ColorType::BGRA_8888);
+  std::vector<uint8_t> src(RGBAInfo.byteSize());
+  std::vector<uint8_t> dst(RGBAInfo.byteSize());
+  auto checkPixels = [&](std::vector<uint8_t> expected) {
+    for (int i = 0; i < Width; i++) {
+      for (size_t c = 0; c < 4; c++) {
+        EXPECT_EQ(dst[static_cast<size_t>(i) * 4 + c], expected[c]);
+      }
+    }
+  };
+  auto fillPixels = [&](std::vector<uint8_t> pixel) {
+    for (size_t i = 0; i < src.size(); i++) {
+      src[i] = pixel[i % 4];
+    }
+  };
+
+  fillPixels({255, 128, 0, 128});
+  EXPECT_TRUE(Pixmap(RGBAInfo, src.data()).readPixels(BGRAInfo, dst.data()));
+  checkPixels({0, 64, 128, 128});
+
+  fillPixels({40, 20, 0, 160});
+  EXPECT_TRUE(Pixmap(rgb_AInfo, src.data()).readPixels(RGBAInfo, dst.data()));
+  checkPixels({64, 32, 0, 160});
+
+  auto A8Info = ImageInfo::Make(Width, 1, ColorType::ALPHA_8, AlphaType::Premultiplied);
+  EXPECT_TRUE(Pixmap(rgb_AInfo, src.data()).readPixels(A8Info, dst.data()));
+  for (int i = 0; i < Width; i++) {
+    EXPECT_EQ(dst[static_cast<size_t>(i)], 160);
+  }
+
+  std::vector<uint16_t> src565(Width, 0xF810);
+  auto RGB565Info = ImageInfo::Make(Width, 1, ColorType::RGB_565, AlphaType::Opaque);
+  EXPECT_TRUE(Pixmap(RGB565Info, src565.data()).readPixels(rgb_AInfo, dst.data()));
+  checkPixels({255, 0, 132, 255});
+
+  std::vector<uint8_t> srcGray(Width, 77);
+  auto Gray8Info = ImageInfo::Make(Width, 1, ColorType::Gray_8, AlphaType::Opaque);
+  EXPECT_TRUE(Pixmap(Gray8Info, srcGray.data()).readPixels(BGRAInfo, dst.data()));
+  checkPixels({77, 77, 77, 255});
+}
+
 TGFX_TEST(ReadPixelsTest, Surface) {
   auto codec = MakeImageCodec("resources/apitest/test_timestretch.png");
   ASSERT_TRUE(codec != nullptr);
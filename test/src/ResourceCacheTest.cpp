@@ -20,8 +20,15 @@
 #include <utility>
 #include "core/utils/BlockBuffer.h"
 #include "core/utils/UniqueID.h"
+#include "gpu/BackingFit.h"
+#include "gpu/DrawingManager.h"
+#include "gpu/ProxyProvider.h"
 #include "gpu/RectsVertexProvider.h"
+#include "gpu/RenderTarget.h"
 #include "gpu/Resource.h"
+#include "gpu/Texture.h"
+#include "gpu/processors/ConstColorProcessor.h"
+#include "gpu/processors/TextureEffect.h"
 #include "tgfx/core/Rect.h"
 #include "tgfx/core/Task.h"
 #include "utils/TestUtils.h"
@@ -65,6 +72,156 @@ TGFX_TEST(ResourceCacheTest, multiThreadRecycling) {
   });
 };
 
+TGFX_TEST(ResourceCacheTest, approxScratchTextures) {
+  auto sizes = GetApproxSizes(500, 200, 4096);
+  ASSERT_EQ(sizes.size(), 3u);
+  EXPECT_EQ(sizes[0], ISize::Make(512, 256));
+  EXPECT_EQ(sizes[1], ISize::Make(512, 512));
+  EXPECT_EQ(sizes[2], ISize::Make(1024, 256));
+  EXPECT_EQ(GetApproxSizes(1100, 1100, 1536).size(), 1u);
+
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto cache = context->resourceCache();
+  auto texture = Texture::MakeApprox(context, 300, 300, PixelFormat::RGBA_8888);
+  ASSERT_TRUE(texture != nullptr);
+  EXPECT_EQ(texture->width(), 512);
+  EXPECT_EQ(texture->height(), 512);
+  auto texturePtr = texture.get();
+  texture = nullptr;
+  auto approxReuses = cache->scratchStats().approxReuses;
+  texture = Texture::MakeApprox(context, 500, 200, PixelFormat::RGBA_8888);
+  ASSERT_TRUE(texture != nullptr);
+  EXPECT_EQ(texture.get(), texturePtr);
+  EXPECT_EQ(cache->scratchStats().approxReuses, approxReuses + 1);
+  auto smallTexture = Texture::MakeApprox(context, 100, 100, PixelFormat::RGBA_8888);
+  ASSERT_TRUE(smallTexture != nullptr);
+  EXPECT_EQ(smallTexture->width(), 128);
+  texture = nullptr;
+  smallTexture = nullptr;
+  context->flush();
+  cache->purgeScratchResourcesTo(0);
+  EXPECT_EQ(cache->scratchStats().idleBytes, 0u);
+}
+
+TGFX_TEST(ResourceCacheTest, memoryPressure) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  context->purgeResourcesUntilMemoryTo(0);
+  auto stats = context->memoryStats();
+  auto imageBytes = stats.bytes(ResourceCategory::Image);
+  auto renderTargetBytes = stats.bytes(ResourceCategory::RenderTarget);
+  auto texture = Texture::MakeRGBA(context, 100, 100);
+  ASSERT_TRUE(texture != nullptr);
+  auto renderTarget = RenderTarget::Make(context, 100, 100);
+  ASSERT_TRUE(renderTarget != nullptr);
+  stats = context->memoryStats();
+  EXPECT_EQ(stats.bytes(ResourceCategory::Image), imageBytes + texture->memoryUsage());
+  EXPECT_GT(stats.bytes(ResourceCategory::RenderTarget), renderTargetBytes);
+  size_t categoryTotal = 0;
+  for (auto bytes : stats.categoryBytes) {
+    categoryTotal += bytes;
+  }
+  EXPECT_EQ(categoryTotal, stats.totalBytes);
+
+  texture = nullptr;
+  renderTarget = nullptr;
+  context->onMemoryPressure(MemoryPressureLevel::Low);
+  stats = context->memoryStats();
+  EXPECT_EQ(stats.idleScratchBytes, 0u);
+  EXPECT_EQ(stats.bytes(ResourceCategory::Image), imageBytes);
+
+  auto image = MakeImage("resources/apitest/imageReplacement.png");
+  ASSERT_TRUE(image != nullptr);
+  image = image->makeTextureImage(context);
+  ASSERT_TRUE(image != nullptr);
+  context->flushAndSubmit();
+  EXPECT_GT(context->memoryStats().bytes(ResourceCategory::Image), imageBytes);
+  image = nullptr;
+  context->setCacheLimit(ResourceCategory::Image, 0);
+  EXPECT_EQ(context->cacheLimit(ResourceCategory::Image), 0u);
+  EXPECT_EQ(context->memoryStats().bytes(ResourceCategory::Image), imageBytes);
+  context->setCacheLimit(ResourceCategory::Image, std::numeric_limits<size_t>::max());
+
+  context->onMemoryPressure(MemoryPressureLevel::Critical);
+  EXPECT_EQ(context->memoryStats().purgeableBytes, 0u);
+}
+
+TGFX_TEST(ResourceCacheTest, vertexRingBuffer) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto proxyProvider = context->proxyProvider();
+  auto rect = Rect::MakeWH(100, 100);
+  auto provider = RectsVertexProvider::MakeFrom(context->drawingBuffer(), rect, AAType::Coverage);
+  auto vertexBuffer = proxyProvider->createVertexBuffer(std::move(provider));
+  ASSERT_TRUE(vertexBuffer != nullptr);
+  auto ringBuffer = proxyProvider->vertexRingBuffer.get();
+  if (ringBuffer == nullptr) {
+    // The backend cannot map buffers, the vertices are uploaded from the block buffer instead.
+    context->flush();
+    return;
+  }
+  auto buffer = vertexBuffer->getBuffer();
+  ASSERT_TRUE(buffer != nullptr);
+  EXPECT_EQ(buffer, ringBuffer->buffer());
+  auto regionSize = ringBuffer->regionSize();
+  auto region = vertexBuffer->offset() / regionSize;
+  context->flush();
+  for (int i = 1; i <= VertexRingBuffer::FrameCount; i++) {
+    provider = RectsVertexProvider::MakeFrom(context->drawingBuffer(), rect, AAType::Coverage);
+    vertexBuffer = proxyProvider->createVertexBuffer(std::move(provider));
+    ASSERT_TRUE(vertexBuffer != nullptr);
+    EXPECT_EQ(vertexBuffer->getBuffer(), buffer);
+    auto expectedRegion = (region + static_cast<size_t>(i)) % VertexRingBuffer::FrameCount;
+    EXPECT_EQ(vertexBuffer->offset() / regionSize, expectedRegion);
+    context->flush();
+  }
+  vertexBuffer = nullptr;
+  context->flushAndSubmit(true);
+}
+
+TGFX_TEST(ResourceCacheTest, transientRenderTargets) {
+  ContextScope scope;
+  auto context = scope.getContext();
+  ASSERT_TRUE(context != nullptr);
+  auto proxyProvider = context->proxyProvider();
+  auto drawingManager = context->drawingManager();
+  auto drawingBuffer = context->drawingBuffer();
+  auto resultA = proxyProvider->createRenderTargetProxy({}, 100, 100, PixelFormat::RGBA_8888);
+  auto resultB = proxyProvider->createRenderTargetProxy({}, 100, 100, PixelFormat::RGBA_8888);
+  auto offscreenA = proxyProvider->createRenderTargetProxy({}, 64, 64, PixelFormat::RGBA_8888);
+  auto offscreenB = proxyProvider->createRenderTargetProxy({}, 64, 64, PixelFormat::RGBA_8888);
+  ASSERT_TRUE(resultA != nullptr && resultB != nullptr);
+  ASSERT_TRUE(offscreenA != nullptr && offscreenB != nullptr);
+  // Each offscreen target is filled and then drawn into its own result, so their lifetimes don't
+  // overlap once the tasks are sorted.
+  drawingManager->fillRTWithFP(
+      offscreenA, ConstColorProcessor::Make(drawingBuffer, Color::Red(), InputMode::Ignore), 0);
+  drawingManager->fillRTWithFP(resultA, TextureEffect::Make(offscreenA->asTextureProxy()), 0);
+  drawingManager->fillRTWithFP(
+      offscreenB, ConstColorProcessor::Make(drawingBuffer, Color::Blue(), InputMode::Ignore), 0);
+  drawingManager->fillRTWithFP(resultB, TextureEffect::Make(offscreenB->asTextureProxy()), 0);
+  offscreenA = nullptr;
+  context->flush();
+  auto texture = offscreenB->asTextureProxy()->getTexture();
+  ASSERT_TRUE(texture != nullptr);
+  auto cache = context->resourceCache();
+  size_t textureCount = 0;
+  for (auto resources : {&cache->nonpurgeableResources, &cache->purgeableResources}) {
+    for (auto resource : *resources) {
+      if (resource->scratchKey == texture->scratchKey) {
+        textureCount++;
+      }
+    }
+  }
+  // The texture of offscreenA went back to the scratch pool before offscreenB was instantiated.
+  EXPECT_EQ(textureCount, 1u);
+  context->flushAndSubmit(true);
+}
+
 #ifdef TGFX_USE_THREADS
 TGFX_TEST(ResourceCacheTest, blockBufferRefCount) {
   BlockBuffer blockBuffer;
@@ -17,6 +17,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "gpu/RenderContext.h"
+#include "gpu/RenderTaskGraph.h"
 #include "gpu/opengl/GLCaps.h"
 #include "gpu/opengl/GLUtil.h"
 #include "tgfx/gpu/opengl/GLDevice.h"
@@ -76,4 +77,25 @@ TGFX_TEST(SurfaceTest, ImageSnapshot) {
   auto gl = GLFunctions::Get(context);
   gl->deleteTextures(1, &textureInfo.id);
 }
+
+TGFX_TEST(SurfaceTest, RenderTaskOrder) {
+  int targetA = 0;
+  int targetB = 0;
+  int targetC = 0;
+  RenderTaskGraph graph = {};
+  // Task 2 only depends on task 0, so it runs right after it on the same render target.
+  graph.addTask({{}, {&targetA}});
+  graph.addTask({{}, {&targetB}});
+  graph.addTask({{}, {&targetA}});
+  graph.addTask({{&targetA, &targetB}, {&targetC}});
+  EXPECT_EQ(graph.sort(), std::vector<size_t>({0, 2, 1, 3}));
+
+  RenderTaskGraph readGraph = {};
+  // Task 2 overwrites the render target read by task 1, so it must wait for task 1.
+  readGraph.addTask({{}, {&targetA}});
+  readGraph.addTask({{&targetA}, {&targetB}});
+  readGraph.addTask({{}, {&targetA}});
+  readGraph.addTask({{}, {&targetB}});
+  EXPECT_EQ(readGraph.sort(), std::vector<size_t>({0, 1, 3, 2}));
+}
 }  // namespace tgfx
@@ -0,0 +1,73 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//  Tencent is pleased to support the open source community by making tgfx available.
+//
+//  Copyright (C) 2025 Tencent. All rights reserved.
+//
+//  Licensed under the BSD 3-Clause License (the "License"); you may not use this file except
+//  in compliance with the License. You may obtain a copy of the License at
+//
+//      https://opensource.org/licenses/BSD-3-Clause
+//
+//  unless required by applicable law or agreed to in writing, software distributed under the
+//  license is distributed on an "as is" basis, without warranties or conditions of any kind,
+//  either express or implied. see the license for the specific language governing permissions
+//  and limitations under the license.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <filesystem>
+#include "core/utils/TraceScope.h"
+#include "tgfx/core/Data.h"
+#include "tgfx/core/Tracer.h"
+#include "utils/TestUtils.h"
+
+namespace tgfx {
+TGFX_TEST(TracerTest, FrameCountersAndChromeTrace) {
+  TraceCount(TraceCounter::DrawCalls, 5);
+  Tracer::MarkFrame();
+  EXPECT_TRUE(Tracer::GetFrameCounters().empty());
+
+  Tracer::Start(4);
+  EXPECT_TRUE(Tracer::IsActive());
+  for (int i = 0; i < 6; i++) {
+    TraceScope scope("TracerTest::Zone");
+  }
+  { TraceScope scope("TracerTest::Inactive", false); }
+  TraceCount(TraceCounter::DrawCalls, 3);
+  TraceCount(TraceCounter::UploadBytes, 1024);
+  Tracer::MarkFrame();
+  TraceCount(TraceCounter::DrawCalls);
+  Tracer::MarkFrame();
+  Tracer::Stop();
+  EXPECT_FALSE(Tracer::IsActive());
+
+  auto frames = Tracer::GetFrameCounters();
+  ASSERT_EQ(frames.size(), 2U);
+  EXPECT_EQ(frames[0].frameIndex, 0U);
+  EXPECT_EQ(frames[0][TraceCounter::DrawCalls], 3U);
+  EXPECT_EQ(frames[0][TraceCounter::UploadBytes], 1024U);
+  EXPECT_EQ(frames[1][TraceCounter::DrawCalls], 1U);
+  EXPECT_EQ(frames[1][TraceCounter::UploadBytes], 0U);
+
+  auto path = ProjectPath::Absolute("test/out/Trace.json");
+  std::filesystem::path filePath = path;
+  std::filesystem::create_directories(filePath.parent_path());
+  EXPECT_TRUE(Tracer::WriteChromeTrace(path));
+  auto data = Data::MakeFromFile(path);
+  ASSERT_TRUE(data != nullptr);
+  std::string json(static_cast<const char*>(data->data()), data->size());
+  EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0U);
+  size_t zoneCount = 0;
+  for (auto pos = json.find("TracerTest::Zone"); pos != std::string::npos;
+       pos = json.find("TracerTest::Zone", pos + 1)) {
+    zoneCount++;
+  }
+  // The ring buffer keeps only the latest four zones.
+  EXPECT_EQ(zoneCount, 4U);
+  EXPECT_EQ(json.find("TracerTest::Inactive"), std::string::npos);
+  EXPECT_NE(json.find("\"DrawCalls\":3"), std::string::npos);
+  std::filesystem::remove(path);
+}
+}  // namespace tgfx